@@ -17,6 +17,8 @@ ov_option(ENABLE_PRIVATE_TESTS "NPU private unit, behavior and functional tests"
 
 ov_dependent_option(ENABLE_NPU_FUZZ_TESTS "NPU Fuzz tests" OFF "ENABLE_TESTS" OFF)
 
+ov_dependent_option(ENABLE_NPU_MICRO_BENCHMARKS "NPU compiler micro-benchmarks" OFF "ENABLE_TESTS" OFF)
+
 if(NOT ENABLE_LTO)
     set(ENABLE_LTO OFF)
 endif()
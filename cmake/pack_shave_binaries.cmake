@@ -0,0 +1,121 @@
+#
+# Copyright (C) 2024 Intel Corporation.
+# SPDX-License-Identifier: Apache 2.0
+#
+
+# Packs the SHAVE binaries from INPUT_DIR into an uncompressed bundle and writes it to OUTPUT as a C++ source.
+# This is the fallback for the cross builds without a host vpux-shave-bundle, the layout must follow
+# src/vpux_compiler/include/vpux/compiler/act_kernels/shave_binary_bundle_format.h.
+#
+# Usage: cmake -D INPUT_DIR=<dir> -D OUTPUT=<file> -P pack_shave_binaries.cmake
+
+if(NOT DEFINED INPUT_DIR OR NOT DEFINED OUTPUT)
+    message(FATAL_ERROR "INPUT_DIR and OUTPUT must be defined")
+endif()
+
+set(bundle_alignment 8)
+set(header_size 16)
+set(entry_size 40)
+
+# Returns `value` as `num_bytes` little-endian bytes in hex
+function(to_le_hex value num_bytes out_var)
+    math(EXPR hex "${value}" OUTPUT_FORMAT HEXADECIMAL)
+    string(SUBSTRING "${hex}" 2 -1 hex)
+    string(TOLOWER "${hex}" hex)
+    math(EXPR num_digits "${num_bytes} * 2")
+    string(LENGTH "${hex}" hex_length)
+    while(hex_length LESS num_digits)
+        string(PREPEND hex "0")
+        math(EXPR hex_length "${hex_length} + 1")
+    endwhile()
+
+    set(result "")
+    math(EXPR last_byte "${num_bytes} - 1")
+    foreach(byte RANGE ${last_byte})
+        math(EXPR pos "(${last_byte} - ${byte}) * 2")
+        string(SUBSTRING "${hex}" ${pos} 2 byte_hex)
+        string(APPEND result "${byte_hex}")
+    endforeach()
+    set(${out_var} "${result}" PARENT_SCOPE)
+endfunction()
+
+# Returns the zero bytes in hex which align `size` to the bundle alignment
+function(padding_hex size out_var)
+    math(EXPR padding "(${bundle_alignment} - ${size} % ${bundle_alignment}) % ${bundle_alignment}")
+    set(result "")
+    while(padding GREATER 0)
+        string(APPEND result "00")
+        math(EXPR padding "${padding} - 1")
+    endwhile()
+    set(${out_var} "${result}" PARENT_SCOPE)
+endfunction()
+
+# Collect the binaries sorted by name, the names are the ones getShaveBinaryName returns
+set(names "")
+file(GLOB bins LIST_DIRECTORIES false "${INPUT_DIR}/*")
+foreach(bin ${bins})
+    file(READ "${bin}" bin_hex HEX)
+    # Kernels without a data section produce empty files, the compiler handles missing and empty data the same way
+    if(NOT bin_hex STREQUAL "")
+        get_filename_component(name "${bin}" NAME)
+        string(REGEX REPLACE "\\.| |-" "_" name "${name}")
+        list(APPEND names "${name}")
+        set(hex_${name} "${bin_hex}")
+    endif()
+endforeach()
+list(SORT names)
+list(LENGTH names num_entries)
+
+set(data_hex "")
+set(entries_hex "")
+math(EXPR name_offset "${header_size} + ${num_entries} * ${entry_size}")
+
+# CMake 3.13 has no string(HEX), the names are converted through a file
+string(REPLACE ";" "" all_names "${names}")
+file(WRITE "${OUTPUT}.names" "${all_names}")
+file(READ "${OUTPUT}.names" names_hex HEX)
+file(REMOVE "${OUTPUT}.names")
+
+string(LENGTH "${all_names}" names_size)
+math(EXPR data_offset "${name_offset} + ${names_size}")
+padding_hex(${data_offset} names_padding_hex)
+string(LENGTH "${names_padding_hex}" names_padding_length)
+math(EXPR data_offset "${data_offset} + ${names_padding_length} / 2")
+
+foreach(name ${names})
+    string(LENGTH "${name}" name_size)
+    set(bin_hex "${hex_${name}}")
+    string(LENGTH "${bin_hex}" bin_hex_length)
+    math(EXPR bin_size "${bin_hex_length} / 2")
+
+    to_le_hex(${name_offset} 8 name_offset_hex)
+    to_le_hex(${data_offset} 8 data_offset_hex)
+    to_le_hex(${bin_size} 8 size_hex)
+    to_le_hex(${name_size} 4 name_size_hex)
+    # nameOffset, dataOffset, storedSize, size, nameSize, compression = None
+    string(APPEND entries_hex
+        "${name_offset_hex}${data_offset_hex}${size_hex}${size_hex}${name_size_hex}00000000")
+
+    padding_hex(${bin_size} bin_padding_hex)
+    string(APPEND data_hex "${bin_hex}${bin_padding_hex}")
+    string(LENGTH "${bin_padding_hex}" bin_padding_length)
+
+    math(EXPR name_offset "${name_offset} + ${name_size}")
+    math(EXPR data_offset "${data_offset} + ${bin_size} + ${bin_padding_length} / 2")
+endforeach()
+
+# magic "NPUSKB\0\0", version 1, numEntries
+to_le_hex(${num_entries} 4 num_entries_hex)
+set(bundle_hex "4e5055534b42000001000000${num_entries_hex}${entries_hex}${names_hex}${names_padding_hex}${data_hex}")
+string(REGEX REPLACE "([0-9a-f][0-9a-f])" "0x\\1," bundle_bytes "${bundle_hex}")
+
+file(WRITE "${OUTPUT}"
+    "// Generated by pack_shave_binaries.cmake, do not edit\n\n"
+    "#include <cstddef>\n#include <cstdint>\n\n"
+    "namespace vpux {\n\n"
+    "extern const uint8_t embeddedShaveBinaryBundle[];\n"
+    "extern const size_t embeddedShaveBinaryBundleSize;\n\n"
+    "alignas(${bundle_alignment}) const uint8_t embeddedShaveBinaryBundle[] = {${bundle_bytes}};\n"
+    "const size_t embeddedShaveBinaryBundleSize = sizeof(embeddedShaveBinaryBundle);\n\n"
+    "}  // namespace vpux\n"
+)
@@ -16,6 +16,7 @@
 
 #include "vpux/compiler/NPU40XX/dialect/ELF/ops.hpp"
 #include "vpux/compiler/dialect/IE/IR/ops.hpp"
+#include "vpux/compiler/utils/ELF/blob_sink.hpp"
 
 namespace vpux {
 namespace ELF {
@@ -26,5 +27,16 @@ std::vector<uint8_t> exportToELF(
         const std::vector<std::shared_ptr<const ov::Node>>& results = std::vector<std::shared_ptr<const ov::Node>>(),
         Logger log = Logger::global());
 
+/*
+ *  Exports the module and hands the resulting image over to the sink in file order. The data sections made only of
+ *  constants are not kept by the ELF writer, they are serialized in bounded batches straight into the sink after the
+ *  rest of the image
+ */
+void exportToELF(
+        mlir::ModuleOp module, BlobSink& sink,
+        const std::vector<std::shared_ptr<const ov::Node>>& parameters = std::vector<std::shared_ptr<const ov::Node>>(),
+        const std::vector<std::shared_ptr<const ov::Node>>& results = std::vector<std::shared_ptr<const ov::Node>>(),
+        Logger log = Logger::global());
+
 }  // namespace ELF
 }  // namespace vpux
@@ -81,6 +81,10 @@ bool operator==(const SymbolSignature& lhs, const SymbolSignature& rhs);
 
 struct RelocationInfo;
 
+struct DeferredBinaryOp;
+
+struct DeferredSection;
+
 class SymbolReferenceMap;
 
 }  // namespace ELF
@@ -127,3 +131,18 @@ struct vpux::ELF::RelocationInfo {
     bool isOffsetRelative;
     std::string description;
 };
+
+// Op whose serialization was deferred by DataSectionOp::serializeLayout, to be done with
+// BinaryOpInterface::serializeToBuffer into `size` bytes
+struct vpux::ELF::DeferredBinaryOp {
+    vpux::ELF::BinaryOpInterface op;
+    size_t size;
+};
+
+// Data section left empty in the ELF writer by DataSectionOp::serializeLayout. Its ops are serialized at export time
+// straight into the exported image, so the section content is never held by the writer
+struct vpux::ELF::DeferredSection {
+    std::string name;
+    SmallVector<vpux::ELF::DeferredBinaryOp> ops;
+    size_t size;
+};
@@ -19,6 +19,7 @@ public:
                        Logger log) override;
     void buildELFPipeline(mlir::PassManager& pm, const intel_npu::Config& config, mlir::TimingScope& rootTiming,
                           Logger log) override;
+    bool mayRequireWlmRollback(const intel_npu::Config& config) override;
 };
 
 }  // namespace vpux
@@ -0,0 +1,63 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#pragma once
+
+#include "vpux/compiler/act_kernels/shave_binary_bundle_format.h"
+
+#include <llvm/ADT/ArrayRef.h>
+#include <llvm/ADT/SmallVector.h>
+#include <llvm/ADT/StringRef.h>
+#include <llvm/Support/MemoryBuffer.h>
+
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace vpux {
+
+//
+// ShaveBinaryBundle
+//
+
+// Read-only view of a bundle packed with packShaveBinaryBundle. Entries are looked up right in the bundle data,
+// the compressed ones are decompressed on first use and kept for the lifetime of the bundle.
+// The lookup is thread-safe.
+class ShaveBinaryBundle final {
+public:
+    // The bundle does not own `data`, it must outlive the bundle. `origin` is only used in the error messages
+    ShaveBinaryBundle(llvm::ArrayRef<uint8_t> data, llvm::StringRef origin);
+
+    static std::unique_ptr<ShaveBinaryBundle> load(llvm::StringRef path);
+
+public:
+    size_t size() const {
+        return _numEntries;
+    }
+
+    llvm::StringRef getName(size_t index) const;
+
+    // Returns std::nullopt if the bundle does not contain `name`
+    std::optional<llvm::ArrayRef<uint8_t>> find(llvm::StringRef name) const;
+
+private:
+    ShaveBinaryBundleEntry getEntry(size_t index) const;
+    llvm::ArrayRef<uint8_t> getStoredData(const ShaveBinaryBundleEntry& entry) const;
+    llvm::ArrayRef<uint8_t> decompress(size_t index) const;
+
+private:
+    std::unique_ptr<llvm::MemoryBuffer> _buffer;
+    llvm::ArrayRef<uint8_t> _data;
+    std::string _origin;
+    size_t _numEntries = 0;
+
+    using DecompressedData = llvm::SmallVector<uint8_t, 0>;
+    mutable std::mutex _mutex;
+    mutable std::vector<std::unique_ptr<DecompressedData>> _decompressed;
+};
+
+}  // namespace vpux
@@ -0,0 +1,68 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#pragma once
+
+#include <llvm/ADT/StringRef.h>
+#include <llvm/Support/Compression.h>
+#include <llvm/Support/Error.h>
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace vpux {
+
+//
+// SHAVE binary bundle format
+//
+
+// A bundle is laid out as follows, all offsets are relative to its beginning and all fields are in host byte order:
+//   ShaveBinaryBundleHeader
+//   ShaveBinaryBundleEntry[numEntries] - sorted by name, so that an entry can be found right in the bundle
+//   names of the entries
+//   data of the entries - each entry is compressed on its own and starts at SHAVE_BINARY_BUNDLE_ALIGNMENT
+
+constexpr char SHAVE_BINARY_BUNDLE_MAGIC[8] = {'N', 'P', 'U', 'S', 'K', 'B', '\0', '\0'};
+constexpr uint32_t SHAVE_BINARY_BUNDLE_VERSION = 1;
+constexpr uint64_t SHAVE_BINARY_BUNDLE_ALIGNMENT = 8;
+
+enum class ShaveBinaryCompression : uint32_t { None = 0, Zlib = 1, Zstd = 2 };
+
+struct ShaveBinaryBundleHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t numEntries;
+};
+
+struct ShaveBinaryBundleEntry {
+    uint64_t nameOffset;
+    uint64_t dataOffset;
+    uint64_t storedSize;  // size of the data in the bundle
+    uint64_t size;        // size of the data once decompressed
+    uint32_t nameSize;
+    uint32_t compression;  // ShaveBinaryCompression
+};
+
+static_assert(sizeof(ShaveBinaryBundleHeader) == 16, "Unexpected padding in ShaveBinaryBundleHeader");
+static_assert(sizeof(ShaveBinaryBundleEntry) == 40, "Unexpected padding in ShaveBinaryBundleEntry");
+
+struct ShaveBinary {
+    std::string name;
+    std::vector<uint8_t> data;
+};
+
+// Returns the name the kernels look the binary file up by, e.g. "softmax_3720xx.elf" -> "softmax_3720xx_elf"
+std::string getShaveBinaryName(llvm::StringRef fileName);
+
+// Returns std::nullopt for ShaveBinaryCompression::None
+std::optional<llvm::compression::Format> getCompressionFormat(ShaveBinaryCompression compression);
+
+// Packs the binaries into a bundle. Every binary is compressed with `format`, unless that does not make it smaller
+llvm::Expected<std::vector<uint8_t>> packShaveBinaryBundle(std::vector<ShaveBinary> binaries,
+                                                          std::optional<llvm::compression::Format> format);
+
+}  // namespace vpux
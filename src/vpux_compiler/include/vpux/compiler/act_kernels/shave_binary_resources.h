@@ -3,24 +3,33 @@
 // SPDX-License-Identifier: Apache 2.0
 //
 
+#pragma once
+
 #include <llvm/ADT/ArrayRef.h>
 #include <llvm/ADT/StringRef.h>
+#include "vpux/compiler/act_kernels/shave_binary_bundle.h"
 #include "vpux/utils/core/error.hpp"
 #include "vpux/utils/core/format.hpp"
 
 #include <cstdint>
+#include <memory>
+#include <optional>
 #include <utility>
-
-extern std::unordered_map<std::string, const std::pair<const uint8_t*, size_t>> shaveBinaryResourcesMap;
+#include <vector>
 
 namespace vpux {
 
+// List of SHAVE binary bundles separated by the platform path separator (':' or ';'), they are searched in the given
+// order before the bundle embedded into the compiler. This allows to use kernels built for particular arch/variants
+// without rebuilding the compiler, see the vpux-shave-bundle tool
+constexpr char SHAVE_BINARY_BUNDLE_ENV[] = "NPU_SHAVE_BINARY_BUNDLE";
+
 class ShaveBinaryResources {
 public:
     static const ShaveBinaryResources& getInstance();
 
 private:
-    ShaveBinaryResources() = default;
+    ShaveBinaryResources();
 
 public:
     ShaveBinaryResources(ShaveBinaryResources const&) = delete;
@@ -38,16 +47,9 @@ public:
         auto result = printToString("{0}_{1}", entry, cpu);
         auto argsConcat = concatenateArgs(std::forward<Args>(args)...);
         auto symbolName = printToString("sk_{0}{1}_data", result, argsConcat);
-        const auto it = shaveBinaryResourcesMap.find(symbolName);
-
-        // For a shave kernel, the data section may be missing, in which case this symbol will not be found in the map.
-        const uint8_t* symbolData = nullptr;
-        size_t symbolSize = 0;
-        if (it != shaveBinaryResourcesMap.end()) {
-            std::tie(symbolData, symbolSize) = it->second;
-        }
 
-        return llvm::ArrayRef<uint8_t>(symbolData, symbolSize);
+        // For a shave kernel, the data section may be missing, in which case this symbol will not be found.
+        return getBinary(symbolName).value_or(llvm::ArrayRef<uint8_t>());
     }
 
     template <typename... Args>
@@ -55,13 +57,11 @@ public:
         auto result = printToString("{0}_{1}", entry, cpu);
         auto argsConcat = concatenateArgs(std::forward<Args>(args)...);
         auto symbolName = printToString("sk_{0}{1}_text", result, argsConcat);
-        const auto it = shaveBinaryResourcesMap.find(symbolName);
+        const auto binary = getBinary(symbolName);
 
-        VPUX_THROW_UNLESS(it != shaveBinaryResourcesMap.end(), "Can't find '.text' for kernel symbol '{0}'",
-                          symbolName);
+        VPUX_THROW_UNLESS(binary.has_value(), "Can't find '.text' for kernel symbol '{0}'", symbolName);
 
-        const auto [symbolData, symbolSize] = it->second;
-        return llvm::ArrayRef<uint8_t>(symbolData, symbolSize);
+        return binary.value();
     }
 
     template <typename... Args>
@@ -69,15 +69,20 @@ public:
         auto result = printToString("{0}_{1}", entry, cpu);
         auto argsConcat = concatenateArgs(std::forward<Args>(args)...);
         auto symbolName = printToString("{0}{1}_elf", result, argsConcat);
-        const auto it = shaveBinaryResourcesMap.find(symbolName);
+        const auto binary = getBinary(symbolName);
 
-        VPUX_THROW_UNLESS(it != shaveBinaryResourcesMap.end(), "Can't find 'elf' for kernel symbol '{0}'", symbolName);
+        VPUX_THROW_UNLESS(binary.has_value(), "Can't find 'elf' for kernel symbol '{0}'", symbolName);
 
-        const auto [symbolData, symbolSize] = it->second;
-        return llvm::ArrayRef<uint8_t>(symbolData, symbolSize);
+        return binary.value();
     }
 
     llvm::ArrayRef<uint8_t> getElf(llvm::StringRef kernelPath) const;
+
+private:
+    // Binaries are decompressed on first use and stay valid for the lifetime of the process
+    std::optional<llvm::ArrayRef<uint8_t>> getBinary(llvm::StringRef symbolName) const;
+
+    std::vector<std::unique_ptr<ShaveBinaryBundle>> _bundles;
 };
 
 }  // namespace vpux
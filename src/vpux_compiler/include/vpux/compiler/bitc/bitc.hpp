@@ -4,18 +4,29 @@
 //
 
 #pragma once
+#include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <vector>
 
 namespace vpux::bitc {
 
 enum class ArchType : uint32_t { NPU27, NPU4 };
+enum class KernelType : uint32_t { SIMD, SCALAR };
+
+// Runs task(0) ... task(num_tasks - 1), possibly concurrently, and returns once all of them are done
+using ParallelFor = std::function<void(size_t num_tasks, const std::function<void(size_t)>& task)>;
 
 struct BitCompactorConfig {
     ArchType arch_type;  // NPU37XX / NPU40XX
     bool weight_compress_enable{true};
     bool bypass_compression{false};
     bool mode_fp16_enable{false};  // NPU40XX only
+    // Spreads the blocks over the threads of the caller, they are encoded serially if empty. The output doesn't
+    // depend on it
+    ParallelFor parallel_for;
+    // Block kernels of the encoder, SIMD falls back to SCALAR without SSE2. The output doesn't depend on it
+    KernelType kernel_type{KernelType::SIMD};
 
     // For sparse mode
     std::vector<uint8_t> bitmap;
@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include "vpux/compiler/core/task_set.hpp"
 #include "vpux/compiler/dialect/VPURT/IR/ops.hpp"
 #include "vpux/compiler/dialect/VPURT/IR/task.hpp"
 #include "vpux/utils/core/func_ref.hpp"
@@ -18,14 +19,16 @@
 #include <llvm/ADT/BitVector.h>
 #include <llvm/ADT/SmallSet.h>
 
+#include <optional>
+
 namespace vpux {
 
 class BarrierInfo {
 public:
     // TaskSet is used to store barrier's producer/consumer task op index as well as task op's
-    // wait/update barrier index, which is supposed to have better performance than BitVector when the data size is
-    // small.
-    using TaskSet = llvm::SmallSet<size_t, 16>;
+    // wait/update barrier index. It is a sorted vector for small sets and switches to a chunked bitset for large ones,
+    // so both the common case and the wide barriers (e.g. around sync points) stay cheap.
+    using TaskSet = vpux::TaskSet;
     explicit BarrierInfo();
     explicit BarrierInfo(mlir::func::FuncOp func);
     friend class BarrierInfoTest;
@@ -33,8 +36,8 @@ public:
 public:
     void updateIR();
     void clearAttributes();
-    TaskSet& getWaitBarriers(size_t taskInd);
-    TaskSet& getUpdateBarriers(size_t taskInd);
+    const TaskSet& getWaitBarriers(size_t taskInd) const;
+    const TaskSet& getUpdateBarriers(size_t taskInd) const;
     uint32_t getIndex(VPURT::TaskOp taskOp) const;
     uint32_t getIndex(VPURT::DeclareVirtualBarrierOp barrierOp) const;
     virtual VPURT::TaskOp getTaskOpAtIndex(size_t opIdx) const;
@@ -51,6 +54,10 @@ private:
     bool producersControlsAllConsumers(const TaskSet& origProducers, const TaskSet& newConsumers,
                                        const TaskSet& origConsumers, ArrayRef<TaskSet> origWaitBarriersMap);
     bool inImplicitQueueTypeDependencyList(const TaskSet& taskList);
+    void buildTaskControlMapRows(SmallVector<llvm::BitVector>& taskControlMap, size_t blockStartInd,
+                                 size_t blockEndInd, size_t lastTaskInd, bool considerTaskFifoDependency);
+    void updateTaskControlMap(size_t producerInd, size_t consumerInd);
+    void invalidateTaskControlMap();
 
     void optimizeBarrierProducers(size_t blockIdx);
     void optimizeBarrierConsumers(size_t blockIdx);
@@ -76,6 +83,22 @@ public:
     void buildTaskQueueTypeMap(bool considerTaskFifoDependency = true);
     std::pair<SmallVector<llvm::BitVector>, size_t> buildTaskControlMap(size_t blockIdx,
                                                                         bool considerTaskFifoDependency = true);
+
+    /**
+     * @brief Get the task control map of given control graph block
+     *
+     * The map is built with buildTaskControlMap on the first request and cached. Adding producers or consumers
+     * within the block afterwards only rebuilds the rows of the tasks placed before the new producers on the next
+     * request, so passes which interleave control path queries with barrier insertion don't need to rebuild the whole
+     * map. Any other modification of the barrier maps drops the cache.
+     * The returned map is only valid until the next modification of BarrierInfo.
+     *
+     * @param blockIdx control graph block index
+     * @param considerTaskFifoDependency if true, tasks on the same FIFO are considered dependent
+     * @return Task control map and index of the first task of the block
+     */
+    std::pair<ArrayRef<llvm::BitVector>, size_t> getTaskControlMap(size_t blockIdx,
+                                                                   bool considerTaskFifoDependency = true);
     size_t getNumOfTasks() const;
     size_t getNumOfVirtualBarriers() const;
     virtual size_t getBarrierMaxVariantSum() const;
@@ -84,7 +107,7 @@ public:
     void resetBarrier(VPURT::DeclareVirtualBarrierOp barrierOp);
     void resetBarrier(size_t barrierInd);
     size_t addNewBarrier(VPURT::DeclareVirtualBarrierOp barrierOp);
-    bool controlPathExistsBetweenTasksInSameBlock(const SmallVector<llvm::BitVector>& taskControlMap, size_t taskAInd,
+    bool controlPathExistsBetweenTasksInSameBlock(ArrayRef<llvm::BitVector> taskControlMap, size_t taskAInd,
                                                   size_t taskBInd, bool biDirection = true) const;
     size_t getProducerSlotCount(VPURT::DeclareVirtualBarrierOp barrierOp);
     size_t getConsumerSlotCount(VPURT::DeclareVirtualBarrierOp barrierOp);
@@ -102,10 +125,10 @@ public:
     void removeConsumers(size_t barrierInd, const TaskSet& taskInds);
     void removeProducers(VPURT::DeclareVirtualBarrierOp barrierOp, const TaskSet& taskInds);
     void removeConsumers(VPURT::DeclareVirtualBarrierOp barrierOp, const TaskSet& taskInds);
-    TaskSet& getBarrierProducers(VPURT::DeclareVirtualBarrierOp barrierOp);
-    TaskSet& getBarrierConsumers(VPURT::DeclareVirtualBarrierOp barrierOp);
-    TaskSet& getBarrierProducers(size_t barrierIdn);
-    TaskSet& getBarrierConsumers(size_t barrierIdn);
+    const TaskSet& getBarrierProducers(VPURT::DeclareVirtualBarrierOp barrierOp) const;
+    const TaskSet& getBarrierConsumers(VPURT::DeclareVirtualBarrierOp barrierOp) const;
+    const TaskSet& getBarrierProducers(size_t barrierIdn) const;
+    const TaskSet& getBarrierConsumers(size_t barrierIdn) const;
     SmallVector<TaskSet> createLegalVariantBatches(const TaskSet& tasks, size_t availableSlots);
     std::optional<VPURT::TaskQueueType> haveSameImplicitDependencyTaskQueueType(const TaskSet& taskInds);
     bool canBarriersBeMerged(const TaskSet& barrierProducersA, const TaskSet& barrierConsumersA,
@@ -210,6 +233,18 @@ private:
     // Initialize below structure with buildTaskQueueTypeMap()
     // indexOf(VPURT::TaskQueueType) 'contains' [ indexOf(VPURT::TaskOp)... ].
     std::map<VPURT::TaskQueueType, llvm::BitVector> _taskQueueTypeMap;
+
+    // Task control map of a single block returned by getTaskControlMap(). addProducer(s) and addConsumer(s) mark the
+    // rows up to lastOutdatedTaskInd as outdated, all the other modifications of the barrier maps invalidate it.
+    struct TaskControlMapCache {
+        bool valid = false;
+        size_t blockIdx = 0;
+        bool considerTaskFifoDependency = true;
+        size_t blockStartInd = 0;
+        std::optional<size_t> lastOutdatedTaskInd;
+        SmallVector<llvm::BitVector> taskControlMap;
+    };
+    TaskControlMapCache _taskControlMapCache;
 };
 
 using BarrierMap = SmallVector<SmallVector<size_t>>;
@@ -224,6 +259,8 @@ public:
         size_t Nbarriers = 0;
         size_t controlGraphBlockSize = 0;
         SmallVector<size_t> syncTasksIds = {};
+        // Each entry lists the tasks executed in order on the same FIFO
+        BarrierMap taskQueues = {};
     };
 
     explicit BarrierInfoTest(BarrierInfoTest::BarrierMaps& barrierMaps);
@@ -9,8 +9,11 @@
 #include "vpux/compiler/core/cost_model_utils.hpp"
 #include "vpux/compiler/core/linear_scan_handler.hpp"
 #include "vpux/compiler/core/mem_live_range_info.hpp"
+#include "vpux/compiler/core/task_set.hpp"
 #include "vpux/compiler/utils/partitioner.hpp"
 
+#include "vpux/utils/core/flat_map.hpp"
+
 namespace vpux {
 
 class FeasibleMemoryScheduler final {
@@ -92,12 +95,20 @@ public:
         mlir::Value spillBuffer_;
     };
 
-    // Sort pair by the second arg - operation index (=async-deps-index) which is aligned with order in IR
-    struct operationIdxSort {
-        // TODO will be replaced by DPU order heuristic
-        bool operator()(const operationIdxType& op1, const operationIdxType& op2) const {
-            return op1 < op2;
+    // Compute operations of a queue in IR order, consumed from the front
+    struct ComputeOpQueue {
+        bool empty() const {
+            return nextOpInd >= ops.size();
+        }
+        operationIdxType front() const {
+            return ops[nextOpInd];
         }
+        void pop() {
+            ++nextOpInd;
+        }
+
+        SmallVector<operationIdxType> ops;
+        size_t nextOpInd = 0;
     };
     // Sort heap by earliest begin cycle
     struct CycleBeginMinHeapOrdering {
@@ -443,12 +454,13 @@ private:
     std::set<HeapElement, CycleBeginMinHeapOrdering> _cycleBeginHeap;
     // heap with earliest operation end cycle
     std::set<HeapElement, CycleEndMinHeapOrdering> _cycleEndHeap;
+    // ready lists below are iterated in operation index order (=async-deps-index) which is aligned with order in IR
     // compute operations with 0 in-degree, optimal to schedule, that strictly preserve IR order
-    std::set<operationIdxType, operationIdxSort> _readyComputeOps;
+    TaskSet _readyComputeOps;
     // compute DMA operations with 0 in-degree, that do not necessarily preserve IR order
-    std::set<operationIdxType, operationIdxSort> _readyDMAOps;
+    TaskSet _readyDMAOps;
     // data operations with 0 in-degree
-    std::set<operationIdxType, operationIdxSort> _readyDataOps;
+    TaskSet _readyDataOps;
     // spilled operation which are ready to be rescheduled
     mlir::DenseMap<mlir::Value, operationIdxType> _readySpilledOps;
     // store operation spilled buffers
@@ -457,7 +469,7 @@ private:
     // input to output. Such operations need to be distinguished from other ops as scheduler
     // is focused on scheduling ops along compute chain. Such operation will only be considered
     // for scheduling once all input dependency data and/or compute ops have been executed
-    std::set<operationIdxType, operationIdxSort> _nonComputeChainOps;
+    TaskSet _nonComputeChainOps;
     // operation in-degree, number of incoming edges
     std::unordered_map<operationIdxType, size_t> _inDegreeTable;
     // operation out-degree, number of outgoing edges
@@ -475,11 +487,11 @@ private:
     // operation level vector
     mlir::SmallVector<size_t> _opLevelVec;
     // order for compute ops from IR
-    std::map<QueueType, SmallVector<operationIdxType>> _computeOpOrder;
+    FlatMap<QueueType, ComputeOpQueue> _computeOpOrder;
     // cycle pipeline for every executor. Vector element type is to support multiple instances of
     // same executor type in case where scheduler needs to be aware of it
     // TODO: Currently scheduler supports only multiple DMA executors (ports)
-    std::map<QueueType, SmallVector<size_t>> _executorPipelines = {
+    FlatMap<QueueType, SmallVector<size_t>> _executorPipelines = {
             {{VPU::ExecutorKind::DMA_NN}, {1}},    {{VPU::ExecutorKind::DPU}, {1}},
             {{VPU::ExecutorKind::SHAVE_UPA}, {1}}, {{VPU::ExecutorKind::NCE}, {1}},
             {{VPU::ExecutorKind::SHAVE_NN}, {1}},  {{VPU::ExecutorKind::SHAVE_ACT}, {1}},
@@ -28,6 +28,8 @@ std::unique_ptr<mlir::Pass> createStartLocationVerifierPass(
         vpux::Logger log, const mlir::detail::PassOptions::Option<std::string>& locationsVerificationMode);
 std::unique_ptr<mlir::Pass> createStopLocationVerifierPass(vpux::Logger log);
 
+std::unique_ptr<mlir::Pass> createMergeIdenticalFunctionsPass(Logger log = Logger::global());
+
 //
 // Generated
 //
@@ -61,6 +61,30 @@ struct ReferenceSWOptions : mlir::PassPipelineOptions<T> {
             llvm::cl::desc("Cache will be cleaned to this threshold when reach the memory usage limit"),
             llvm::cl::init(0.8)};
 
+    StrOption constantFoldingInBackgroundEvictionPolicy{
+            *this, "constant-folding-in-background-eviction-policy",
+            llvm::cl::desc("Policy used to evict entries from the cache when the memory usage limit is reached. "
+                           "Possible values: refcount (default), lru, gdsf"),
+            llvm::cl::init("refcount")};
+
+    StrOption constantFoldingCacheDir{
+            *this, "constant-folding-cache-dir",
+            llvm::cl::desc("Directory of the persistent constant folding cache, shared across compilations. The cache "
+                           "is disabled if no directory is given"),
+            llvm::cl::init("")};
+
+    IntOption constantFoldingCacheMinEntrySize{
+            *this, "constant-folding-cache-min-entry-size",
+            llvm::cl::desc("Minimal size (in KB) of a folded constant to be stored in the persistent constant folding "
+                           "cache. Ignored if `constant-folding-cache-dir` is not set."),
+            llvm::cl::init(64)};
+
+    StrOption passFlightRecorderOutput{
+            *this, "pass-flight-recorder-output",
+            llvm::cl::desc("Path of the JSON (Chrome trace) report with the time, memory, IR size and constant folding "
+                           "statistics of every pass. The recorder is disabled if no path is given"),
+            llvm::cl::init("")};
+
     BoolOption wlmRollback{
             *this, "wlm-rollback",
             llvm::cl::desc("When compilation with WLM fails, automatically switches to WLM-disabled pipeline"),
@@ -303,6 +327,30 @@ struct ReferenceHWOptions : mlir::PassPipelineOptions<T> {
             llvm::cl::desc("Cache will be cleaned to this threshold when reach the memory usage limit"),
             llvm::cl::init(0.8)};
 
+    StrOption constantFoldingInBackgroundEvictionPolicy{
+            *this, "constant-folding-in-background-eviction-policy",
+            llvm::cl::desc("Policy used to evict entries from the cache when the memory usage limit is reached. "
+                           "Possible values: refcount (default), lru, gdsf"),
+            llvm::cl::init("refcount")};
+
+    StrOption constantFoldingCacheDir{
+            *this, "constant-folding-cache-dir",
+            llvm::cl::desc("Directory of the persistent constant folding cache, shared across compilations. The cache "
+                           "is disabled if no directory is given"),
+            llvm::cl::init("")};
+
+    IntOption constantFoldingCacheMinEntrySize{
+            *this, "constant-folding-cache-min-entry-size",
+            llvm::cl::desc("Minimal size (in KB) of a folded constant to be stored in the persistent constant folding "
+                           "cache. Ignored if `constant-folding-cache-dir` is not set."),
+            llvm::cl::init(64)};
+
+    StrOption passFlightRecorderOutput{
+            *this, "pass-flight-recorder-output",
+            llvm::cl::desc("Path of the JSON (Chrome trace) report with the time, memory, IR size and constant folding "
+                           "statistics of every pass. The recorder is disabled if no path is given"),
+            llvm::cl::init("")};
+
     BoolOption wlmRollback{
             *this, "wlm-rollback",
             llvm::cl::desc("When compilation with WLM fails, automatically switches to WLM-disabled pipeline"),
@@ -509,6 +557,30 @@ struct DefaultHWOptionsBase : mlir::PassPipelineOptions<DefaultHWOptionsBase> {
             llvm::cl::desc("Cache will be cleaned to this threshold when reach the memory usage limit"),
             llvm::cl::init(0.8)};
 
+    StrOption constantFoldingInBackgroundEvictionPolicy{
+            *this, "constant-folding-in-background-eviction-policy",
+            llvm::cl::desc("Policy used to evict entries from the cache when the memory usage limit is reached. "
+                           "Possible values: refcount (default), lru, gdsf"),
+            llvm::cl::init("refcount")};
+
+    StrOption constantFoldingCacheDir{
+            *this, "constant-folding-cache-dir",
+            llvm::cl::desc("Directory of the persistent constant folding cache, shared across compilations. The cache "
+                           "is disabled if no directory is given"),
+            llvm::cl::init("")};
+
+    IntOption constantFoldingCacheMinEntrySize{
+            *this, "constant-folding-cache-min-entry-size",
+            llvm::cl::desc("Minimal size (in KB) of a folded constant to be stored in the persistent constant folding "
+                           "cache. Ignored if `constant-folding-cache-dir` is not set."),
+            llvm::cl::init(64)};
+
+    StrOption passFlightRecorderOutput{
+            *this, "pass-flight-recorder-output",
+            llvm::cl::desc("Path of the JSON (Chrome trace) report with the time, memory, IR size and constant folding "
+                           "statistics of every pass. The recorder is disabled if no path is given"),
+            llvm::cl::init("")};
+
     BoolOption wlmRollback{
             *this, "wlm-rollback",
             llvm::cl::desc("When compilation with WLM fails, automatically switches to WLM-disabled pipeline"),
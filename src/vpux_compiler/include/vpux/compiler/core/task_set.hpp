@@ -0,0 +1,191 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#pragma once
+
+#include "vpux/utils/core/small_vector.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <utility>
+
+namespace vpux {
+
+//
+// TaskSet
+//
+// Ordered set of task or barrier indexes. Small sets are kept as a sorted vector, which is cheap to copy and to
+// iterate. Once a set grows beyond SMALL_SIZE elements it switches to a chunked bitset: a sorted list of fixed-size
+// bit chunks, each covering CHUNK_BITS consecutive indexes. Barriers are usually produced and consumed by tasks with
+// close indexes, so large sets only use a few chunks and the bulk operations (union, intersection, difference) work
+// on whole words instead of single elements.
+//
+// The interface follows llvm::SmallSet, so the set can also be used with the generic algorithms from
+// llvm/ADT/SetOperations.h. Iteration is always done in increasing order.
+//
+
+class TaskSet final {
+public:
+    static constexpr size_t SMALL_SIZE = 16;
+    static constexpr size_t CHUNK_BITS = 256;
+
+public:
+    using value_type = size_t;
+    using key_type = size_t;
+    using size_type = size_t;
+
+    class const_iterator final {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = size_t;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const size_t*;
+        using reference = const size_t&;
+
+    public:
+        const_iterator() = default;
+
+        const size_t& operator*() const {
+            return _value;
+        }
+        const size_t* operator->() const {
+            return &_value;
+        }
+
+        const_iterator& operator++();
+        const_iterator operator++(int);
+
+        bool operator==(const const_iterator& other) const {
+            return _set == other._set && _pos == other._pos && _bit == other._bit;
+        }
+        bool operator!=(const const_iterator& other) const {
+            return !(*this == other);
+        }
+
+    private:
+        friend class TaskSet;
+
+        // For small sets `_pos` is the position in the sorted vector, for large ones it is the chunk position and
+        // `_bit` is the bit position inside that chunk
+        const_iterator(const TaskSet* set, size_t pos, size_t bit);
+
+        // The chunked representation has no element storage, so the current value is kept in the iterator
+        void updateValue();
+
+        const TaskSet* _set = nullptr;
+        size_t _pos = 0;
+        size_t _bit = 0;
+        size_t _value = 0;
+    };
+
+    using iterator = const_iterator;
+
+public:
+    TaskSet() = default;
+    TaskSet(std::initializer_list<size_t> values);
+
+    template <typename IterT>
+    TaskSet(IterT begin, IterT end) {
+        insert(begin, end);
+    }
+
+public:
+    bool empty() const {
+        return _size == 0;
+    }
+
+    size_t size() const {
+        return _size;
+    }
+
+    bool isSmall() const {
+        return !_isLarge;
+    }
+
+    void clear();
+
+    const_iterator begin() const;
+    const_iterator end() const;
+
+    // Smallest and largest elements, the set must not be empty
+    size_t front() const;
+    size_t back() const;
+
+public:
+    bool contains(size_t value) const;
+
+    size_t count(size_t value) const {
+        return contains(value) ? 1 : 0;
+    }
+
+    std::pair<const_iterator, bool> insert(size_t value);
+
+    template <typename IterT>
+    void insert(IterT begin, IterT end) {
+        for (; begin != end; ++begin) {
+            insert(*begin);
+        }
+    }
+
+    bool erase(size_t value);
+
+public:
+    // Bulk operations, which work on whole chunks when both sets are large
+
+    // Adds all the elements of `other`, returns true if the set was changed
+    bool setUnion(const TaskSet& other);
+    // Keeps only the elements which are also in `other`
+    void setIntersect(const TaskSet& other);
+    // Removes all the elements which are in `other`
+    void setSubtract(const TaskSet& other);
+
+    bool intersects(const TaskSet& other) const;
+    bool isSubsetOf(const TaskSet& other) const;
+
+    bool operator==(const TaskSet& other) const;
+    bool operator!=(const TaskSet& other) const {
+        return !(*this == other);
+    }
+
+private:
+    static constexpr size_t WORD_BITS = 64;
+    static constexpr size_t WORDS_PER_CHUNK = CHUNK_BITS / WORD_BITS;
+
+    struct Chunk {
+        size_t index = 0;
+        std::array<uint64_t, WORDS_PER_CHUNK> words = {};
+
+        bool test(size_t bit) const {
+            return (words[bit / WORD_BITS] >> (bit % WORD_BITS)) & 1;
+        }
+        bool none() const;
+        size_t count() const;
+        // Returns CHUNK_BITS if there is no set bit at or after `bit`
+        size_t findNext(size_t bit) const;
+        size_t findLast() const;
+
+        bool operator==(const Chunk& other) const {
+            return index == other.index && words == other.words;
+        }
+    };
+
+    // Position of the first chunk with an index not less than `chunkIndex`
+    size_t findChunk(size_t chunkIndex) const;
+    bool hasChunk(size_t pos, size_t chunkIndex) const;
+    void convertToLarge();
+    void convertToSmallIfNeeded();
+    void removeEmptyChunks();
+
+private:
+    bool _isLarge = false;
+    size_t _size = 0;
+    SmallVector<size_t, SMALL_SIZE> _small;
+    SmallVector<Chunk, 0> _chunks;
+};
+
+}  // namespace vpux
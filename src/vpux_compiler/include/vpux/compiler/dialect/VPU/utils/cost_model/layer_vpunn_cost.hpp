@@ -6,6 +6,7 @@
 #pragma once
 
 #include "vpux/compiler/dialect/VPU/utils/cost_model/cost_model.hpp"
+#include "vpux/compiler/dialect/VPU/utils/cost_model/vpunn_cost_cache.hpp"
 #include "vpux/compiler/dialect/VPU/utils/distributed_tensor_utils.hpp"
 #include "vpux/compiler/dialect/VPU/utils/strategy_manager/operation_strategies.hpp"
 
@@ -47,11 +48,17 @@ private:
 /*
  *  Class adaptor to get cost from VPUNN
  *  for DPU, SW layers
+ *  Layer costs are memoized in a VPUNNCostCache. By default each instance has its own cache,
+ *  passing a shared cache lets several instances working on the same MLIRContext reuse the
+ *  costs of identical layers
  */
 
 class LayerVPUNNCost final {
 public:
-    LayerVPUNNCost(mlir::func::FuncOp func, Logger log = Logger::global()): _log(log) {
+    LayerVPUNNCost(mlir::func::FuncOp func, Logger log = Logger::global(),
+                   std::shared_ptr<VPUNNCostCache> costCache = nullptr)
+            : _costCache(costCache != nullptr ? std::move(costCache) : std::make_shared<VPUNNCostCache>()),
+              _log(log) {
         auto module = func->getParentOfType<mlir::ModuleOp>();
         _arch = VPU::getArch(module);
         _vpunnCostModel = VPU::createLayerCostModel(_arch);
@@ -73,6 +80,13 @@ public:
      */
     StrategyCost getStrategyCost(mlir::Operation* operation, const VPUNNCostParameters& parameters) const;
 
+    /*
+     *  Get the hit/miss statistics of the layer cost cache
+     */
+    VPUNNCostCache::Statistics getCacheStatistics() const {
+        return _costCache->getStatistics();
+    }
+
     /*
      *  Get the cost of the spill between operations
      */
@@ -92,6 +106,11 @@ public:
                                      std::function<bool(mlir::Value value)> findOperand = nullptr) const;
 
 private:
+    /*
+     *  Compute the cost for operation without looking into the cache
+     */
+    StrategyCost computeStrategyCost(mlir::Operation* operation, const VPUNNCostParameters& parameters) const;
+
     /*
      *  Get the cost of NCE operation.
      *   In case tiling is passed, cost is taken with tiling parameters
@@ -121,6 +140,7 @@ private:
     int64_t _numDMAPorts;
     VPUNN::VPUDevice _vpuDevice;
     std::shared_ptr<VPUNN::VPULayerCostModel> _vpunnCostModel;
+    std::shared_ptr<VPUNNCostCache> _costCache;
     Logger _log;
 };
 
@@ -0,0 +1,101 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#pragma once
+
+#include "vpux/compiler/core/tiling.hpp"
+#include "vpux/compiler/dialect/VPU/utils/strategy_manager/operation_strategies.hpp"
+
+#include <mlir/IR/Operation.h>
+
+#include <atomic>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+
+namespace vpux::VPU {
+
+//
+// VPUNNWorkloadKey
+//
+// Everything a layer cost depends on: the operation name and attributes, the operand and result types and the
+// requested strategy and tiling. The multi-cluster and tiling strategy attributes of the operation are left out, as
+// they are being assigned while the costs are queried and the requested ones are used for the cost instead.
+// Attributes and types are uniqued in the MLIRContext, so the key is compared and hashed through their handles and is
+// only meaningful within the context of the operation.
+//
+
+struct VPUNNWorkloadKey final {
+    VPUNNWorkloadKey(mlir::Operation* operation, VPU::MultiClusterStrategy strategy, const OutputTiling& tiling,
+                     TilingMode mode, ArrayRef<SmallVector<TileInfo>> operandsTiling);
+
+    bool operator==(const VPUNNWorkloadKey& other) const;
+
+    mlir::OperationName name;
+    SmallVector<mlir::NamedAttribute> attrs;
+    SmallVector<mlir::Type> operandTypes;
+    SmallVector<mlir::Type> resultTypes;
+    VPU::MultiClusterStrategy strategy;
+    TilingMode mode;
+    OutputTiling tiling;
+    SmallVector<SmallVector<TileInfo>> operandsTiling;
+};
+
+struct VPUNNWorkloadKeyHash final {
+    size_t operator()(const VPUNNWorkloadKey& key) const;
+};
+
+//
+// VPUNNCostCache
+//
+// Thread-safe memoization of the layer costs returned by VPUNN, so that identical layers of a function and repeated
+// queries for the same layer and strategy share a single VPUNN inference. The cache must not outlive the MLIRContext
+// of the cached operations, see VPUNNWorkloadKey.
+//
+
+class VPUNNCostCache final {
+public:
+    struct Statistics {
+        size_t numHits = 0;
+        size_t numMisses = 0;
+        size_t numEntries = 0;
+
+        double getHitRate() const {
+            const auto numQueries = numHits + numMisses;
+            return numQueries != 0 ? static_cast<double>(numHits) / static_cast<double>(numQueries) : 0.0;
+        }
+    };
+
+public:
+    std::optional<StrategyCost> find(const VPUNNWorkloadKey& key);
+    void insert(VPUNNWorkloadKey key, StrategyCost cost);
+
+    /*
+     *  Returns the cached cost for the workload, or computes and caches it
+     *  The computation is done without holding the lock, so concurrent misses for the same workload may compute
+     *  the cost more than once, which is harmless as the cost is deterministic
+     */
+    template <typename ComputeFunc>
+    StrategyCost getOrCompute(VPUNNWorkloadKey key, ComputeFunc&& computeCost) {
+        if (const auto cost = find(key)) {
+            return cost.value();
+        }
+        const StrategyCost cost = computeCost();
+        insert(std::move(key), cost);
+        return cost;
+    }
+
+    Statistics getStatistics() const;
+    void clear();
+
+private:
+    std::unordered_map<VPUNNWorkloadKey, StrategyCost, VPUNNWorkloadKeyHash> _costs;
+    mutable std::mutex _mutex;
+
+    std::atomic<size_t> _numHits = 0;
+    std::atomic<size_t> _numMisses = 0;
+};
+
+}  // namespace vpux::VPU
@@ -8,6 +8,7 @@
 #include "vpux/compiler/core/ops_interfaces.hpp"
 #include "vpux/compiler/dialect/ELFNPU37XX/ops_interfaces.hpp"
 #include "vpux/compiler/dialect/const/attributes/content.hpp"
+#include "vpux/compiler/dialect/const/utils/resource_blobs.hpp"
 
 #include "vpux/utils/core/logger.hpp"
 
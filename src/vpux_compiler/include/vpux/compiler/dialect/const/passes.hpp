@@ -21,6 +21,7 @@ namespace Const {
 
 std::unique_ptr<mlir::Pass> createConstantFoldingPass(Logger log = Logger::global());
 std::unique_ptr<mlir::Pass> createApplySwizzlingPass();
+std::unique_ptr<mlir::Pass> createReleaseUnusedResourcesPass(Logger log = Logger::global());
 
 void registerConstPipelines();
 
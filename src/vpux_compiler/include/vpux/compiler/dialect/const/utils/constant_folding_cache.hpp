@@ -10,15 +10,21 @@
 #include "vpux/compiler/dialect/const/attributes/content.hpp"
 #include "vpux/compiler/dialect/const/utils/content.hpp"
 #include "vpux/utils/core/mem_size.hpp"
+#include "vpux/utils/core/small_vector.hpp"
 
 #include <mlir/IR/MLIRContext.h>
 
+#include <llvm/ADT/DenseMap.h>
+
 #include <tbb/concurrent_hash_map.h>
-#include <tbb/concurrent_queue.h>
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <map>
 #include <mutex>
+#include <optional>
+#include <shared_mutex>
 #include <utility>
 
 namespace vpux {
@@ -38,6 +44,21 @@ struct FoldingRequest {
     Const::TransformAttrInterface newTransformation;
 };
 
+//
+// CacheEvictionPolicy
+//
+// Determines which entries are removed first from the cache once the memory usage limit is reached:
+// - RefCount (default): entries with the lowest difference between the number of queries and retrievals are removed
+//         first
+// - LRU: the least recently used entries are removed first
+// - GDSF: Greedy-Dual-Size-Frequency; each entry gets the priority `L + frequency * foldingCost / size`, where `L` is
+//         the priority of the last evicted entry. Small entries which are expensive to recompute and used often are
+//         kept the longest, while entries which have not been used recently gradually lose priority as `L` grows
+enum class CacheEvictionPolicy { RefCount, LRU, GDSF };
+
+StringRef stringifyCacheEvictionPolicy(CacheEvictionPolicy policy);
+std::optional<CacheEvictionPolicy> symbolizeCacheEvictionPolicy(StringRef str);
+
 //
 // details
 //
@@ -57,20 +78,70 @@ struct ContentAttrHash {
 //
 // CachedContent
 //
-// Contains two elements:
+// Contains the following elements:
 // - content: Represents the folded content
 // - refCount: An integer that represents the number of times the content has been queried minus the number of times it
 // has been retrieved. Based on observation, the more times the content is queried, the more likely it is going to be
 // used in the future. Conversely, the more times the content is retrieved, the less likely it is going to be used in
-// the future. Therefore, a smaller refCount indicates a higher priority for removing the cache entry if the memory
-// limit is reached. This is a temporary solution for the basic cache clean mechanism and will be further optimized in
-// the future.
+// the future. Used by the RefCount eviction policy.
+// - size: The size of the folded content in bytes
+// - foldingCost: The time in microseconds it took to fold the content, i.e. the time saved by every cache hit
+// - lastAccess: The value of the cache access clock when the content was last added or retrieved. Used by the LRU
+// eviction policy
+// - frequency: The number of times the content has been added or retrieved
+// - priority: The GDSF priority computed on the last access. Used by the GDSF eviction policy
 struct CachedContent {
     Const::Content content;
     std::atomic<int> refCount{1};
+    size_t size = 0;
+    uint64_t foldingCost = 0;
+    std::atomic<uint64_t> lastAccess{0};
+    std::atomic<size_t> frequency{0};
+    std::atomic<double> priority{0.0};
+};
+
+//
+// RequestQueue
+//
+// Blocking queue which serves the folding requests in the order they were enqueued. It also tracks the ContentAttr requests which are
+// being folded at the moment, so that a thread which needs the folded value of a request can either take the request
+// out of the queue and fold it itself, or wait for the background folding to finish, instead of folding the same
+// content twice.
+class RequestQueue {
+public:
+    enum class ClaimResult {
+        // No request for the attribute is queued or being folded
+        NotFound,
+        // The request has been removed from the queue and marked in progress, so the caller is expected to fold it,
+        // add the result to the cache and call markCompleted. Other threads needing it wait in the meantime
+        Claimed,
+        // The request was being folded in background and the folding has finished
+        Completed
+    };
+
+    void push(const FoldingRequest& request);
+    FoldingRequest pop();
+
+    void markInProgress(Const::ContentAttr attr);
+    void markCompleted(Const::ContentAttr attr);
+    ClaimResult claimOrWait(Const::ContentAttr attr);
+
+    size_t size();
+
+private:
+    void eraseFromIndex(mlir::Attribute attr, uint64_t sequence);
+
+    // Keyed by the sequence number, so that the claimed requests can be removed from the middle of the queue
+    std::map<uint64_t, FoldingRequest> _entries;
+    llvm::DenseMap<mlir::Attribute, SmallVector<uint64_t, 1>> _index;
+    llvm::DenseMap<mlir::Attribute, size_t> _inProgress;
+    uint64_t _nextSequence = 0;
+
+    std::mutex _mutex;
+    std::condition_variable _requestAvailable;
+    std::condition_variable _requestCompleted;
 };
 
-using RequestQueue = tbb::concurrent_bounded_queue<FoldingRequest>;
 using ContentMap = tbb::concurrent_hash_map<Const::ContentAttr, CachedContent, ContentAttrHash>;
 
 struct CacheStatistics {
@@ -79,6 +150,20 @@ struct CacheStatistics {
     std::atomic<size_t> numCacheHits = 0;
     std::atomic<size_t> numCacheMisses = 0;
     std::atomic<size_t> numDuplicatedRequests = 0;
+    std::atomic<size_t> numEvictions = 0;
+    std::atomic<size_t> numBytesEvicted = 0;
+    // Size of the contents served from the cache instead of being folded again
+    std::atomic<size_t> numBytesSaved = 0;
+    // Folding time in microseconds saved by the cache hits
+    std::atomic<uint64_t> foldingTimeSaved = 0;
+    // Number of cache misses for which the request was taken out of the queue and folded by the requesting thread
+    std::atomic<size_t> numClaimedRequests = 0;
+    // Number of cache misses for which the requesting thread waited for the background folding to finish
+    std::atomic<size_t> numWaitedRequests = 0;
+    // Time in microseconds spent by the requesting threads waiting for the background folding to finish
+    std::atomic<uint64_t> waitingTime = 0;
+    // Time in microseconds spent by the requesting threads folding contents not found in the cache
+    std::atomic<uint64_t> inlineFoldingTime = 0;
 
     void updateMaxNumRequestsInQueue(size_t newNumRequests);
     void updateMaxCacheSize(size_t newCacheSize);
@@ -120,6 +205,24 @@ public:
      */
     FoldingRequest getRequest();
 
+    /**
+     * @brief Marks the beginning and the end of the background folding of the given attribute
+     * @details This method is thread-safe
+     */
+    void markRequestInProgress(Const::ContentAttr attr);
+    void markRequestCompleted(Const::ContentAttr attr);
+
+    /**
+     * @brief Called when the folded value of the given attribute is needed but was not found in the cache. If the
+     * request is still queued, it is removed from the queue so that the caller can fold it without duplicating the
+     * work of the background threads. In that case the caller must add the result to the cache and then call
+     * markRequestCompleted. If the request is being folded, waits for it to finish
+     * @details This method is thread-safe
+     * @param `attr`: the attribute whose folded value is needed
+     * @return The status of the request
+     */
+    Const::details::RequestQueue::ClaimResult claimOrWaitRequest(Const::ContentAttr attr);
+
     /**
      * @brief Checks whether the given attribute is found in the cache
      * @details This method is thread-safe
@@ -132,8 +235,10 @@ public:
      * @details This method is thread-safe
      * @param `attr`: the folding request whose folding result should be added to the cache
      * @param `content`: the folding result
+     * @param `foldingCost`: the time it took to produce the folding result, used by the eviction policy
      */
-    void addContent(Const::ContentAttr attr, const Const::Content& content);
+    void addContent(Const::ContentAttr attr, const Const::Content& content,
+                    std::chrono::microseconds foldingCost = std::chrono::microseconds::zero());
 
     /**
      * @brief Sets the memory usage limit for the cache
@@ -151,6 +256,19 @@ public:
      */
     void setCacheCleanThreshold(double cacheCleanThreshold);
 
+    /**
+     * @brief Sets the policy used to select the entries removed from the cache when the memory limit is reached
+     * @details This method is not thread-safe but assumed not to be used in contexts
+     * where multi-threading scenarios are involved
+     * @param `policy`: the eviction policy
+     */
+    void setEvictionPolicy(Const::CacheEvictionPolicy policy);
+
+    /**
+     * @brief Gets the eviction policy of the cache
+     */
+    Const::CacheEvictionPolicy getEvictionPolicy() const;
+
     /**
      * @brief Gets the memory used by the cache
      * @details This method is not thread-safe but assumed not to be used in contexts
@@ -159,7 +277,7 @@ public:
     size_t getMemoryUsedCache() const;
 
     /**
-     * @brief Clean the cache to cacheCleanThreshold based on the refCount
+     * @brief Clean the cache to cacheCleanThreshold based on the eviction policy
      * @details This method is thread-safe
      */
     void cleanUpCache();
@@ -223,15 +341,26 @@ public:
      */
     Const::details::CacheStatistics& getStatistics();
 
+private:
+    void updateAccessInfo(Const::details::CachedContent& cachedContent);
+    double getEvictionPriority(const Const::details::CachedContent& cachedContent) const;
+
 private:
     Const::details::RequestQueue _requestQueue{};
     Const::details::ContentMap _cache{};
 
-    std::mutex _mutex;
+    // Guards the structure of `_cache`: insertions and removals take it shared, since the map supports them
+    // concurrently, while iterating over the map requires it exclusively
+    std::shared_mutex _cacheMutex;
     bool _collectStatistics = false;
     size_t _memoryUsageLimit = 0;
     double _cacheCleanThreshold = 0.8;
     std::atomic<size_t> _memoryUsedCache = 0;
+    Const::CacheEvictionPolicy _evictionPolicy = Const::CacheEvictionPolicy::RefCount;
+    // Logical clock incremented on every access of a cache entry
+    std::atomic<uint64_t> _accessClock = 0;
+    // The GDSF inflation value `L`, i.e. the priority of the last evicted entry
+    std::atomic<double> _gdsfInflation = 0.0;
     Const::details::CacheStatistics _statistics{};
 };
 
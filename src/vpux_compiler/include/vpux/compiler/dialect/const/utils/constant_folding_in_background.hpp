@@ -21,7 +21,8 @@ namespace Const {
 class BackgroundConstantFolding {
 public:
     BackgroundConstantFolding(mlir::MLIRContext* ctx, size_t maxConcurrentTasks, bool collectStatistics,
-                              size_t memoryUsageLimit, double cacheCleanThreshold, Logger log = Logger::global());
+                              size_t memoryUsageLimit, double cacheCleanThreshold,
+                              CacheEvictionPolicy evictionPolicy, Logger log = Logger::global());
     ~BackgroundConstantFolding();
 
     BackgroundConstantFolding(const BackgroundConstantFolding&) = delete;
@@ -32,6 +33,7 @@ public:
 private:
     std::shared_future<void> initFoldingListener(llvm::ThreadPool& threadPool);
     void stopFoldingListener();
+    void waitForAvailableTask();
     void processFoldingRequest(const FoldingRequest& foldingRequest, ConstantFoldingCache& cache);
 
     bool _isEnabled = true;
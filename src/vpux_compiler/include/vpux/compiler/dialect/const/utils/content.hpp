@@ -17,19 +17,54 @@
 
 #include <llvm/Support/TypeName.h>
 
+#include <algorithm>
+#include <limits>
 #include <memory>
+#include <type_traits>
 
 namespace vpux {
 namespace Const {
 
 namespace details {
 
+// Element-wise folding of contents with at least twice as many elements is split into chunks of this size, which are
+// processed in parallel on the thread pool of the MLIRContext
+constexpr int64_t PARALLEL_FOLDING_MIN_CHUNK_SIZE = 64 * 1024;
+
+//
+// FP16ClampStats
+//
+
+// Counts the values which are out of range for FP16, so that they are reported with a single warning instead of one
+// warning per value. Not thread-safe: parallel loops count per chunk and merge the counts once the chunk is done
+struct FP16ClampStats final {
+    int64_t numClamped = 0;
+    float minClamped = std::numeric_limits<float>::infinity();
+    float maxClamped = -std::numeric_limits<float>::infinity();
+
+    void add(float val) {
+        ++numClamped;
+        minClamped = std::min(minClamped, val);
+        maxClamped = std::max(maxClamped, val);
+    }
+
+    void merge(const FP16ClampStats& other) {
+        numClamped += other.numClamped;
+        minClamped = std::min(minClamped, other.minClamped);
+        maxClamped = std::max(maxClamped, other.maxClamped);
+    }
+};
+
+// Emits one warning for all the values counted in `stats`, if there are any
+void reportFP16Clamping(const FP16ClampStats& stats);
+
 //
 // ConvertCb
 //
 
+// `clampStats` is only used by the conversions to FP16
 template <typename OutT>
-using ConvertCb = OutT (*)(const char*);
+using ConvertCb = OutT (*)(const char*, FP16ClampStats* clampStats);
 
 template <typename OutT>
 struct CvtHelper final {
@@ -42,13 +77,17 @@ struct CvtHelper final {
 template <>
 struct CvtHelper<vpux::type::float16> final {
     template <typename InT>
-    static vpux::type::float16 cvt(InT val) {
+    static vpux::type::float16 cvt(InT val, FP16ClampStats* clampStats = nullptr) {
         auto castedVal = vpux::type::float16(checked_cast<float>(val));
         if (std::isinf(castedVal)) {
             const auto clampedVal = std::numeric_limits<vpux::type::float16>::clamp(castedVal);
-            auto logger = Logger::global();
-            logger.warning("Value is out of range for FP16 = {0}; clamping to = {1}.", checked_cast<float>(val),
-                           checked_cast<float>(clampedVal));
+            if (clampStats != nullptr) {
+                clampStats->add(checked_cast<float>(val));
+            } else {
+                auto logger = Logger::global();
+                logger.warning("Value is out of range for FP16 = {0}; clamping to = {1}.", checked_cast<float>(val),
+                               checked_cast<float>(clampedVal));
+            }
             return clampedVal;
         }
         return castedVal;
@@ -89,8 +128,12 @@ struct CvtHelper<bool> final {
 
 template <typename InT, typename OutT>
 ConvertCb<OutT> makeConvertCb() {
-    return [](const char* rawPtr) {
-        return CvtHelper<OutT>::cvt(*reinterpret_cast<const InT*>(rawPtr));
+    return [](const char* rawPtr, [[maybe_unused]] FP16ClampStats* clampStats) {
+        if constexpr (std::is_same_v<OutT, vpux::type::float16>) {
+            return CvtHelper<OutT>::cvt(*reinterpret_cast<const InT*>(rawPtr), clampStats);
+        } else {
+            return CvtHelper<OutT>::cvt(*reinterpret_cast<const InT*>(rawPtr));
+        }
     };
 }
 
@@ -101,8 +144,9 @@ ConvertCb<OutT> makeConvertCb() {
 template <typename OutT>
 class ContentRangeBase final {
 public:
-    ContentRangeBase(ArrayRef<char> data, bool isSplat, Byte elemSize, ConvertCb<OutT> cvtOp)
-            : _data(data), _isSplat(isSplat), _elemSize(elemSize), _cvtOp(std::move(cvtOp)) {
+    ContentRangeBase(ArrayRef<char> data, bool isSplat, Byte elemSize, ConvertCb<OutT> cvtOp,
+                     FP16ClampStats* clampStats)
+            : _data(data), _isSplat(isSplat), _elemSize(elemSize), _cvtOp(std::move(cvtOp)), _clampStats(clampStats) {
         if (_isSplat) {
             VPUX_THROW_UNLESS(_data.size() == checked_cast<size_t>(_elemSize.count()),
                               "Splat data store size '{0}' doesn't match element type size '{1}'", _data.size(),
@@ -113,13 +157,13 @@ public:
 public:
     OutT getItem(ptrdiff_t ind) const {
         if (_isSplat) {
-            return _cvtOp(_data.data());
+            return _cvtOp(_data.data(), _clampStats);
         }
 
         const auto rawIndex = checked_cast<size_t>(ind * _elemSize.count());
         VPUX_THROW_UNLESS(rawIndex < _data.size(), "Out-of-bound access in ContentRangeBase");
 
-        return _cvtOp(_data.data() + rawIndex);
+        return _cvtOp(_data.data() + rawIndex, _clampStats);
     }
 
 public:
@@ -135,6 +179,8 @@ private:
     bool _isSplat = false;
     Byte _elemSize;
     ConvertCb<OutT> _cvtOp;
+    // Not owned, the values clamped to FP16 are warned about one by one without it
+    FP16ClampStats* _clampStats = nullptr;
 };
 
 //
@@ -147,8 +193,9 @@ class ContentRange final :
     using BaseType = llvm::indexed_accessor_range<ContentRange<OutT>, ContentRangeBase<OutT>, OutT, OutT, OutT>;
 
 public:
-    ContentRange(ArrayRef<char> data, bool isSplat, Byte elemSize, ptrdiff_t count, ConvertCb<OutT> cvtOp)
-            : BaseType(ContentRangeBase<OutT>(data, isSplat, elemSize, std::move(cvtOp)), 0, count) {
+    ContentRange(ArrayRef<char> data, bool isSplat, Byte elemSize, ptrdiff_t count, ConvertCb<OutT> cvtOp,
+                 FP16ClampStats* clampStats = nullptr)
+            : BaseType(ContentRangeBase<OutT>(data, isSplat, elemSize, std::move(cvtOp), clampStats), 0, count) {
     }
 
 public:
@@ -171,6 +218,10 @@ public:
     // The `getValues` / `getSplatValue` methods accept template type parameter and convert element type on the fly.
     static Content fromRawBuffer(vpux::NDTypeInterface type, ArrayRef<char> data, mlir::Type storageElemType,
                                  bool isSplat);
+    // Same as `fromRawBuffer`, but the returned Content shares the ownership of `owner`, which is expected to keep
+    // `data` alive (e.g. a memory-mapped file). The data is treated as read-only.
+    static Content fromExternalBuffer(vpux::NDTypeInterface type, ArrayRef<char> data, mlir::Type storageElemType,
+                                      bool isSplat, std::shared_ptr<const void> owner);
     static Content allocTempBuffer(vpux::NDTypeInterface type, mlir::Type storageElemType, bool isSplat);
     static Content allocTempBuffer(vpux::NDTypeInterface type, mlir::Type storageElemType, bool isSplat,
                                    size_t tempBufRawSize);
@@ -183,8 +234,10 @@ public:
     }
 
 public:
+    // The values which are out of range for FP16 are counted in `clampStats` if it is set and warned about one by one
+    // otherwise. The range must not be read from several threads with the same `clampStats`
     template <typename OutT>
-    details::ContentRange<OutT> getValues() const& {
+    details::ContentRange<OutT> getValues(details::FP16ClampStats* clampStats = nullptr) const& {
         auto cvtOp = dispatchByElemType<details::ConvertCb<OutT>>(getStorageElemType(), [](auto dummy) {
             using InT = std::decay_t<decltype(dummy)>;
             return details::makeConvertCb<InT, OutT>();
@@ -194,11 +247,11 @@ public:
         VPUX_THROW_WHEN(storageElemTypeSize.count() < CHAR_BIT, "Unsupported storage type of size '{0}' bits.",
                         storageElemTypeSize.count());
         return details::ContentRange<OutT>(_data, _isSplat, storageElemTypeSize, getType().getNumElements(),
-                                           std::move(cvtOp));
+                                           std::move(cvtOp), clampStats);
     }
 
     template <typename OutT>
-    void getValues() && = delete;
+    void getValues(details::FP16ClampStats* clampStats = nullptr) && = delete;
 
     template <typename OutT>
     std::vector<OutT> vec() const {
@@ -348,6 +401,7 @@ private:
     mlir::Type _storageElemType;
     bool _isSplat = false;
     std::shared_ptr<char[]> _tempBuf;
+    std::shared_ptr<const void> _externalBuf;
 };
 
 }  // namespace Const
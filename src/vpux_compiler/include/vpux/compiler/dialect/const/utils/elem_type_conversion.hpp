@@ -0,0 +1,47 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#pragma once
+
+#include "vpux/utils/core/array_ref.hpp"
+
+#include <mlir/IR/MLIRContext.h>
+#include <mlir/IR/Types.h>
+
+#include <cstdint>
+
+namespace vpux {
+namespace Const {
+namespace details {
+
+//
+// Bulk element type conversion
+//
+// Converts contiguous spans of floating-point values without going through a conversion callback per element. The
+// FP32 <-> FP16 kernels use F16C / AVX-512 when the host supports them and fall back to scalar code otherwise; the
+// other kernels are plain loops which the compiler is able to vectorize. The results are bit-identical to the
+// element-wise conversion done by `CvtHelper`, including the clamping of FP16 values which are out of range.
+//
+
+/**
+ * @brief Checks whether a bulk conversion kernel exists for the given pair of element types
+ */
+bool isBulkConversionSupported(mlir::Type srcElemType, mlir::Type dstElemType);
+
+/**
+ * @brief Converts all the elements of `src` into `dst`, in parallel chunks on the thread pool of the MLIRContext
+ * @details The values which had to be clamped are reported once for the whole buffer, instead of once per value
+ * @param `srcElemType`: element type of the values in `src`
+ * @param `src`: the source buffer, containing `numElements` values
+ * @param `dstElemType`: element type of the values written into `dst`
+ * @param `dst`: the destination buffer, which must be large enough to hold `numElements` values
+ * @return false if there is no bulk conversion kernel for this pair of types, in which case nothing is written
+ */
+bool convertElements(mlir::Type srcElemType, ArrayRef<char> src, mlir::Type dstElemType, MutableArrayRef<char> dst,
+                     int64_t numElements);
+
+}  // namespace details
+}  // namespace Const
+}  // namespace vpux
@@ -0,0 +1,30 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#pragma once
+
+#include <cstdint>
+
+namespace vpux {
+namespace Const {
+
+//
+// FoldingCounters
+//
+// Process-wide counters of the ContentAttr::fold calls. They are updated with relaxed atomics, so they are always
+// enabled, and are meant for coarse profiling, e.g. the number of folds done while a given pass was running.
+//
+
+struct FoldingCounters {
+    // Contents computed by applying the transformations
+    uint64_t numFolds = 0;
+    // Contents served by the background or the persistent folding cache
+    uint64_t numCacheHits = 0;
+};
+
+FoldingCounters getFoldingCounters();
+
+}  // namespace Const
+}  // namespace vpux
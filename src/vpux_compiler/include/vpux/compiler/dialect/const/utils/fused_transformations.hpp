@@ -0,0 +1,88 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#pragma once
+
+#include "vpux/compiler/dialect/const/attributes/content.hpp"
+#include "vpux/compiler/dialect/const/utils/content.hpp"
+
+#include "vpux/utils/core/small_vector.hpp"
+
+#include <mlir/IR/Types.h>
+
+namespace vpux {
+namespace Const {
+namespace details {
+
+//
+// FusedTransformations
+//
+// Evaluates a chain of consecutive transformations in a single pass over the input content, instead of allocating and
+// writing an intermediate content for every one of them. The chain may contain element-wise transformations (Add,
+// Rescale, per-tensor Dequantize and Quantize), index-remapping transformations (Reorder, MemPermute, Transpose) and
+// ConvertElemType, which does not touch the data. The remapping transformations are composed into a single memory
+// permutation, so the source is read once and every element is written once, directly in its final position.
+//
+// The result is identical to the one of applying the transformations one by one: every element-wise step rounds its
+// result to the storage type which the staged transformation would have used.
+//
+
+class FusedTransformations final {
+public:
+    /**
+     * @brief Finds the longest prefix of `transformations` which can be evaluated in a single pass over `input`
+     * @details Nothing is matched if fusing would not avoid at least one intermediate content, e.g. for splat inputs,
+     * sub-byte storage types, per-axis quantization or chains shorter than two transformations
+     * @param `input`: the content the transformations are applied on
+     * @param `transformations`: the remaining transformations of the folding chain
+     */
+    static FusedTransformations match(const Const::Content& input,
+                                      ArrayRef<Const::TransformAttrInterface> transformations);
+
+    /**
+     * @brief Returns the number of transformations covered by this object. Zero means that nothing was matched and
+     * the transformations have to be applied one by one
+     */
+    size_t getNumTransformations() const {
+        return _numTransformations;
+    }
+
+    /**
+     * @brief Applies the matched transformations on the content used for matching
+     */
+    Const::Content apply(const Const::Content& input) const;
+
+private:
+    struct ElementwiseStage {
+        enum class Kind { Add, Rescale, Dequantize, Quantize };
+
+        Kind kind;
+        // Add / Rescale
+        float value = 0.0f;
+        // Dequantize
+        double scale = 0.0;
+        int64_t zeroPoint = 0;
+        // Quantize
+        float inLow = 0.0f;
+        float inHigh = 0.0f;
+        float qLow = 0.0f;
+        float qHigh = 0.0f;
+        float levels = 0.0f;
+    };
+
+    double evaluate(double value) const;
+
+private:
+    size_t _numTransformations = 0;
+    SmallVector<ElementwiseStage> _stages;
+    // The memory dimension of the input which provides the index of each memory dimension of the output
+    SmallVector<int64_t> _inMemDims;
+    vpux::NDTypeInterface _outType;
+    mlir::Type _outStorageElemType;
+};
+
+}  // namespace details
+}  // namespace Const
+}  // namespace vpux
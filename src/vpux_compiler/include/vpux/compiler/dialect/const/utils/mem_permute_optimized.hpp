@@ -5,19 +5,38 @@
 
 #pragma once
 
-#include "vpux/compiler/dialect/const/attributes/content.hpp"
+#include "vpux/compiler/core/attributes/dims_order.hpp"
+#include "vpux/compiler/core/attributes/shape.hpp"
+#include "vpux/utils/core/array_ref.hpp"
+#include "vpux/utils/core/mem_size.hpp"
+
+#include <mlir/IR/MLIRContext.h>
 
 namespace vpux {
 namespace Const {
 namespace details {
 
-// checks capability to perform trivial NCHW<->NHWC and NDHWC<->NCDHW
-bool isOptimizedTransformationSupported(vpux::Const::Content& input, vpux::NDTypeInterface outType);
-
 //
-// Performs specialized supported transformations
+// permuteMemory
 //
-void memPermuteTransformationOptimized(vpux::Const::Content& input, vpux::Const::Content& output);
+// Copies a dense buffer into another one with its memory dimensions permuted: memory dimension `i` of the output takes
+// the index of memory dimension `permOrder.dimAt(i)` of the input. Dimensions which stay contiguous in both buffers
+// are merged first, so e.g. NCHW -> NHWC and OIYX -> OYXI both become a batch of 2D transposes. These are done in
+// cache-sized tiles, with SIMD kernels for 1, 2 and 4 byte elements, and the tiles are spread over the thread pool of
+// `ctx`. Any element size is supported, including packed sub-byte elements (1, 2 and 4 bits).
+//
+
+/**
+ * @brief Permutes the memory dimensions of `inBuf` into `outBuf`
+ * @param `inBuf`: the dense input buffer
+ * @param `outBuf`: the dense output buffer, of the same size as `inBuf`
+ * @param `inMemShape`: the shape of the input in memory order
+ * @param `permOrder`: the memory permutation, as in `Const::details::memPermuteTransformation`
+ * @param `elemSize`: the size of one element
+ * @param `ctx`: the context providing the thread pool
+ */
+void permuteMemory(ArrayRef<char> inBuf, MutableArrayRef<char> outBuf, MemShapeRef inMemShape, DimsOrder permOrder,
+                   Bit elemSize, mlir::MLIRContext* ctx);
 
 }  // namespace details
 }  // namespace Const
@@ -0,0 +1,170 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#pragma once
+
+#include "vpux/compiler/dialect/const/attributes/content.hpp"
+#include "vpux/compiler/dialect/const/utils/content.hpp"
+#include "vpux/utils/core/logger.hpp"
+#include "vpux/utils/core/mem_size.hpp"
+
+#include <mlir/IR/MLIRContext.h>
+
+#include <llvm/ADT/DenseMap.h>
+#include <llvm/ADT/SmallString.h>
+
+#include <atomic>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+namespace vpux {
+namespace Const {
+
+//
+// PersistentFoldingCache
+//
+// On-disk, content-addressed storage for folding results which can be shared across compilations and processes.
+// Each entry is identified by a stable hash computed over the compiler version, the base content data, the base type
+// and the serialized list of transformations. The value is stored as a single file with a small header followed by the raw storage
+// buffer of the folded content, aligned so that it can be memory-mapped directly into a `Const::Content` on lookup.
+//
+// Entries are written into a temporary file and then atomically renamed, so that multiple compilations can share the
+// same cache directory concurrently. Any I/O failure is treated as a cache miss and never interrupts compilation.
+//
+
+class PersistentFoldingCache {
+public:
+    /**
+     * @brief Creates a cache backed by the given directory. The directory is created if it does not exist
+     * @param `cacheDir`: path to the cache directory
+     * @param `minEntrySize`: folding results smaller than this size are not stored in the cache
+     */
+    PersistentFoldingCache(StringRef cacheDir, vpux::Byte minEntrySize, Logger log = Logger::global());
+
+    /**
+     * @brief Checks whether the folding result of the given attribute can be stored in the cache
+     * @details This method is thread-safe
+     * @param `attr`: the attribute to check
+     * @return true if the attribute is eligible for caching
+     */
+    bool isCacheable(Const::ContentAttr attr) const;
+
+    /**
+     * @brief Tries to load the folding result for the given attribute. On success, the returned content references
+     * the memory-mapped cache file and keeps the mapping alive for as long as the content is used
+     * @details This method is thread-safe
+     * @param `attr`: the attribute whose folding result should be loaded
+     * @return The folding result if it has been found or an empty optional otherwise
+     */
+    std::optional<Const::Content> load(Const::ContentAttr attr);
+
+    /**
+     * @brief Stores the folding result of the given attribute in the cache directory
+     * @details This method is thread-safe
+     * @param `attr`: the attribute whose folding result is stored
+     * @param `content`: the folding result
+     */
+    void store(Const::ContentAttr attr, const Const::Content& content);
+
+    /**
+     * @brief Computes the key of the given attribute as an hexadecimal string. The key is stable across processes
+     * running the same compiler build
+     * @details This method is thread-safe. Throws if the data of the base content is not available
+     */
+    std::string getKey(Const::ContentAttr attr);
+
+    StringRef getCacheDir() const {
+        return _cacheDir;
+    }
+
+    size_t getNumHits() const {
+        return _numHits;
+    }
+
+    size_t getNumMisses() const {
+        return _numMisses;
+    }
+
+    size_t getNumStores() const {
+        return _numStores;
+    }
+
+private:
+    std::string getKeyDescription(Const::ContentAttr attr);
+    static std::string hashDescription(StringRef description);
+    uint64_t getBaseContentHash(mlir::ElementsAttr baseContent);
+    llvm::SmallString<128> getEntryPath(StringRef key) const;
+
+private:
+    llvm::SmallString<128> _cacheDir;
+    vpux::Byte _minEntrySize;
+    Logger _log;
+
+    // Hashing the base content is the most expensive part of computing a key, so it is done once per base attribute
+    std::mutex _baseHashMutex;
+    llvm::DenseMap<mlir::Attribute, uint64_t> _baseHashes;
+
+    std::atomic<size_t> _numHits = 0;
+    std::atomic<size_t> _numMisses = 0;
+    std::atomic<size_t> _numStores = 0;
+};
+
+//
+// PersistentFoldingCacheManager
+//
+
+class PersistentFoldingCacheManager {
+public:
+    /**
+     * @brief Get the unique instance of the persistent folding cache manager
+     * @details This method is thread-safe
+     * @return The instance of the persistent folding cache manager
+     */
+    static PersistentFoldingCacheManager& getInstance();
+
+    /**
+     * @brief Creates a cache object for the given MLIRContext, if one does not already exist
+     * @details This method is thread-safe
+     * @param `ctx`: the MLIRContext associated with the cache
+     * @param `cacheDir`: path to the cache directory
+     * @param `minEntrySize`: folding results smaller than this size are not stored in the cache
+     * @return True if a new cache object has been created
+     */
+    bool addCache(mlir::MLIRContext* ctx, StringRef cacheDir, vpux::Byte minEntrySize,
+                  Logger log = Logger::global());
+
+    /**
+     * @brief Removes the cache object of the given MLIRContext, if it exists
+     * @details This method is thread-safe
+     * @param `ctx`: the MLIRContext associated with the cache
+     * @return True if a cache object was found and removed, false otherwise
+     */
+    bool removeCache(mlir::MLIRContext* ctx);
+
+    /**
+     * @brief Returns the cache object associated with the given MLIRContext or nullptr if there is none
+     * @details This method is thread-safe
+     * @param `ctx`: the MLIRContext associated with the cache
+     */
+    Const::PersistentFoldingCache* find(mlir::MLIRContext* ctx);
+
+private:
+    PersistentFoldingCacheManager() = default;
+    ~PersistentFoldingCacheManager() = default;
+    PersistentFoldingCacheManager(const PersistentFoldingCacheManager&) = delete;
+    PersistentFoldingCacheManager(PersistentFoldingCacheManager&&) = delete;
+    PersistentFoldingCacheManager operator=(const PersistentFoldingCacheManager&) = delete;
+    PersistentFoldingCacheManager operator=(PersistentFoldingCacheManager&&) = delete;
+
+private:
+    std::unordered_map<mlir::MLIRContext*, std::unique_ptr<Const::PersistentFoldingCache>> _caches;
+
+    std::mutex _mtx;
+};
+
+}  // namespace Const
+}  // namespace vpux
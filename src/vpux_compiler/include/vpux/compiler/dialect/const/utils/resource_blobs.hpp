@@ -0,0 +1,65 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#pragma once
+
+#include "vpux/utils/core/array_ref.hpp"
+#include "vpux/utils/core/func_ref.hpp"
+#include "vpux/utils/core/mem_size.hpp"
+
+#include <mlir/IR/BuiltinAttributes.h>
+#include <mlir/IR/DialectResourceBlobManager.h>
+#include <mlir/IR/Operation.h>
+
+#include <llvm/ADT/DenseSet.h>
+
+#include <mutex>
+
+namespace vpux {
+namespace Const {
+
+// Content produced by the compiler (folded or compressed constants) of at least this size is stored in a heap blob
+// instead of being uniqued in the MLIRContext, so that it can be released once it is no longer used
+constexpr Byte OWNED_RESOURCE_MIN_SIZE = 64_KB;
+
+//
+// OwnedResourceBlobs
+//
+
+// Keeps track of the resource blobs allocated by the compiler for one MLIRContext. The blobs are owned by the
+// resource manager of the context, this registry only remembers which of them may be released.
+class OwnedResourceBlobs final {
+public:
+    using BlobEntry = mlir::DialectResourceBlobManager::BlobEntry;
+
+    void add(BlobEntry* entry);
+    bool contains(BlobEntry* entry) const;
+
+    // Releases the data of all blobs which are not in `usedEntries`, returns the number of released bytes
+    Byte releaseUnused(const llvm::DenseSet<BlobEntry*>& usedEntries);
+
+private:
+    mutable std::mutex _mutex;
+    llvm::DenseSet<BlobEntry*> _entries;
+};
+
+//
+// Owned resources
+//
+
+// Creates base content of `type` from `size` raw bytes which are written by `fill` directly into the final storage.
+// Content smaller than OWNED_RESOURCE_MIN_SIZE is uniqued as DenseElementsAttr, larger content is kept in an owned
+// resource blob
+mlir::ElementsAttr createOwnedContent(mlir::ShapedType type, size_t size, FuncRef<void(MutableArrayRef<char>)> fill);
+
+// Returns true if `content` is stored in a resource blob created by createOwnedContent
+bool isOwnedContent(mlir::ElementsAttr content);
+
+// Releases the owned resource blobs which are not referenced by any operation nested in `root`.
+// Must only be called on the top-level operation, since constants outside of it are not taken into account
+Byte releaseUnusedResources(mlir::Operation* root);
+
+}  // namespace Const
+}  // namespace vpux
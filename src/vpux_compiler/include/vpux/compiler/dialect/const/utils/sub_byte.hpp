@@ -6,6 +6,7 @@
 #pragma once
 
 #include "vpux/utils/IE/format.hpp"
+#include "vpux/utils/core/array_ref.hpp"
 #include "vpux/utils/core/error.hpp"
 #include "vpux/utils/core/numeric.hpp"
 #include "vpux/utils/core/small_vector.hpp"
@@ -23,5 +24,14 @@ bool isSubByte(const size_t bitWidth);
 
 SmallVector<char> getConstBuffer(const char* sourceData, const size_t bitWidth, const int64_t numElems);
 
+// Number of bytes occupied by `numElems` sub-byte elements packed together, e.g. two 4-bit elements per byte
+int64_t getPackedSize(const size_t bitWidth, const int64_t numElems);
+
+// Unpacks `targetData.size()` sub-byte elements into individual bytes, in the same way as `getConstBuffer`
+void unpackSubByte(ArrayRef<char> packedData, const size_t bitWidth, MutableArrayRef<char> targetData);
+
+// Returns true if all `numElems` packed sub-byte elements have the same value
+bool isSubByteSplat(ArrayRef<char> packedData, const size_t bitWidth, const int64_t numElems);
+
 }  // namespace Const
 }  // namespace vpux
@@ -18,6 +18,15 @@ namespace details {
 vpux::Const::Content memPermuteTransformation(vpux::Const::Content& input, vpux::NDTypeInterface outType,
                                               mlir::AffineMap memPerm);
 
+//
+// applyTransformations
+//
+
+// Applies the transformations in order over the input content. Consecutive transformations which can be evaluated
+// together are fused into a single pass over the data, the others are applied one by one
+vpux::Const::Content applyTransformations(vpux::Const::Content input,
+                                          ArrayRef<vpux::Const::TransformAttrInterface> transformations);
+
 }  // namespace details
 }  // namespace Const
 }  // namespace vpux
@@ -25,6 +25,14 @@ public:
     virtual void buildELFPipeline(mlir::PassManager& pm, const intel_npu::Config& config, mlir::TimingScope& rootTiming,
                                   Logger log) = 0;
 
+    /*
+     *  Tells whether the ELF pipeline built for `config` may fail with WlmRollbackException, only then the module has
+     *  to be checkpointed to re-run the ELF pipeline with the safe options
+     */
+    virtual bool mayRequireWlmRollback(const intel_npu::Config& /*config*/) {
+        return false;
+    }
+
     virtual ~IPipelineStrategy() = default;
 };
 
@@ -0,0 +1,109 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#pragma once
+
+#include "vpux/utils/core/array_ref.hpp"
+
+#include <llvm/Support/raw_ostream.h>
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace vpux {
+namespace ELF {
+
+//
+// BlobSink
+//
+// Destination of an exported ELF image. The exporter announces the total size of the image with `begin`, hands the
+// image over in file order as a sequence of `write` calls and closes the transfer with `finalize`. Errors are reported
+// with exceptions.
+//
+
+class BlobSink {
+public:
+    static constexpr size_t DEFAULT_CHUNK_SIZE = 4 * 1024 * 1024;
+
+public:
+    virtual ~BlobSink() = default;
+
+    virtual void begin(size_t /*totalSize*/) {
+    }
+    virtual void write(ArrayRef<uint8_t> chunk) = 0;
+    virtual void finalize() {
+    }
+
+    /*
+     *  Maximal size of the chunks passed to `write`
+     */
+    virtual size_t getChunkSize() const {
+        return DEFAULT_CHUNK_SIZE;
+    }
+};
+
+/*
+ *  Hands the whole blob over to the sink, split into chunks of `sink.getChunkSize()` bytes
+ */
+void streamToSink(ArrayRef<uint8_t> blob, BlobSink& sink);
+
+//
+// VectorBlobSink
+//
+
+class VectorBlobSink final : public BlobSink {
+public:
+    explicit VectorBlobSink(std::vector<uint8_t>& storage);
+
+public:
+    void begin(size_t totalSize) override;
+    void write(ArrayRef<uint8_t> chunk) override;
+
+private:
+    std::vector<uint8_t>& _storage;
+};
+
+//
+// RawOstreamBlobSink
+//
+
+class RawOstreamBlobSink final : public BlobSink {
+public:
+    explicit RawOstreamBlobSink(llvm::raw_ostream& stream);
+
+public:
+    void write(ArrayRef<uint8_t> chunk) override;
+    void finalize() override;
+
+private:
+    llvm::raw_ostream& _stream;
+};
+
+//
+// CallbackBlobSink
+//
+
+class CallbackBlobSink final : public BlobSink {
+public:
+    using Callback = std::function<void(ArrayRef<uint8_t>)>;
+
+public:
+    explicit CallbackBlobSink(Callback callback, size_t chunkSize = DEFAULT_CHUNK_SIZE);
+
+public:
+    void write(ArrayRef<uint8_t> chunk) override;
+
+    size_t getChunkSize() const override {
+        return _chunkSize;
+    }
+
+private:
+    Callback _callback;
+    size_t _chunkSize;
+};
+
+}  // namespace ELF
+}  // namespace vpux
@@ -13,13 +13,15 @@
 namespace vpux {
 class BitCompactorCodec final : public ICodec {
 public:
-    BitCompactorCodec(VPU::ArchKind arch_kind);
+    // `parallel_for` spreads the blocks of one buffer over the threads of the caller, the output does not depend on it
+    BitCompactorCodec(VPU::ArchKind arch_kind, ParallelFor parallel_for = nullptr);
     bool supportsFP16compression() const override;
     mlir::FailureOr<std::vector<uint8_t>> compress(std::vector<uint8_t>& data, const CompressionMode mode,
                                                    const Logger& _log) const override;
 
 private:
     vpux::bitc::ArchType arch_type_;
+    ParallelFor parallel_for_;
 };
 
 }  // namespace vpux
@@ -7,6 +7,7 @@
 
 #include "vpux/compiler/dialect/VPU/IR/attributes.hpp"
 
+#include <functional>
 #include <memory>
 #include <vector>
 
@@ -16,6 +17,8 @@ class ICodec {
 public:
     enum CompressionAlgorithm { HUFFMAN_CODEC, BITCOMPACTOR_CODEC };
     enum class CompressionMode { UINT8, FP16 };
+    // Runs task(0) ... task(numTasks - 1), possibly concurrently, and returns once all of them are done
+    using ParallelFor = std::function<void(size_t numTasks, const std::function<void(size_t)>& task)>;
     virtual bool supportsFP16compression() const;
     virtual mlir::FailureOr<std::vector<uint8_t>> compress(std::vector<uint8_t>& data,
                                                            CompressionMode mode = CompressionMode::UINT8,
@@ -25,5 +28,7 @@ public:
     static std::string compressionModeToStr(ICodec::CompressionMode mode);
 };
 
-std::unique_ptr<ICodec> makeCodec(const ICodec::CompressionAlgorithm algo, VPU::ArchKind arch = VPU::ArchKind::UNKNOWN);
+// `parallelFor` lets a codec split the compression of one buffer into parallel tasks, if it supports that
+std::unique_ptr<ICodec> makeCodec(const ICodec::CompressionAlgorithm algo, VPU::ArchKind arch = VPU::ArchKind::UNKNOWN,
+                                  ICodec::ParallelFor parallelFor = nullptr);
 }  // namespace vpux
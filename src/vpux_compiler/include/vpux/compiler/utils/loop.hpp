@@ -27,4 +27,9 @@ void loop_3d(LoopExecPolicy policy, mlir::MLIRContext* ctx, int64_t dim0, int64_
 
 void loop_4d(LoopExecPolicy policy, mlir::MLIRContext* ctx, int64_t dim0, int64_t dim1, int64_t dim2, int64_t dim3,
              FuncRef<void(int64_t, int64_t, int64_t, int64_t)> func);
+
+// Splits the [0, size) range into contiguous chunks of at least `minChunkSize` elements and calls `func(begin, end)`
+// for each of them. Ranges which are too small to be split are processed by a single call on the calling thread
+void loop_chunked(LoopExecPolicy policy, mlir::MLIRContext* ctx, int64_t size, int64_t minChunkSize,
+                  FuncRef<void(int64_t, int64_t)> func);
 }  // namespace vpux
@@ -0,0 +1,100 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#pragma once
+
+#include "vpux/utils/core/logger.hpp"
+#include "vpux/utils/core/string_ref.hpp"
+
+#include <mlir/Pass/PassManager.h>
+
+#include <llvm/Support/raw_ostream.h>
+
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace vpux {
+
+//
+// PassFlightRecorder
+//
+// Records the cost of every pass run by the pass managers it is attached to: wall and CPU time, resident memory before
+// and after the pass, peak resident memory, number of operations in the pass anchor before and after the pass and the
+// number of constant folds and folding cache hits done while the pass was running.
+//
+// The report is a Chrome trace (chrome://tracing, Perfetto), with one complete event per pass run. It is extended with
+// a per-pass summary sorted by wall time.
+//
+// The CPU time, the memory usage and the folding counters are process-wide: for passes running in parallel on
+// different operations, they also account for the work done by the other threads.
+//
+
+class PassFlightRecorder final {
+public:
+    struct Record {
+        std::string pipelineName;
+        std::string passName;
+        std::string passArgument;
+        std::string anchorName;
+        uint64_t threadId = 0;
+        bool failed = false;
+
+        // Relative to the creation of the recorder
+        std::chrono::microseconds startTime{0};
+        std::chrono::microseconds wallTime{0};
+        std::chrono::microseconds cpuTime{0};
+
+        int64_t rssBeforeKB = 0;
+        int64_t rssAfterKB = 0;
+        int64_t peakRssKB = 0;
+
+        size_t numOpsBefore = 0;
+        size_t numOpsAfter = 0;
+
+        uint64_t numConstFolds = 0;
+        uint64_t numConstFoldCacheHits = 0;
+
+        // Pipeline adaptors, which run nested pass pipelines, are kept in the trace but not in the summary
+        bool isNestedPipeline() const {
+            return passArgument.empty();
+        }
+    };
+
+public:
+    explicit PassFlightRecorder(Logger log = Logger::global());
+
+public:
+    /*
+     *  Adds an instrumentation recording the passes run by `pm`, the recorder must outlive the pass runs
+     */
+    void attach(mlir::PassManager& pm, StringRef pipelineName);
+
+    void addRecord(Record record);
+    std::vector<Record> getRecords() const;
+
+public:
+    void printReport(llvm::raw_ostream& os) const;
+
+    /*
+     *  Writes the report to a file, failures are reported as warnings, since the report must not break the compilation
+     */
+    void writeReport(StringRef filePath) const;
+
+    std::chrono::steady_clock::time_point getStartTime() const {
+        return _startTime;
+    }
+
+private:
+    Logger _log;
+    std::chrono::steady_clock::time_point _startTime;
+
+    mutable std::mutex _mutex;
+    std::vector<Record> _records;
+};
+
+}  // namespace vpux
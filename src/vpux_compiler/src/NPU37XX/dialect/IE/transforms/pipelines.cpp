@@ -276,6 +276,7 @@ void vpux::IE::arch37xx::buildDefaultHWPipeline(mlir::OpPassManager& pm, const I
     if (options.enableFunctionOutlining) {
         pm.addPass(mlir::createCanonicalizerPass(grc));
         pm.addPass(IE::createOutlinerPass(options.functionOutliningMode, log));
+        pm.addPass(createMergeIdenticalFunctionsPass(log));
     }
 
     pm.addPass(mlir::createCanonicalizerPass(grc));
@@ -117,6 +117,10 @@ void vpux::VPUIP::arch37xx::buildDefaultHWPipeline(mlir::OpPassManager& pm,
 
     pm.addPass(VPUIP::createSwizzlingPass(options.enableWeightsSwizzling, options.enableActivationSwizzling, log));
 
+    if (options.enableFunctionOutlining) {
+        // Functions which became identical after the lowering are compiled once from now on
+        pm.addPass(createMergeIdenticalFunctionsPass(log));
+    }
     // Note: this pass introduces necessary VPUIP.Copy operations, thus, it must
     // be called *after* all copy optimizations are run (to ensure the
     // introduced copies are not optimized out).
@@ -214,6 +218,7 @@ void vpux::VPUIP::arch37xx::buildDefaultHWPipeline(mlir::OpPassManager& pm,
 
     if (options.enableCompressWeightsBTC) {
         pm.addPass(VPUIP::createCompressWeightsBTCPass(log));
+        pm.addPass(Const::createReleaseUnusedResourcesPass(log));
     }
 
     if (options.enableProfiling) {
@@ -228,6 +233,7 @@ void vpux::VPUIP::arch37xx::buildDefaultHWPipeline(mlir::OpPassManager& pm,
     pm.addPass(VPURT::createBarrierSimulationPass(log));
     pm.addPass(mlir::createCanonicalizerPass(grc));
     pm.nest<mlir::func::FuncOp>().addNestedPass<Const::DeclareOp>(Const::createConstantFoldingPass());
+    pm.addPass(Const::createReleaseUnusedResourcesPass(log));
 
     // TODO: #-120399 This is a temporary solution to remove strides from const.declare operations. Ideally,
     // this would be done by a custom canonicalizer by matching the different dialect's subview operations
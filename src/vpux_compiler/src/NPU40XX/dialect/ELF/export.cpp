@@ -7,24 +7,201 @@
 #include "vpux/compiler/NPU40XX/dialect/ELF/metadata.hpp"
 #include "vpux/compiler/dialect/ELFNPU37XX/metadata.hpp"
 #include "vpux/compiler/utils/ELF/utils.hpp"
+#include "vpux/utils/core/numeric.hpp"
+#include "vpux/utils/core/range.hpp"
 
+#include <vpux_elf/types/elf_header.hpp>
+#include <vpux_elf/types/section_header.hpp>
 #include <vpux_elf/writer.hpp>
 
+#include <mlir/IR/Threading.h>
+
+#include <algorithm>
+#include <cstring>
+#include <exception>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+
 using namespace vpux;
 
-std::vector<uint8_t> vpux::ELF::exportToELF(mlir::ModuleOp module,
-                                            const std::vector<std::shared_ptr<const ov::Node>>& parameters,
-                                            const std::vector<std::shared_ptr<const ov::Node>>& results, Logger log) {
-    log.setName("ELF BackEnd");
+namespace {
+
+// Upper bound of the memory used to serialize the deferred ops before they are handed over to the sink
+constexpr size_t MAX_DEFERRED_BATCH_SIZE = 64 * 1024 * 1024;
+// Minimal file alignment of the deferred sections content
+constexpr uint64_t DEFERRED_SECTION_FILE_ALIGNMENT = 64;
+
+void writeToSink(ArrayRef<uint8_t> data, ELF::BlobSink& sink) {
+    const auto chunkSize = sink.getChunkSize();
+    for (size_t offset = 0; offset < data.size(); offset += chunkSize) {
+        sink.write(data.slice(offset, std::min(chunkSize, data.size() - offset)));
+    }
+}
+
+void serializeDeferredOps(mlir::MLIRContext* ctx, ArrayRef<ELF::DeferredBinaryOp> deferredOps,
+                          MutableArrayRef<uint8_t> buffer) {
+    SmallVector<std::pair<ELF::BinaryOpInterface, MutableArrayRef<uint8_t>>> slices;
+    size_t offset = 0;
+    for (const auto& deferredOp : deferredOps) {
+        slices.emplace_back(deferredOp.op, buffer.slice(offset, deferredOp.size));
+        offset += deferredOp.size;
+    }
+
+    // Start with the largest buffers, so that the small ones balance the load at the end
+    llvm::stable_sort(slices, [](const auto& lhs, const auto& rhs) {
+        return lhs.second.size() > rhs.second.size();
+    });
+
+    // Each op writes its own slice of the buffer, exceptions are forwarded to the calling thread
+    std::mutex errorMutex;
+    std::exception_ptr error;
+    mlir::parallelForEach(ctx, slices, [&](const auto& slice) {
+        try {
+            auto binaryOp = slice.first;
+            binaryOp.serializeToBuffer(slice.second);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(errorMutex);
+            if (error == nullptr) {
+                error = std::current_exception();
+            }
+        }
+    });
+
+    if (error != nullptr) {
+        std::rethrow_exception(error);
+    }
+}
+
+// Serializes the ops of the section in batches of at most MAX_DEFERRED_BATCH_SIZE bytes (or a single larger op) and
+// hands each batch over to the sink
+void streamDeferredSection(mlir::MLIRContext* ctx, const ELF::DeferredSection& deferredSection,
+                           std::vector<uint8_t>& buffer, ELF::BlobSink& sink) {
+    ArrayRef<ELF::DeferredBinaryOp> ops = deferredSection.ops;
+    while (!ops.empty()) {
+        size_t batchOps = 0;
+        size_t batchSize = 0;
+        while (batchOps < ops.size() && (batchOps == 0 || batchSize + ops[batchOps].size <= MAX_DEFERRED_BATCH_SIZE)) {
+            batchSize += ops[batchOps].size;
+            ++batchOps;
+        }
+
+        buffer.resize(batchSize);
+        serializeDeferredOps(ctx, ops.take_front(batchOps), buffer);
+        writeToSink(buffer, sink);
+        ops = ops.drop_front(batchOps);
+    }
+}
+
+//
+// Streams the image laid out by the ELF writer, in which the deferred sections are empty, followed by the content of
+// the deferred sections. Only the headers of the writer image are patched to point at the appended content, so the
+// rest of the image is kept as is. Note that the deferred sections therefore come after the section header table,
+// which is part of the writer image.
+//
+void streamImage(mlir::MLIRContext* ctx, std::vector<uint8_t>& image, ArrayRef<ELF::DeferredSection> deferredSections,
+                 ELF::BlobSink& sink, Logger log) {
+    elf::ELFHeader elfHeader{};
+    VPUX_THROW_UNLESS(image.size() >= sizeof(elfHeader), "ELF image of {0} bytes is truncated", image.size());
+    std::memcpy(&elfHeader, image.data(), sizeof(elfHeader));
+
+    VPUX_THROW_UNLESS(elfHeader.e_shentsize == sizeof(elf::SectionHeader), "Unexpected ELF section header size {0}",
+                      elfHeader.e_shentsize);
+    VPUX_THROW_UNLESS(elfHeader.e_shoff + uint64_t{elfHeader.e_shnum} * sizeof(elf::SectionHeader) <= image.size(),
+                      "ELF section headers are out of the image bounds");
+    VPUX_THROW_UNLESS(elfHeader.e_shstrndx < elfHeader.e_shnum, "Invalid ELF section names index {0}",
+                      elfHeader.e_shstrndx);
+
+    const auto getHeaderOffset = [&](size_t index) {
+        return elfHeader.e_shoff + index * sizeof(elf::SectionHeader);
+    };
+    const auto readHeader = [&](size_t index) {
+        elf::SectionHeader header{};
+        std::memcpy(&header, image.data() + getHeaderOffset(index), sizeof(header));
+        return header;
+    };
+
+    const auto namesHeader = readHeader(elfHeader.e_shstrndx);
+    VPUX_THROW_UNLESS(namesHeader.sh_offset + namesHeader.sh_size <= image.size(),
+                      "ELF section names are out of the image bounds");
+    const auto names = StringRef(reinterpret_cast<const char*>(image.data() + namesHeader.sh_offset),
+                                 namesHeader.sh_size);
 
-    elf::Writer elfWriter;
+    std::unordered_map<std::string, size_t> deferredIndices;
+    for (const auto& deferredSection : deferredSections | indexed) {
+        deferredIndices.emplace(deferredSection.value().name, deferredSection.index());
+    }
+
+    SmallVector<std::optional<size_t>> headerIndices(deferredSections.size());
+    for (size_t index = 0; index < elfHeader.e_shnum; ++index) {
+        const auto header = readHeader(index);
+        if (header.sh_name >= names.size()) {
+            continue;
+        }
+        const auto name = names.substr(header.sh_name).take_until([](char c) {
+            return c == '\0';
+        });
+        const auto deferredIndex = deferredIndices.find(name.str());
+        if (deferredIndex == deferredIndices.end()) {
+            continue;
+        }
+
+        auto& headerIndex = headerIndices[deferredIndex->second];
+        VPUX_THROW_WHEN(headerIndex.has_value(), "ELF image has several sections named '{0}'", name);
+        VPUX_THROW_UNLESS(header.sh_size == 0, "Deferred ELF section '{0}' is expected to be empty in the writer image",
+                          name);
+        headerIndex = index;
+    }
+
+    // Place the content of the deferred sections one after another at the end of the image
+    SmallVector<uint64_t> contentOffsets;
+    uint64_t totalSize = image.size();
+    for (const auto& deferredSection : deferredSections | indexed) {
+        const auto& headerIndex = headerIndices[deferredSection.index()];
+        VPUX_THROW_UNLESS(headerIndex.has_value(), "ELF image has no section named '{0}'",
+                          deferredSection.value().name);
+
+        auto header = readHeader(headerIndex.value());
+        const auto alignment = std::max<uint64_t>(header.sh_addralign, DEFERRED_SECTION_FILE_ALIGNMENT);
+        totalSize = alignValUp(totalSize, alignment);
+        contentOffsets.push_back(totalSize);
+
+        header.sh_offset = totalSize;
+        header.sh_size = deferredSection.value().size;
+        std::memcpy(image.data() + getHeaderOffset(headerIndex.value()), &header, sizeof(header));
+
+        totalSize += deferredSection.value().size;
+    }
+
+    log.trace("Streaming {0} bytes of ELF blob, {1} of them in {2} deferred sections", totalSize,
+              totalSize - image.size(), deferredSections.size());
+
+    sink.begin(totalSize);
+    writeToSink(image, sink);
+
+    std::vector<uint8_t> buffer;
+    uint64_t offset = image.size();
+    for (const auto& deferredSection : deferredSections | indexed) {
+        const std::vector<uint8_t> padding(contentOffsets[deferredSection.index()] - offset, 0);
+        writeToSink(padding, sink);
+
+        streamDeferredSection(ctx, deferredSection.value(), buffer, sink);
+        offset = contentOffsets[deferredSection.index()] + deferredSection.value().size;
+    }
+    sink.finalize();
+}
+
+void serializeSections(elf::Writer& elfWriter, mlir::ModuleOp module,
+                       const std::vector<std::shared_ptr<const ov::Node>>& parameters,
+                       const std::vector<std::shared_ptr<const ov::Node>>& results,
+                       SmallVectorImpl<ELF::DeferredSection>& deferredSections, Logger log) {
     // Associate the respective mlir::Operation* of
     //   DataSectionOp/LogicalSectionOp/CreateSymbolSectionOp/CreateRelocationSectionOp
     //   with the respective created elf::writer::Section* for it.
-    SectionMapType sectionMap;
+    ELF::SectionMapType sectionMap;
     // Associate the respective mlir::Operation* of a SymbolOp with the newly created
     //   elf::writer::Symbol* for it.
-    SymbolMapType symbolMap;
+    ELF::SymbolMapType symbolMap;
 
     IE::CNNNetworkOp netOp;
     mlir::func::FuncOp netFunc;
@@ -53,10 +230,12 @@ std::vector<uint8_t> vpux::ELF::exportToELF(mlir::ModuleOp module,
         createProfSectionOp.serialize(elfWriter, sectionMap, symbolMap);
     }
 
+    // The sections made only of ops which do not depend on the section state, e.g. the constants, are left empty in
+    // the writer. Their content is serialized while the image is streamed
     log.trace("Serializing '{0}' ops", ELF::DataSectionOp::getOperationName());
     auto dataSectionOps = elfMain.getOps<ELF::DataSectionOp>();
     for (auto dataSectionOp : dataSectionOps) {
-        dataSectionOp.serialize(elfWriter, sectionMap, symbolMap, symRefMap);
+        dataSectionOp.serializeLayout(elfWriter, sectionMap, symbolMap, symRefMap, deferredSections);
     }
 
     log.trace("Serializing '{0}' ops", ELF::LogicalSectionOp::getOperationName());
@@ -76,6 +255,31 @@ std::vector<uint8_t> vpux::ELF::exportToELF(mlir::ModuleOp module,
     for (auto relocSectionOp : relocSectionOps) {
         relocSectionOp.serialize(elfWriter, sectionMap, symbolMap, symRefMap);
     }
+}
+
+}  // namespace
+
+std::vector<uint8_t> vpux::ELF::exportToELF(mlir::ModuleOp module,
+                                            const std::vector<std::shared_ptr<const ov::Node>>& parameters,
+                                            const std::vector<std::shared_ptr<const ov::Node>>& results, Logger log) {
+    std::vector<uint8_t> blob;
+    VectorBlobSink sink(blob);
+    exportToELF(module, sink, parameters, results, log);
+    return blob;
+}
+
+void vpux::ELF::exportToELF(mlir::ModuleOp module, BlobSink& sink,
+                            const std::vector<std::shared_ptr<const ov::Node>>& parameters,
+                            const std::vector<std::shared_ptr<const ov::Node>>& results, Logger log) {
+    log.setName("ELF BackEnd");
+
+    // The writer keeps its own copy of every section, release it as soon as the image is laid out
+    SmallVector<ELF::DeferredSection> deferredSections;
+    auto image = [&]() {
+        elf::Writer elfWriter;
+        serializeSections(elfWriter, module, parameters, results, deferredSections, log);
+        return elfWriter.generateELF();
+    }();
 
-    return elfWriter.generateELF();
+    streamImage(module.getContext(), image, deferredSections, sink, log);
 }
@@ -28,6 +28,35 @@ void ELF::DataSectionOp::serialize(elf::Writer& writer, ELF::SectionMapType& sec
     sectionMap[getOperation()] = section;
 }
 
+void ELF::DataSectionOp::serializeLayout(elf::Writer& writer, ELF::SectionMapType& sectionMap,
+                                         ELF::SymbolMapType& symbolMap, ELF::SymbolReferenceMap& symRefMap,
+                                         SmallVectorImpl<ELF::DeferredSection>& deferredSections) {
+    auto binaryOps = getBody()->getOps<ELF::BinaryOpInterface>();
+    const auto isDeferrable = llvm::all_of(binaryOps, [](ELF::BinaryOpInterface binaryOp) {
+        return binaryOp.supportsBufferSerialization();
+    });
+    if (!isDeferrable) {
+        serialize(writer, sectionMap, symbolMap, symRefMap);
+        return;
+    }
+
+    const auto name = getSymName().str();
+    auto section = writer.addBinaryDataSection<uint8_t>(name, static_cast<uint32_t>(getSecType()));
+    section->maskFlags(static_cast<elf::Elf_Xword>(getSecFlags()));
+    section->setAddrAlign(getSecAddrAlign());
+
+    // The section stays empty in the writer, the exporter places the content and fixes up the section header
+    ELF::DeferredSection deferredSection{name, {}, 0};
+    for (auto binaryOp : binaryOps) {
+        const auto size = binaryOp.getBinarySizeCached(symRefMap);
+        deferredSection.ops.push_back({binaryOp, size});
+        deferredSection.size += size;
+    }
+    deferredSections.push_back(std::move(deferredSection));
+
+    sectionMap[getOperation()] = section;
+}
+
 ELF::SymbolSignature ELF::DataSectionOp::getSymbolSignature() {
     auto symName = ELF::SymbolOp::getDefaultNamePrefix() + getSymName();
     return {mlir::SymbolRefAttr::get(getSymNameAttr()), symName.str(), ELF::SymbolType::STT_SECTION};
@@ -8,6 +8,8 @@
 #include "vpux/compiler/dialect/VPURT/IR/ops.hpp"
 #include "vpux/compiler/utils/ELF/utils.hpp"
 
+#include <algorithm>
+
 void vpux::ELF::PadOp::serialize(elf::writer::BinaryDataSection<uint8_t>& binDataSection) {
     auto padSize = getPaddingSize();
 
@@ -21,3 +23,14 @@ void vpux::ELF::PadOp::serialize(elf::writer::BinaryDataSection<uint8_t>& binDat
 size_t vpux::ELF::PadOp::getBinarySize() {
     return getPaddingSize();
 }
+
+bool vpux::ELF::PadOp::supportsBufferSerialization() {
+    return true;
+}
+
+void vpux::ELF::PadOp::serializeToBuffer(MutableArrayRef<uint8_t> buffer) {
+    VPUX_THROW_UNLESS(buffer.size() == getPaddingSize(), "Buffer size {0} does not match the padding size {1}",
+                      buffer.size(), getPaddingSize());
+
+    std::fill(buffer.begin(), buffer.end(), getPaddingValue().value_or(0));
+}
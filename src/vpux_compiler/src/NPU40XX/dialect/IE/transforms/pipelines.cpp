@@ -31,6 +31,7 @@ void vpux::IE::arch40xx::buildDefaultHWPipeline(mlir::OpPassManager& pm, const I
         } else {
             pm.addPass(IE::createOutlinerPass(options.functionOutliningMode, log));
         }
+        pm.addPass(createMergeIdenticalFunctionsPass(log));
     }
 
     pm.addPass(mlir::createCanonicalizerPass(grc));
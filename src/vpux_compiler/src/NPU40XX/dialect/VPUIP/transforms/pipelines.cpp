@@ -109,6 +109,10 @@ void vpux::VPUIP::arch40xx::buildDefaultHWPipeline(mlir::OpPassManager& pm,
 
     pm.addPass(VPUIP::createSwizzlingPass(options.enableWeightsSwizzling, options.enableActivationSwizzling, log));
 
+    if (options.enableFunctionOutlining) {
+        // Functions which became identical after the lowering are compiled once from now on
+        pm.addPass(createMergeIdenticalFunctionsPass(log));
+    }
     // Note: this pass introduces necessary VPUIP.Copy operations, thus, it must
     // be called *after* all copy optimizations are run (to ensure the
     // introduced copies are not optimized out).
@@ -185,6 +189,7 @@ void vpux::VPUIP::arch40xx::buildDefaultHWPipeline(mlir::OpPassManager& pm,
 
     if (options.enableCompressWeightsBTC) {
         pm.addPass(VPUIP::createCompressWeightsBTCPass(log));
+        pm.addPass(Const::createReleaseUnusedResourcesPass(log));
     }
 
     pm.addPass(VPUIP::arch40xx::createSplitDMAToBalanceLoadPass(log));
@@ -258,6 +263,7 @@ void vpux::VPUIP::arch40xx::buildDefaultHWPipeline(mlir::OpPassManager& pm,
     pm.addPass(VPURT::createBarrierSimulationPass(log));
     pm.addPass(mlir::createCanonicalizerPass(grc));
     pm.nest<mlir::func::FuncOp>().addNestedPass<Const::DeclareOp>(Const::createConstantFoldingPass());
+    pm.addPass(Const::createReleaseUnusedResourcesPass(log));
 
     if (options.enableActivityFactor || options.enableScheduleTrace) {
         pm.addPass(VPURT::createInferenceExecutionAnalysisPass(options.scheduleTraceFile, options.enableScheduleTrace,
@@ -59,6 +59,26 @@ void setupPWLMCompilationParams(int optimizationLevel, BackendCompilationOptions
     }
 }
 
+std::unique_ptr<BackendCompilationOptions40XX> getELFBackendCompilationOptions(const intel_npu::Config& config,
+                                                                               VPU::DPUDryRunMode& dpuDryRunMode) {
+    const auto compilationMode = getCompilationMode(config);
+    auto backendCompilationOptions =
+            BackendCompilationOptions40XX::createFromString(config.get<intel_npu::BACKEND_COMPILATION_PARAMS>());
+    VPUX_THROW_UNLESS(backendCompilationOptions != nullptr,
+                      "build ELF pipeline failed to parse BACKEND_COMPILATION_PARAMS: {0}",
+                      config.get<intel_npu::BACKEND_COMPILATION_PARAMS>());
+
+    if (compilationMode == VPU::CompilationMode::DefaultHW) {
+        const auto options = DefaultHWOptions40XX::createFromString(config.get<intel_npu::COMPILATION_MODE_PARAMS>());
+        VPUX_THROW_UNLESS(options != nullptr, "build ELF pipeline failed to parse COMPILATION_MODE_PARAMS: {0}",
+                          config.get<intel_npu::COMPILATION_MODE_PARAMS>());
+        setupPWLMCompilationParams(options->optimizationLevel, *backendCompilationOptions);
+        dpuDryRunMode = VPU::getDPUDryRunMode(options->dpuDryRun);
+        backendCompilationOptions->enableDMAProfiling = options->enableDMAProfiling.getValue();
+    }
+    return backendCompilationOptions;
+}
+
 }  // namespace
 
 void PipelineStrategy40XX::buildPipeline(mlir::PassManager& pm, const intel_npu::Config& config,
@@ -122,20 +142,13 @@ void PipelineStrategy40XX::buildELFPipeline(mlir::PassManager& pm, const intel_n
     auto buildTiming = rootTiming.nest("Build compilation pipeline");
 
     auto dpuDryRunMode = VPU::DPUDryRunMode::NONE;
-    const auto compilationMode = getCompilationMode(config);
-    auto backendCompilationOptions =
-            BackendCompilationOptions40XX::createFromString(config.get<intel_npu::BACKEND_COMPILATION_PARAMS>());
-    VPUX_THROW_UNLESS(backendCompilationOptions != nullptr,
-                      "build ELF pipeline failed to parse BACKEND_COMPILATION_PARAMS: {0}",
-                      config.get<intel_npu::BACKEND_COMPILATION_PARAMS>());
-
-    if (compilationMode == VPU::CompilationMode::DefaultHW) {
-        const auto options = DefaultHWOptions40XX::createFromString(config.get<intel_npu::COMPILATION_MODE_PARAMS>());
-        VPUX_THROW_UNLESS(options != nullptr, "build ELF pipeline failed to parse COMPILATION_MODE_PARAMS: {0}",
-                          config.get<intel_npu::COMPILATION_MODE_PARAMS>());
-        setupPWLMCompilationParams(options->optimizationLevel, *backendCompilationOptions);
-        dpuDryRunMode = VPU::getDPUDryRunMode(options->dpuDryRun);
-        backendCompilationOptions->enableDMAProfiling = options->enableDMAProfiling.getValue();
-    }
+    const auto backendCompilationOptions = getELFBackendCompilationOptions(config, dpuDryRunMode);
     arch40xx::buildLowerVPUIP2ELFPipeline(pm, *backendCompilationOptions, log.nest(), dpuDryRunMode);
 }
+
+bool PipelineStrategy40XX::mayRequireWlmRollback(const intel_npu::Config& config) {
+    // Only the partial workload management passes of the ELF pipeline throw WlmRollbackException
+    auto dpuDryRunMode = VPU::DPUDryRunMode::NONE;
+    const auto backendCompilationOptions = getELFBackendCompilationOptions(config, dpuDryRunMode);
+    return backendCompilationOptions->enablePartialWorkloadManagement;
+}
@@ -0,0 +1,131 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/compiler/act_kernels/shave_binary_bundle.h"
+
+#include "vpux/utils/core/error.hpp"
+
+#include <cstring>
+
+using namespace vpux;
+
+ShaveBinaryBundle::ShaveBinaryBundle(llvm::ArrayRef<uint8_t> data, llvm::StringRef origin)
+        : _data(data), _origin(origin.str()) {
+    ShaveBinaryBundleHeader header{};
+    VPUX_THROW_UNLESS(_data.size() >= sizeof(header), "SHAVE binary bundle '{0}' is truncated", _origin);
+    std::memcpy(&header, _data.data(), sizeof(header));
+
+    VPUX_THROW_UNLESS(std::memcmp(header.magic, SHAVE_BINARY_BUNDLE_MAGIC, sizeof(header.magic)) == 0,
+                      "'{0}' is not a SHAVE binary bundle", _origin);
+    VPUX_THROW_UNLESS(header.version == SHAVE_BINARY_BUNDLE_VERSION,
+                      "SHAVE binary bundle '{0}' has version {1}, but only version {2} is supported", _origin,
+                      header.version, SHAVE_BINARY_BUNDLE_VERSION);
+
+    const uint64_t directorySize = sizeof(header) + uint64_t{header.numEntries} * sizeof(ShaveBinaryBundleEntry);
+    VPUX_THROW_UNLESS(_data.size() >= directorySize, "SHAVE binary bundle '{0}' is truncated", _origin);
+    _numEntries = header.numEntries;
+
+    // Validate the whole directory once, so that the lookups do not need to check the offsets
+    const auto fits = [&](uint64_t offset, uint64_t size) {
+        return offset <= _data.size() && size <= _data.size() - offset;
+    };
+    for (size_t index = 0; index < _numEntries; ++index) {
+        const auto entry = getEntry(index);
+        VPUX_THROW_UNLESS(fits(entry.nameOffset, entry.nameSize) && fits(entry.dataOffset, entry.storedSize),
+                          "Entry #{0} of SHAVE binary bundle '{1}' is out of bounds", index, _origin);
+        VPUX_THROW_UNLESS(entry.compression <= static_cast<uint32_t>(ShaveBinaryCompression::Zstd),
+                          "Entry '{0}' of SHAVE binary bundle '{1}' has unknown compression {2}", getName(index),
+                          _origin, entry.compression);
+        VPUX_THROW_UNLESS(entry.compression != static_cast<uint32_t>(ShaveBinaryCompression::None) ||
+                                  entry.storedSize == entry.size,
+                          "Entry '{0}' of SHAVE binary bundle '{1}' has inconsistent size", getName(index), _origin);
+        VPUX_THROW_UNLESS(index == 0 || getName(index - 1) < getName(index),
+                          "Entries of SHAVE binary bundle '{0}' are not sorted", _origin);
+    }
+
+    _decompressed.resize(_numEntries);
+}
+
+std::unique_ptr<ShaveBinaryBundle> ShaveBinaryBundle::load(llvm::StringRef path) {
+    auto buffer = llvm::MemoryBuffer::getFile(path, /*IsText=*/false, /*RequiresNullTerminator=*/false);
+    VPUX_THROW_UNLESS(buffer, "Failed to open SHAVE binary bundle '{0}': {1}", path, buffer.getError().message());
+
+    const auto data = llvm::ArrayRef<uint8_t>(reinterpret_cast<const uint8_t*>((*buffer)->getBufferStart()),
+                                              (*buffer)->getBufferSize());
+    auto bundle = std::make_unique<ShaveBinaryBundle>(data, path);
+    bundle->_buffer = std::move(*buffer);
+    return bundle;
+}
+
+ShaveBinaryBundleEntry ShaveBinaryBundle::getEntry(size_t index) const {
+    ShaveBinaryBundleEntry entry{};
+    std::memcpy(&entry, _data.data() + sizeof(ShaveBinaryBundleHeader) + index * sizeof(entry), sizeof(entry));
+    return entry;
+}
+
+llvm::StringRef ShaveBinaryBundle::getName(size_t index) const {
+    const auto entry = getEntry(index);
+    return llvm::StringRef(reinterpret_cast<const char*>(_data.data() + entry.nameOffset), entry.nameSize);
+}
+
+llvm::ArrayRef<uint8_t> ShaveBinaryBundle::getStoredData(const ShaveBinaryBundleEntry& entry) const {
+    return _data.slice(entry.dataOffset, entry.storedSize);
+}
+
+std::optional<llvm::ArrayRef<uint8_t>> ShaveBinaryBundle::find(llvm::StringRef name) const {
+    size_t first = 0;
+    size_t last = _numEntries;
+    while (first < last) {
+        const auto middle = first + (last - first) / 2;
+        if (getName(middle) < name) {
+            first = middle + 1;
+        } else {
+            last = middle;
+        }
+    }
+
+    if (first == _numEntries || getName(first) != name) {
+        return std::nullopt;
+    }
+
+    const auto entry = getEntry(first);
+    if (entry.compression == static_cast<uint32_t>(ShaveBinaryCompression::None)) {
+        return getStoredData(entry);
+    }
+    return decompress(first);
+}
+
+llvm::ArrayRef<uint8_t> ShaveBinaryBundle::decompress(size_t index) const {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (const auto& cached = _decompressed[index]) {
+            return *cached;
+        }
+    }
+
+    // Decompress outside of the lock, so that lookups of other entries are not blocked. If several threads race for
+    // the same entry, the result of the first one is kept
+    const auto entry = getEntry(index);
+    const auto format = getCompressionFormat(static_cast<ShaveBinaryCompression>(entry.compression));
+    if (const auto reason = llvm::compression::getReasonIfUnsupported(*format)) {
+        VPUX_THROW("Can't decompress '{0}' from SHAVE binary bundle '{1}': {2}", getName(index), _origin, reason);
+    }
+
+    auto decompressed = std::make_unique<DecompressedData>();
+    if (auto error = llvm::compression::decompress(*format, getStoredData(entry), *decompressed, entry.size)) {
+        VPUX_THROW("Can't decompress '{0}' from SHAVE binary bundle '{1}': {2}", getName(index), _origin,
+                   llvm::toString(std::move(error)));
+    }
+    VPUX_THROW_UNLESS(decompressed->size() == entry.size,
+                      "Decompressed '{0}' from SHAVE binary bundle '{1}' has {2} bytes instead of {3}", getName(index),
+                      _origin, decompressed->size(), entry.size);
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    auto& cached = _decompressed[index];
+    if (cached == nullptr) {
+        cached = std::move(decompressed);
+    }
+    return *cached;
+}
@@ -0,0 +1,103 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/compiler/act_kernels/shave_binary_bundle_format.h"
+
+#include <llvm/ADT/ArrayRef.h>
+#include <llvm/ADT/STLExtras.h>
+#include <llvm/ADT/SmallVector.h>
+#include <llvm/Support/MathExtras.h>
+
+#include <algorithm>
+#include <cstring>
+
+using namespace vpux;
+
+std::string vpux::getShaveBinaryName(llvm::StringRef fileName) {
+    auto name = fileName.str();
+    std::replace_if(
+            name.begin(), name.end(),
+            [](char c) {
+                return c == '.' || c == ' ' || c == '-';
+            },
+            '_');
+    return name;
+}
+
+std::optional<llvm::compression::Format> vpux::getCompressionFormat(ShaveBinaryCompression compression) {
+    switch (compression) {
+    case ShaveBinaryCompression::Zlib:
+        return llvm::compression::Format::Zlib;
+    case ShaveBinaryCompression::Zstd:
+        return llvm::compression::Format::Zstd;
+    default:
+        return std::nullopt;
+    }
+}
+
+llvm::Expected<std::vector<uint8_t>> vpux::packShaveBinaryBundle(std::vector<ShaveBinary> binaries,
+                                                                 std::optional<llvm::compression::Format> format) {
+    if (format.has_value()) {
+        if (const auto reason = llvm::compression::getReasonIfUnsupported(*format)) {
+            return llvm::createStringError(llvm::inconvertibleErrorCode(), reason);
+        }
+    }
+
+    llvm::sort(binaries, [](const ShaveBinary& lhs, const ShaveBinary& rhs) {
+        return lhs.name < rhs.name;
+    });
+    const auto duplicate = std::adjacent_find(binaries.begin(), binaries.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.name == rhs.name;
+    });
+    if (duplicate != binaries.end()) {
+        return llvm::createStringError(llvm::inconvertibleErrorCode(), "Duplicate SHAVE binary '%s'",
+                                       duplicate->name.c_str());
+    }
+
+    std::vector<ShaveBinaryBundleEntry> entries(binaries.size());
+    const auto namesOffset = sizeof(ShaveBinaryBundleHeader) + entries.size() * sizeof(ShaveBinaryBundleEntry);
+
+    std::string names;
+    for (auto [entry, binary] : llvm::zip(entries, binaries)) {
+        entry.nameOffset = namesOffset + names.size();
+        entry.nameSize = static_cast<uint32_t>(binary.name.size());
+        names += binary.name;
+    }
+
+    std::vector<uint8_t> bundle(llvm::alignTo(namesOffset + names.size(), SHAVE_BINARY_BUNDLE_ALIGNMENT));
+    std::memcpy(bundle.data() + namesOffset, names.data(), names.size());
+
+    llvm::SmallVector<uint8_t> compressed;
+    for (auto [entry, binary] : llvm::zip(entries, binaries)) {
+        llvm::ArrayRef<uint8_t> stored = binary.data;
+        entry.compression = static_cast<uint32_t>(ShaveBinaryCompression::None);
+
+        if (format.has_value()) {
+            compressed.clear();
+            llvm::compression::compress(*format, binary.data, compressed);
+            if (compressed.size() < binary.data.size()) {
+                stored = compressed;
+                entry.compression = static_cast<uint32_t>(*format == llvm::compression::Format::Zstd
+                                                                  ? ShaveBinaryCompression::Zstd
+                                                                  : ShaveBinaryCompression::Zlib);
+            }
+        }
+
+        entry.dataOffset = bundle.size();
+        entry.storedSize = stored.size();
+        entry.size = binary.data.size();
+        bundle.insert(bundle.end(), stored.begin(), stored.end());
+        bundle.resize(llvm::alignTo(bundle.size(), SHAVE_BINARY_BUNDLE_ALIGNMENT));
+    }
+
+    ShaveBinaryBundleHeader header{};
+    std::memcpy(header.magic, SHAVE_BINARY_BUNDLE_MAGIC, sizeof(header.magic));
+    header.version = SHAVE_BINARY_BUNDLE_VERSION;
+    header.numEntries = static_cast<uint32_t>(entries.size());
+
+    std::memcpy(bundle.data(), &header, sizeof(header));
+    std::memcpy(bundle.data() + sizeof(header), entries.data(), entries.size() * sizeof(ShaveBinaryBundleEntry));
+    return bundle;
+}
@@ -4,24 +4,56 @@
 //
 
 #include "vpux/compiler/act_kernels/shave_binary_resources.h"
+#include "vpux/utils/core/env.hpp"
+
+#include <llvm/ADT/SmallVector.h>
+#include <llvm/Support/Program.h>
 
 #include <string>
-#include <unordered_map>
 #include <utility>
 
+namespace vpux {
+
+// Generated by vpux-shave-bundle from the kernels built in sw_runtime_kernels
+extern const uint8_t embeddedShaveBinaryBundle[];
+extern const size_t embeddedShaveBinaryBundleSize;
+
+}  // namespace vpux
+
 using namespace vpux;
 
+ShaveBinaryResources::ShaveBinaryResources() {
+    if (const auto paths = env::getEnvVar(SHAVE_BINARY_BUNDLE_ENV)) {
+        llvm::SmallVector<llvm::StringRef> splitPaths;
+        llvm::StringRef(paths.value()).split(splitPaths, llvm::sys::EnvPathSeparator, -1, /*KeepEmpty=*/false);
+        for (const auto path : splitPaths) {
+            _bundles.push_back(ShaveBinaryBundle::load(path));
+        }
+    }
+
+    _bundles.push_back(std::make_unique<ShaveBinaryBundle>(
+            llvm::ArrayRef<uint8_t>(embeddedShaveBinaryBundle, embeddedShaveBinaryBundleSize), "<embedded>"));
+}
+
 const ShaveBinaryResources& ShaveBinaryResources::getInstance() {
     static ShaveBinaryResources instance;
     return instance;
 }
 
+std::optional<llvm::ArrayRef<uint8_t>> ShaveBinaryResources::getBinary(llvm::StringRef symbolName) const {
+    for (const auto& bundle : _bundles) {
+        if (auto binary = bundle->find(symbolName)) {
+            return binary;
+        }
+    }
+    return std::nullopt;
+}
+
 llvm::ArrayRef<uint8_t> ShaveBinaryResources::getElf(llvm::StringRef kernelPath) const {
     auto symbolName = printToString("{0}_elf", kernelPath);
-    const auto it = shaveBinaryResourcesMap.find(symbolName);
+    const auto binary = getBinary(symbolName);
 
-    VPUX_THROW_UNLESS(it != shaveBinaryResourcesMap.end(), "Can't find 'elf' for kernel symbol '{0}'", symbolName);
+    VPUX_THROW_UNLESS(binary.has_value(), "Can't find 'elf' for kernel symbol '{0}'", symbolName);
 
-    const auto [symbolData, symbolSize] = it->second;
-    return llvm::ArrayRef<uint8_t>(symbolData, symbolSize);
+    return binary.value();
 }
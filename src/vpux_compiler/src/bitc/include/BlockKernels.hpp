@@ -0,0 +1,45 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include "commons.hpp"
+#include "vpux/compiler/bitc/bitc.hpp"
+
+namespace vpux::bitc {
+
+// Block kernels work on BLOCK_SIZE bytes, KernelType::SIMD uses SSE2 when it is available and plain loops otherwise
+
+struct BlockStatistics {
+    uint8_t minimum;
+    int8_t signed_minimum;
+    int32_t signed_sum;
+    uint8_t median;  // (BLOCK_SIZE / 2)-th smallest unsigned value
+};
+
+// residual[i] = data[i] - base[i] (modulo 256), optionally converted to unsigned by moving the sign to the LSB
+struct Predictor {
+    const uint8_t* base_block;  // nullptr to use base_value for every element
+    uint8_t base_value;
+    bool to_unsigned;
+    uint8_t* residual;
+};
+
+struct PredictorScore {
+    // OR of all residuals, it has the same bit width as the largest one
+    uint8_t residual_bits;
+    // Bit i of fit_masks[k] is set if residual i fits into k bits
+    std::array<uint64_t, 9> fit_masks;
+};
+
+BlockStatistics get_block_statistics(const uint8_t* data, KernelType kernel_type);
+
+// Computes the residuals and scores of all predictors in one pass over the block
+void predict_block(const uint8_t* data, const Predictor* predictors, PredictorScore* scores, size_t count,
+                   KernelType kernel_type);
+
+}  // namespace vpux::bitc
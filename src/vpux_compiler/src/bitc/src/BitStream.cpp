@@ -28,18 +28,30 @@ void BitStream::allocate_bits(const uint32_t& bits) {
     array_bytes_ = array_words_ << 3;
 }
 
+// Copies whole words, shifted to the current bit position, only the tail of the stream goes through write()
 void BitStream::append(const BitStream& stream) {
-    int32_t bits{static_cast<int32_t>(stream.get_bit_count())};
-    uint64_t stream_bits{};
-    uint32_t bit_start{};
-
-    while (bits > 0) {
-        auto add_bits{bits >= 64 ? 64 : bits};
-        stream.read(bit_start, stream_bits);
+    const auto bits{stream.get_bit_count()};
+    const auto words{bits >> 6};
+    const auto start_word{bit_position_ >> 6};
+    const auto bs{bit_position_ - (start_word << 6)};
+
+    assert(start_word + words < array_words_ || words == 0u);
+
+    if (bs == 0u) {
+        std::memcpy(reinterpret_cast<void*>(bit_array_.data() + start_word),
+                    reinterpret_cast<const void*>(stream.bit_array_.data()), words << 3);
+    } else {
+        for (uint32_t word{}; word < words; ++word) {
+            const auto stream_bits{stream.bit_array_[word]};
+            bit_array_[start_word + word] |= stream_bits << bs;
+            bit_array_[start_word + word + 1u] |= stream_bits >> (64 - bs);
+        }
+    }
+    bit_position_ += words << 6;
 
-        write(stream_bits, static_cast<uint32_t>(add_bits));
-        bits -= add_bits;
-        bit_start += static_cast<uint32_t>(add_bits);
+    const auto tail_bits{bits - (words << 6)};
+    if (tail_bits) {
+        write(stream.bit_array_[words], tail_bits);
     }
 }
 
@@ -0,0 +1,218 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "BlockKernels.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define __BITC_SSE2_KERNELS__
+#include <emmintrin.h>
+#endif
+
+using namespace vpux::bitc;
+
+namespace {
+
+const size_t MAX_PREDICTORS{static_cast<size_t>(EncoderAlgorithm::ALGO_COUNT)};
+const uint32_t FIT_MASKS{9u};
+
+uint8_t get_median(const uint8_t* data) {
+    std::array<uint8_t, BLOCK_SIZE> data_sorted;
+    std::copy(data, data + BLOCK_SIZE, data_sorted.begin());
+
+    const auto median{data_sorted.begin() + ((BLOCK_SIZE >> 1) - 1u)};
+    std::nth_element(data_sorted.begin(), median, data_sorted.end());
+    return *median;
+}
+
+void check_predictor_count(size_t count) {
+    if (count > MAX_PREDICTORS) {
+        throw std::invalid_argument{"(predict_block): Too many predictors"};
+    }
+}
+
+#ifdef __BITC_SSE2_KERNELS__
+
+const uint32_t LANES{BLOCK_SIZE / 16u};
+
+__m128i load_lane(const uint8_t* data, uint32_t lane) {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data) + lane);
+}
+
+uint8_t min_epu8(__m128i v) {
+    v = _mm_min_epu8(v, _mm_srli_si128(v, 8));
+    v = _mm_min_epu8(v, _mm_srli_si128(v, 4));
+    v = _mm_min_epu8(v, _mm_srli_si128(v, 2));
+    v = _mm_min_epu8(v, _mm_srli_si128(v, 1));
+    return static_cast<uint8_t>(_mm_cvtsi128_si32(v));
+}
+
+uint8_t or_epu8(__m128i v) {
+    v = _mm_or_si128(v, _mm_srli_si128(v, 8));
+    v = _mm_or_si128(v, _mm_srli_si128(v, 4));
+    v = _mm_or_si128(v, _mm_srli_si128(v, 2));
+    v = _mm_or_si128(v, _mm_srli_si128(v, 1));
+    return static_cast<uint8_t>(_mm_cvtsi128_si32(v));
+}
+
+// (x << 1) ^ (x >> 7) with arithmetic shift, the same as ~x << 1 | 1 for negative x and x << 1 otherwise
+__m128i to_unsigned_epi8(__m128i v) {
+    const auto sign{_mm_cmpgt_epi8(_mm_setzero_si128(), v)};
+    return _mm_xor_si128(_mm_add_epi8(v, v), sign);
+}
+
+BlockStatistics get_block_statistics_sse2(const uint8_t* data) {
+    // Signed values are handled as unsigned ones with the sign bit flipped
+    const auto sign_bit{_mm_set1_epi8(static_cast<char>(0x80))};
+
+    auto minimum{load_lane(data, 0)};
+    auto signed_minimum{_mm_xor_si128(minimum, sign_bit)};
+    auto biased_sum{_mm_sad_epu8(signed_minimum, _mm_setzero_si128())};
+
+    for (uint32_t lane{1u}; lane < LANES; ++lane) {
+        const auto v{load_lane(data, lane)};
+        const auto biased{_mm_xor_si128(v, sign_bit)};
+        minimum = _mm_min_epu8(minimum, v);
+        signed_minimum = _mm_min_epu8(signed_minimum, biased);
+        biased_sum = _mm_add_epi64(biased_sum, _mm_sad_epu8(biased, _mm_setzero_si128()));
+    }
+
+    const auto sum{_mm_cvtsi128_si32(biased_sum) + _mm_cvtsi128_si32(_mm_srli_si128(biased_sum, 8))};
+
+    BlockStatistics stats{};
+    stats.minimum = min_epu8(minimum);
+    stats.signed_minimum = static_cast<int8_t>(min_epu8(signed_minimum) ^ 0x80u);
+    stats.signed_sum = sum - static_cast<int32_t>(BLOCK_SIZE * 128u);
+    stats.median = get_median(data);
+    return stats;
+}
+
+void predict_block_sse2(const uint8_t* data, const Predictor* predictors, PredictorScore* scores, size_t count) {
+    check_predictor_count(count);
+
+    __m128i residual_bits[MAX_PREDICTORS];
+    __m128i high_bits[FIT_MASKS - 1u];
+    for (uint32_t bits{}; bits < FIT_MASKS - 1u; ++bits) {
+        high_bits[bits] = _mm_set1_epi8(static_cast<char>(0xffu << bits));
+    }
+
+    for (size_t idx{}; idx < count; ++idx) {
+        residual_bits[idx] = _mm_setzero_si128();
+        scores[idx].fit_masks.fill(0ull);
+    }
+
+    for (uint32_t lane{}; lane < LANES; ++lane) {
+        const auto v{load_lane(data, lane)};
+
+        for (size_t idx{}; idx < count; ++idx) {
+            const auto& predictor{predictors[idx]};
+            auto& score{scores[idx]};
+
+            const auto base{predictor.base_block != nullptr ? load_lane(predictor.base_block, lane)
+                                                            : _mm_set1_epi8(static_cast<char>(predictor.base_value))};
+            auto residual{_mm_sub_epi8(v, base)};
+            if (predictor.to_unsigned) {
+                residual = to_unsigned_epi8(residual);
+            }
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(predictor.residual) + lane, residual);
+
+            residual_bits[idx] = _mm_or_si128(residual_bits[idx], residual);
+
+            for (uint32_t bits{}; bits < FIT_MASKS - 1u; ++bits) {
+                const auto fits{_mm_cmpeq_epi8(_mm_and_si128(residual, high_bits[bits]), _mm_setzero_si128())};
+                const auto mask{static_cast<uint64_t>(static_cast<uint32_t>(_mm_movemask_epi8(fits)))};
+                score.fit_masks[bits] |= mask << (lane * 16u);
+            }
+        }
+    }
+
+    for (size_t idx{}; idx < count; ++idx) {
+        scores[idx].residual_bits = or_epu8(residual_bits[idx]);
+        scores[idx].fit_masks[FIT_MASKS - 1u] = ~0ull;
+    }
+}
+
+#endif
+
+BlockStatistics get_block_statistics_scalar(const uint8_t* data) {
+    BlockStatistics stats{};
+    stats.minimum = 255;
+    stats.signed_minimum = 127;
+
+    for (uint32_t i{}; i < BLOCK_SIZE; ++i) {
+        const auto signed_value{static_cast<int8_t>(data[i])};
+        stats.minimum = std::min(stats.minimum, data[i]);
+        stats.signed_minimum = std::min(stats.signed_minimum, signed_value);
+        stats.signed_sum += signed_value;
+    }
+
+    stats.median = get_median(data);
+    return stats;
+}
+
+void predict_block_scalar(const uint8_t* data, const Predictor* predictors, PredictorScore* scores, size_t count) {
+    check_predictor_count(count);
+
+    static const auto bit_width = [] {
+        std::array<uint8_t, 256> widths{};
+        for (uint32_t value{1u}; value < widths.size(); ++value) {
+            widths[value] = widths[value >> 1] + 1u;
+        }
+        return widths;
+    }();
+
+    for (size_t idx{}; idx < count; ++idx) {
+        const auto& predictor{predictors[idx]};
+        auto& score{scores[idx]};
+        score.residual_bits = 0u;
+        score.fit_masks.fill(0ull);
+
+        for (uint32_t i{}; i < BLOCK_SIZE; ++i) {
+            const auto base{predictor.base_block != nullptr ? predictor.base_block[i] : predictor.base_value};
+            auto residual{static_cast<uint8_t>(data[i] - base)};
+            if (predictor.to_unsigned) {
+                const auto sign{static_cast<uint8_t>(residual & 0x80u ? 0xffu : 0u)};
+                residual = static_cast<uint8_t>((residual << 1) ^ sign);
+            }
+            predictor.residual[i] = residual;
+            score.residual_bits |= residual;
+
+            // Residuals of the exact bit width first, they fit into all the wider ones
+            score.fit_masks[bit_width[residual]] |= 1ull << i;
+        }
+
+        for (uint32_t bits{1u}; bits < FIT_MASKS; ++bits) {
+            score.fit_masks[bits] |= score.fit_masks[bits - 1u];
+        }
+    }
+}
+
+}  // namespace
+
+BlockStatistics vpux::bitc::get_block_statistics(const uint8_t* data, KernelType kernel_type) {
+#ifdef __BITC_SSE2_KERNELS__
+    if (kernel_type == KernelType::SIMD) {
+        return get_block_statistics_sse2(data);
+    }
+#else
+    static_cast<void>(kernel_type);
+#endif
+    return get_block_statistics_scalar(data);
+}
+
+void vpux::bitc::predict_block(const uint8_t* data, const Predictor* predictors, PredictorScore* scores, size_t count,
+                               KernelType kernel_type) {
+#ifdef __BITC_SSE2_KERNELS__
+    if (kernel_type == KernelType::SIMD) {
+        predict_block_sse2(data, predictors, scores, count);
+        return;
+    }
+#else
+    static_cast<void>(kernel_type);
+#endif
+    predict_block_scalar(data, predictors, scores, count);
+}
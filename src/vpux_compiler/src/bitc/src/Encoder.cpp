@@ -5,10 +5,13 @@
 
 #include "vpux/compiler/bitc/Encoder.hpp"
 
+#include "BlockKernels.hpp"
 #include "commons.hpp"
 
 #include <algorithm>
+#include <bitset>
 #include <cassert>
+#include <exception>
 #include <iostream>
 #include <memory>
 #include <stdexcept>
@@ -20,23 +23,14 @@ public:
     void encode(const BitCompactorConfig& config, const std::vector<uint8_t>& in, std::vector<uint8_t>& out);
 
 private:
-    typedef void (Encoder::Impl::*AlgorithmEncoder)(AlgorithmParam& param);
     void verify_config(const BitCompactorConfig& config);
     void fp16enprdct(const unsigned char* src, const unsigned int srcLen, unsigned char* dst, const unsigned BLKSIZE);
 
-    void binexpproc(AlgorithmParam& param);
-    void btexpproc(AlgorithmParam& param);
-    void muprdct(AlgorithmParam& param);
-    void minprdct(AlgorithmParam& param);
-    void minsprdct(AlgorithmParam& param);
-    void medprdct(AlgorithmParam& param);
-    void noprdct(AlgorithmParam& param);
-    void nosprdct(AlgorithmParam& param);
-    void dummyprdct(AlgorithmParam& param);
-    void prevblkprdct(AlgorithmParam& param);
-    void dual_encode(AlgorithmParam& param);
+    Predictor get_predictor(const BitCompactorConfig& config, uint32_t algo, const BlockStatistics& stats,
+                            uint8_t* p_input_block, AlgorithmParam& block_param);
+    bool is_algo_raw(const BitCompactorConfig& config, uint32_t algo);
+    void dual_encode(AlgorithmParam& param, const PredictorScore& score);
     void write_residual(const BitCompactorConfig& config, BitStream& stream, const AlgorithmParam& param);
-    uint32_t to_unsigned(int8_t* p_data, uint8_t* p_data_out, const uint32_t& block_size);
     void init(const BitCompactorConfig& config, const std::vector<uint8_t>& in);
     void fp16_preprocess(uint32_t input_bytes);
     void pack_sparse_data(const BitCompactorConfig& config);
@@ -58,6 +52,10 @@ private:
                               BestAlgorithm& best_algorithm);
     void write_uncompressed_blk(const BitCompactorConfig& config, int blk, std::vector<BitStream>& block_stream,
                                 std::vector<AlgorithmParam>& block_params);
+    void encode_blocks(const BitCompactorConfig& config, uint32_t first_blk, uint32_t last_blk,
+                       std::vector<BitStream>& block_stream, std::vector<AlgorithmParam>& block_params);
+    void encode_blocks_parallel(const BitCompactorConfig& config, uint32_t input_blocks,
+                                std::vector<BitStream>& block_stream, std::vector<AlgorithmParam>& block_params);
     void write_last_blk(uint32_t input_blocks, std::vector<BitStream>& block_stream, unsigned last_block_elements);
     void write_to_output(std::vector<uint8_t>& out, std::vector<BitStream>& block_stream);
     bool is_compression_better_than_uncompressed(BestAlgorithm& best_algorithm);
@@ -67,14 +65,18 @@ private:
     BitStream bit_stream_out_;
     uint32_t stream_bit_offset_in_{};
     uint32_t stream_bit_offset_out_{};
-    std::vector<AlgorithmEncoder> algorithm_encoder_;
     std::vector<uint8_t> log2_lut_;
-    std::vector<uint8_t> dual_log2_lut_;
-    static const std::map<uint32_t, DecoderAlgorithm> encoder_to_decoder_mapping_;
+    // Dual encoder symbols take at least this number of bits
+    uint32_t dual_min_bit_length_{};
+    static const std::array<DecoderAlgorithm, static_cast<uint32_t>(EncoderAlgorithm::ALGO_COUNT)>
+            encoder_to_decoder_mapping_;
     const std::array<uint32_t, static_cast<uint32_t>(EncoderAlgorithm::ALGO_COUNT)> algorithm_overhead_bits_{
             18u, 18u, 18u, 10u, 10u, 18u, 10u, 14u, 90u};
     uint32_t output_byte_alignment_{32u};
 
+    // Number of blocks encoded by one parallel task, smaller inputs are not worth splitting
+    static constexpr uint32_t BLOCKS_PER_TASK{1024u};
+
     static const uint8_t DUAL_CMPRS_PAD{4u};
     static const uint8_t CMPRS_PAD{6u};
 
@@ -99,12 +101,13 @@ Encoder::Impl::Impl() {
     init(BitCompactorConfig{}, std::vector<uint8_t>());
 }
 
-const std::map<uint32_t, DecoderAlgorithm> Encoder::Impl::encoder_to_decoder_mapping_{
-        {0, DecoderAlgorithm::ADDPROC},         {1, DecoderAlgorithm::SIGNSHFTADDPROC},
-        {2, DecoderAlgorithm::SIGNSHFTADDPROC}, {3, DecoderAlgorithm::NOPROC},
-        {4, DecoderAlgorithm::SIGNSHFTPROC},    {5, DecoderAlgorithm::SIGNSHFTADDPROC},
-        {6, DecoderAlgorithm::SIGNSHFTADDBLK},  // >= NPU40XX only
-        {7, DecoderAlgorithm::BINEXPPROC},      {8, DecoderAlgorithm::BTEXPPROC}};
+const std::array<DecoderAlgorithm, static_cast<uint32_t>(EncoderAlgorithm::ALGO_COUNT)>
+        Encoder::Impl::encoder_to_decoder_mapping_{
+                DecoderAlgorithm::ADDPROC,         DecoderAlgorithm::SIGNSHFTADDPROC,
+                DecoderAlgorithm::SIGNSHFTADDPROC, DecoderAlgorithm::NOPROC,
+                DecoderAlgorithm::SIGNSHFTPROC,    DecoderAlgorithm::SIGNSHFTADDPROC,
+                DecoderAlgorithm::SIGNSHFTADDBLK,  // >= NPU40XX only
+                DecoderAlgorithm::BINEXPPROC,      DecoderAlgorithm::BTEXPPROC};
 
 void Encoder::Impl::verify_config(const BitCompactorConfig& config) {
     if (config.arch_type == ArchType::NPU27) {
@@ -122,35 +125,13 @@ void Encoder::Impl::init(const BitCompactorConfig& config, const std::vector<uin
 
     verify_config(config);
 
-    algorithm_encoder_.resize(static_cast<uint32_t>(EncoderAlgorithm::ALGO_COUNT));
-    algorithm_encoder_[static_cast<uint32_t>(EncoderAlgorithm::MINPRDCT)] = &Encoder::Impl::minprdct;
-
-    if (config.weight_compress_enable) {
-        algorithm_encoder_[static_cast<uint32_t>(EncoderAlgorithm::MINSPRDCT)] = &Encoder::Impl::minsprdct;
-    } else {
-        algorithm_encoder_[static_cast<uint32_t>(EncoderAlgorithm::MINSPRDCT)] = &Encoder::Impl::dummyprdct;
-    }
-
-    algorithm_encoder_[static_cast<uint32_t>(EncoderAlgorithm::MUPRDCT)] = &Encoder::Impl::muprdct;
-    algorithm_encoder_[static_cast<uint32_t>(EncoderAlgorithm::MEDPRDCT)] = &Encoder::Impl::medprdct;
-    algorithm_encoder_[static_cast<uint32_t>(EncoderAlgorithm::NOPRDCT)] = &Encoder::Impl::noprdct;
-    algorithm_encoder_[static_cast<uint32_t>(EncoderAlgorithm::NOSPRDCT)] = &Encoder::Impl::nosprdct;
-    algorithm_encoder_[static_cast<uint32_t>(EncoderAlgorithm::PREVBLKPRDCT)] =
-            &Encoder::Impl::prevblkprdct;  // >= NPU40XX only
-    algorithm_encoder_[static_cast<uint32_t>(EncoderAlgorithm::BINCMPCT)] = &Encoder::Impl::binexpproc;
-    algorithm_encoder_[static_cast<uint32_t>(EncoderAlgorithm::BTMAP)] = &Encoder::Impl::btexpproc;
-
-    ALGORITHMS = static_cast<uint32_t>(algorithm_encoder_.size()) - (config.arch_type == ArchType::NPU27 ? 3u : 2u);
+    ALGORITHMS = static_cast<uint32_t>(EncoderAlgorithm::ALGO_COUNT) - (config.arch_type == ArchType::NPU27 ? 3u : 2u);
     MAX_BLOCK_COMPRESSION_BITS = (BLOCK_SIZE << 3) + (config.arch_type == ArchType::NPU27 ? 2u : 8u);
 
     log2_lut_.resize(256);
-    dual_log2_lut_.resize(256);
 
     uint32_t bits{2u};
-    uint32_t dual_bits{config.arch_type == ArchType::NPU27 ? 0u : 1u};
-
     uint32_t bit_mask{(1u << (bits + 1)) - 1u};
-    uint32_t dual_bit_mask{(1u << (dual_bits + 1)) - 1u};
 
     for (uint32_t lbyte{}; lbyte < 256; ++lbyte) {
         if (lbyte > bit_mask) {
@@ -159,14 +140,9 @@ void Encoder::Impl::init(const BitCompactorConfig& config, const std::vector<uin
         }
 
         log2_lut_[lbyte] = bits + 1;
-
-        if (lbyte > dual_bit_mask) {
-            dual_bits++;
-            dual_bit_mask = (1u << (dual_bits + 1)) - 1u;
-        }
-
-        dual_log2_lut_[lbyte] = dual_bits + 1;
     }
+
+    dual_min_bit_length_ = config.arch_type == ArchType::NPU27 ? 1u : 2u;
 }
 
 void Encoder::Impl::fp16enprdct(const unsigned char* src, const unsigned int srcLen, unsigned char* dst,
@@ -193,220 +169,78 @@ void Encoder::Impl::fp16enprdct(const unsigned char* src, const unsigned int src
     }
 }
 
-// No Preprocess
-// No Predict, just look at the maximum in the array
-void Encoder::Impl::noprdct(AlgorithmParam& param) {
-    param.bit_length = 1u;
-
-    for (uint32_t i{}; i < param.block_size; ++i) {
-        param.residual[i] = param.p_data[i];
-
-        const auto bits{log2_lut_[param.residual[i]]};
-
-        if (bits > param.bit_length) {
-            param.bit_length = bits;
-        }
-    }
-
-    param.encoding_bits = param.bit_length * param.block_size;
-}
-
-// No Sign Preprocess
-void Encoder::Impl::nosprdct(AlgorithmParam& param) {
-    param.bit_length = to_unsigned(reinterpret_cast<int8_t*>(param.p_data), param.residual, param.block_size);
-
-    param.encoding_bits = param.bit_length * param.block_size;
-}
-
-void Encoder::Impl::medprdct(AlgorithmParam& param) {
-    std::vector<uint8_t> data_sorted(param.block_size);
-
-    std::memcpy(reinterpret_cast<void*>(data_sorted.data()), reinterpret_cast<const void*>(param.p_data),
-                param.block_size);
+// Base of the residual and its conversion to unsigned for each algorithm, the block statistics are shared by them
+Predictor Encoder::Impl::get_predictor(const BitCompactorConfig& config, uint32_t algo, const BlockStatistics& stats,
+                                       uint8_t* p_input_block, AlgorithmParam& block_param) {
+    Predictor predictor{nullptr, 0u, false, block_param.residual};
 
-    std::sort(std::begin(data_sorted), std::end(data_sorted));
-
-    const auto med_indx{(param.block_size >> 1) - 1u};
-
-    param.minimum = data_sorted[med_indx];
-
-    auto p_data{reinterpret_cast<int8_t*>(param.p_data)};
-    auto p_residual{reinterpret_cast<int8_t*>(param.residual)};
-    auto& median{*reinterpret_cast<int8_t*>(&param.minimum)};
-
-    for (uint32_t i{}; i < param.block_size; ++i) {
-        p_residual[i] = p_data[i] - median;
-    }
-
-    param.bit_length = to_unsigned(p_residual, param.residual, param.block_size);
-    param.encoding_bits = param.bit_length * param.block_size;
-}
-
-// Do Min Signed Predict algo on a buffer, return minimum number and the bitln
-void Encoder::Impl::minsprdct(AlgorithmParam& param) {
-    auto p_data{reinterpret_cast<int8_t*>(param.p_data)};
-    auto p_residual{reinterpret_cast<int8_t*>(param.residual)};
-    auto& minimum{*reinterpret_cast<int8_t*>(&param.minimum)};
-
-    minimum = 127;
-
-    for (uint32_t i{}; i < param.block_size; ++i) {
-        if (p_data[i] < minimum) {
-            minimum = p_data[i];
-        }
-    }
-
-    for (uint32_t i{}; i < param.block_size; ++i) {
-        p_residual[i] = p_data[i] - minimum;
-    }
-
-    param.bit_length = to_unsigned(p_residual, param.residual, param.block_size);
-    param.encoding_bits = param.bit_length * param.block_size;
-}
-
-uint32_t Encoder::Impl::to_unsigned(int8_t* p_data, uint8_t* p_data_out, const uint32_t& block_size) {
-    uint8_t bit_length{1};
-
-    for (uint32_t i{}; i < block_size; ++i) {
-        if (p_data[i] < 0) {
-            p_data_out[i] = (static_cast<uint8_t>(~p_data[i] << 1) | 0x1);
-        } else {
-            p_data_out[i] = static_cast<uint8_t>(p_data[i] << 1);
-        }
-
-        const auto bits{log2_lut_[static_cast<uint8_t>(p_data_out[i])]};
-        if (bits > bit_length) {
-            bit_length = bits;
-        }
-    }
-
-    return static_cast<uint32_t>(bit_length);
-}
-
-// Mean Preprocess
-// Do Mean Signed Predict algo on a buffer, return minimum number and the bitln.
-void Encoder::Impl::muprdct(AlgorithmParam& param) {
-    auto p_data{reinterpret_cast<int8_t*>(param.p_data)};
-    auto p_residual{reinterpret_cast<int8_t*>(param.residual)};
-    int32_t mean{};
-
-    for (uint32_t i{}; i < param.block_size; ++i) {
-        mean += p_data[i];
-    }
-
-    double d_mean{static_cast<double>(mean) / static_cast<double>(param.block_size)};
-    mean = static_cast<int32_t>(std::round(d_mean));
-
-    auto& mu{*reinterpret_cast<int8_t*>(&param.minimum)};
-    mu = static_cast<int8_t>(mean);
-
-    for (uint32_t i{}; i < param.block_size; ++i) {
-        p_residual[i] = p_data[i] - mu;
-    }
-
-    param.bit_length = to_unsigned(p_residual, param.residual, param.block_size);
-    param.encoding_bits = param.bit_length * param.block_size;
-}
-
-// Min Preprocess
-// Do Min Predict algo on a buffer, return minimum number and the bitln.
-void Encoder::Impl::minprdct(AlgorithmParam& param) {
-    param.minimum = 255;
-
-    for (uint32_t i{}; i < param.block_size; ++i) {
-        if (param.p_data[i] < param.minimum) {
-            param.minimum = param.p_data[i];
+    switch (static_cast<EncoderAlgorithm>(algo)) {
+    case EncoderAlgorithm::MINPRDCT:
+        predictor.base_value = stats.minimum;
+        break;
+    case EncoderAlgorithm::MINSPRDCT:
+        if (config.weight_compress_enable) {
+            predictor.base_value = static_cast<uint8_t>(stats.signed_minimum);
+            predictor.to_unsigned = true;
         }
+        break;
+    case EncoderAlgorithm::MUPRDCT: {
+        const double mean{std::round(static_cast<double>(stats.signed_sum) / static_cast<double>(BLOCK_SIZE))};
+        predictor.base_value = static_cast<uint8_t>(static_cast<int8_t>(static_cast<int32_t>(mean)));
+        predictor.to_unsigned = true;
+        break;
     }
-
-    param.bit_length = 1u;
-
-    for (uint32_t i{}; i < param.block_size; ++i) {
-        param.residual[i] = param.p_data[i] - param.minimum;
-        const auto residual_bits{log2_lut_[param.residual[i]]};
-
-        if (residual_bits > param.bit_length) {
-            param.bit_length = residual_bits;
-        }
+    case EncoderAlgorithm::NOPRDCT:
+        break;
+    case EncoderAlgorithm::NOSPRDCT:
+        predictor.to_unsigned = true;
+        break;
+    case EncoderAlgorithm::MEDPRDCT:
+        predictor.base_value = stats.median;
+        predictor.to_unsigned = true;
+        break;
+    case EncoderAlgorithm::PREVBLKPRDCT:
+        predictor.base_block = p_input_block - BLOCK_SIZE;
+        predictor.to_unsigned = true;
+        break;
+    default:
+        // BINCMPCT and BTMAP keep the raw data
+        break;
     }
 
-    param.encoding_bits = param.block_size * param.bit_length;
+    block_param.minimum = predictor.base_value;
+    return predictor;
 }
 
-void Encoder::Impl::dummyprdct(AlgorithmParam& param) {
-    param.bit_length = 8u;
-
-    std::memcpy(reinterpret_cast<void*>(param.residual), reinterpret_cast<const void*>(param.p_data), param.block_size);
-
-    param.encoding_bits = param.block_size * param.bit_length;
-}
-void Encoder::Impl::prevblkprdct(AlgorithmParam& param) {
-    const uint8_t* prev_blk = param.p_data - param.block_size;
-
-    for (uint32_t i{}; i < param.block_size; ++i) {
-        param.residual[i] = param.p_data[i] - prev_blk[i];
-    }
-    param.bit_length = to_unsigned(reinterpret_cast<int8_t*>(param.residual), param.residual, param.block_size);
-    param.encoding_bits = param.bit_length * param.block_size;
-}
-void Encoder::Impl::binexpproc(AlgorithmParam& param) {
-    dummyprdct(param);
+// Algorithms which keep the raw data with 8 bits per element
+bool Encoder::Impl::is_algo_raw(const BitCompactorConfig& config, uint32_t algo) {
+    return (algo == static_cast<uint32_t>(EncoderAlgorithm::MINSPRDCT) && !config.weight_compress_enable) ||
+           algo == static_cast<uint32_t>(EncoderAlgorithm::BINCMPCT) ||
+           algo == static_cast<uint32_t>(EncoderAlgorithm::BTMAP);
 }
 
-void Encoder::Impl::btexpproc(AlgorithmParam& param) {
-    dummyprdct(param);
-}
+// Each symbol is encoded either with dual_bit_length or 8 bits, dual_bit_length is chosen to minimize the total size
+void Encoder::Impl::dual_encode(AlgorithmParam& param, const PredictorScore& score) {
+    const auto short_symbols = [&](uint32_t bit_length) {
+        return bit_length >= dual_min_bit_length_ ? score.fit_masks[bit_length] : 0ull;
+    };
 
-void Encoder::Impl::dual_encode(AlgorithmParam& param) {
-    std::vector<uint32_t> bits_histogram(9);
-    std::vector<uint8_t> symbol_bits(param.block_size);
-
-    for (uint32_t i{}; i < param.block_size; ++i) {
-        symbol_bits[i] = dual_log2_lut_[param.residual[i]];
-        bits_histogram[symbol_bits[i]]++;
-    }
-
-    // For each of the bins, calculate the compressed Size.
-    // And find the bitln that results in the minimum compressed Size.
-    uint32_t cumSumL{};
-    uint32_t cumSumH{};
-    std::vector<uint32_t> cSize(9);
     param.dual_encoding_bits = ~0u;
 
-    for (int i = 1; i < 9; ++i) {
-        cumSumL = 0u;
-        for (int j = 1; j <= i; ++j) {
-            cumSumL += bits_histogram[j];
-        }
-        cumSumH = 0;
-        for (int j = i + 1; j < 9; ++j) {
-            cumSumH += bits_histogram[j];
-        }
-        cSize[i] = cumSumL * i + cumSumH * 8;
+    for (uint32_t bit_length{1u}; bit_length <= 8u; ++bit_length) {
+        const auto short_count{static_cast<uint32_t>(std::bitset<64>(short_symbols(bit_length)).count())};
+        const auto encoding_bits{short_count * bit_length + (param.block_size - short_count) * 8u};
+
         // Find the minimum compressed Size.
-        if (i == 1) {
-            param.dual_encoding_bits = cSize[i];
-            param.dual_bit_length = i;
-        } else {
-            if (cSize[i] < param.dual_encoding_bits) {
-                param.dual_encoding_bits = cSize[i];
-                param.dual_bit_length = i;
-            }
+        if (encoding_bits < param.dual_encoding_bits) {
+            param.dual_encoding_bits = encoding_bits;
+            param.dual_bit_length = bit_length;
         }
     }
 
-    param.dual_bitmap = 0ull;
-    bool using_8bits{false};
-
-    for (uint32_t i{}; i < param.block_size; ++i) {
-        const auto use_8bits{symbol_bits[i] > param.dual_bit_length};
-
-        param.dual_bitmap |= (static_cast<uint64_t>(use_8bits)) << i;
-
-        using_8bits |= use_8bits;
-    }
+    param.dual_bitmap = ~short_symbols(param.dual_bit_length);
 
-    if (!using_8bits) {
+    if (param.dual_bitmap == 0ull) {
         param.dual_encoding_bits += (8u - param.dual_bit_length);
         param.dual_bitmap |= 0x1ull;
     }
@@ -421,7 +255,7 @@ void Encoder::Impl::fp16_preprocess(uint32_t input_bytes) {
 void Encoder::Impl::init_block_param(AlgorithmParam& block_param, uint8_t* p_input_block, uint32_t algo) {
     block_param.p_data = p_input_block;
     block_param.block_size = BLOCK_SIZE;
-    block_param.decoder = encoder_to_decoder_mapping_.at(algo);
+    block_param.decoder = encoder_to_decoder_mapping_[algo];
     block_param.encoder_index = algo;
     block_param.dual_encoder_enable = dual_encoder_enable_;
 }
@@ -472,20 +306,38 @@ BestAlgorithm Encoder::Impl::get_best_algorithm(const BitCompactorConfig& config
     const auto input_offset{blk * BLOCK_SIZE};
     auto p_input_block{bit_stream_in_.get_byte_pointer(input_offset)};
     const auto algorithm_offset{blk * ALGORITHMS};
+    const auto stats{get_block_statistics(p_input_block, config.kernel_type)};
+
+    std::array<uint32_t, static_cast<uint32_t>(EncoderAlgorithm::ALGO_COUNT)> algos;
+    std::array<Predictor, static_cast<uint32_t>(EncoderAlgorithm::ALGO_COUNT)> predictors;
+    std::array<PredictorScore, static_cast<uint32_t>(EncoderAlgorithm::ALGO_COUNT)> scores;
+    size_t count{};
 
     for (uint32_t algo{}; algo < ALGORITHMS; ++algo) {
         if (!is_algo_valid(algo, blk)) {
             continue;
         }
 
-        const auto offset{algorithm_offset + algo};
-        auto& block_param{block_params[offset]};
+        auto& block_param{block_params[algorithm_offset + algo]};
         init_block_param(block_param, p_input_block, algo);
+        algos[count] = algo;
+        predictors[count] = get_predictor(config, algo, stats, p_input_block, block_param);
+        ++count;
+    }
+
+    // Only the scores are needed to pick the best algorithm, the residual is packed for the selected one only
+    predict_block(p_input_block, predictors.data(), scores.data(), count, config.kernel_type);
 
-        (this->*algorithm_encoder_[algo])(block_param);
+    for (size_t idx{}; idx < count; ++idx) {
+        const auto algo{algos[idx]};
+        const auto& score{scores[idx]};
+        auto& block_param{block_params[algorithm_offset + algo]};
+
+        block_param.bit_length = is_algo_raw(config, algo) ? 8u : log2_lut_[score.residual_bits];
+        block_param.encoding_bits = block_param.bit_length * block_param.block_size;
 
         if (is_algo_dual_encode_compatible(config, algo)) {
-            dual_encode(block_param);
+            dual_encode(block_param, score);
         } else {
             block_param.dual_encoding_bits = MAX_BLOCK_COMPRESSION_BITS;
         }
@@ -764,7 +616,17 @@ void Encoder::Impl::encode(const BitCompactorConfig& config, const std::vector<u
         fp16_preprocess(bit_stream_in_.source_stream_length());
     }
 
-    for (int blk = 0; blk < static_cast<int>(input_blocks); ++blk) {
+    encode_blocks_parallel(config, input_blocks, block_stream, block_params);
+
+    if (last_block) {
+        write_last_blk(input_blocks, block_stream, last_block_elements);
+    }
+    write_to_output(out, block_stream);
+}
+
+void Encoder::Impl::encode_blocks(const BitCompactorConfig& config, uint32_t first_blk, uint32_t last_blk,
+                                  std::vector<BitStream>& block_stream, std::vector<AlgorithmParam>& block_params) {
+    for (int blk = static_cast<int>(first_blk); blk < static_cast<int>(last_blk); ++blk) {
         BestAlgorithm best_algorithm = get_best_algorithm(config, blk, block_params);
 
         if (is_compression_better_than_uncompressed(best_algorithm)) {
@@ -774,11 +636,38 @@ void Encoder::Impl::encode(const BitCompactorConfig& config, const std::vector<u
             write_uncompressed_blk(config, blk, block_stream, block_params);
         }
     }
+}
 
-    if (last_block) {
-        write_last_blk(input_blocks, block_stream, last_block_elements);
+// Blocks are encoded independently: each of them only reads the input stream and writes its own parameters and bit
+// stream, so they can be split between the tasks of config.parallel_for. The streams are concatenated in the block
+// order afterwards, which keeps the output identical to the serial one
+void Encoder::Impl::encode_blocks_parallel(const BitCompactorConfig& config, uint32_t input_blocks,
+                                           std::vector<BitStream>& block_stream,
+                                           std::vector<AlgorithmParam>& block_params) {
+    const uint32_t num_tasks{(input_blocks + BLOCKS_PER_TASK - 1) / BLOCKS_PER_TASK};
+
+    if (!config.parallel_for || num_tasks <= 1) {
+        encode_blocks(config, 0, input_blocks, block_stream, block_params);
+        return;
+    }
+
+    // The exceptions are passed back to the calling thread, the caller's thread pool may not forward them
+    std::vector<std::exception_ptr> errors(num_tasks);
+    config.parallel_for(num_tasks, [&](size_t task) {
+        const auto first_blk{static_cast<uint32_t>(task) * BLOCKS_PER_TASK};
+        const auto last_blk{std::min(first_blk + BLOCKS_PER_TASK, input_blocks)};
+        try {
+            encode_blocks(config, first_blk, last_blk, block_stream, block_params);
+        } catch (...) {
+            errors[task] = std::current_exception();
+        }
+    });
+
+    for (const auto& error : errors) {
+        if (error != nullptr) {
+            std::rethrow_exception(error);
+        }
     }
-    write_to_output(out, block_stream);
 }
 
 void Encoder::Impl::write_residual(const BitCompactorConfig& config, BitStream& stream, const AlgorithmParam& param) {
@@ -3,10 +3,13 @@
 // SPDX-License-Identifier: Apache 2.0
 //
 
+#include <algorithm>
 #include <cassert>
 #include <chrono>
+#include <functional>
 #include <iostream>
 #include <string>
+#include <thread>
 #include "Decoder.hpp"
 #include "bitc.hpp"
 #include "config.hpp"
@@ -23,12 +26,65 @@ bitc::ArchType string_to_arch(const std::string& arch_type) {
         return bitc::ArchType::NPU4;
 }
 
+#ifdef __BITC__EN_BENCHMARK__
+struct EncoderBenchmark {
+    uint64_t serial_us{};
+    uint64_t parallel_us{};
+    uint64_t count_parallel_diff{};
+};
+
+// Runs the tasks on one thread per hardware thread, each thread takes every num_threads-th task
+void parallel_for(size_t num_tasks, const std::function<void(size_t)>& task) {
+    const size_t num_threads{std::max(std::thread::hardware_concurrency(), 1u)};
+    std::vector<std::thread> workers;
+    for (size_t thread{}; thread < num_threads; ++thread) {
+        workers.emplace_back([&, thread]() {
+            for (size_t idx{thread}; idx < num_tasks; idx += num_threads) {
+                task(idx);
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+// Encodes the data serially and with one thread per hardware thread, the parallel output must be bit-exact
+void benchmark_encoder(const bitc::BitCompactorConfig& config, const std::vector<uint8_t>& decompressed_data,
+                       EncoderBenchmark& benchmark) {
+    bitc::BitCompactorConfig serial_config{config};
+    serial_config.parallel_for = nullptr;
+    bitc::BitCompactorConfig parallel_config{config};
+    parallel_config.parallel_for = parallel_for;
+
+    std::vector<uint8_t> serial_out, parallel_out;
+
+    auto start = steady_clock::now();
+    bitc::Encoder{}.encode(serial_config, decompressed_data, serial_out);
+    auto stop = steady_clock::now();
+    benchmark.serial_us += duration_cast<microseconds>(stop - start).count();
+
+    start = steady_clock::now();
+    bitc::Encoder{}.encode(parallel_config, decompressed_data, parallel_out);
+    stop = steady_clock::now();
+    benchmark.parallel_us += duration_cast<microseconds>(stop - start).count();
+
+    if (serial_out != parallel_out) {
+        benchmark.count_parallel_diff++;
+    }
+}
+#endif
+
 int check_dataset_compression(const config_map& config_test, bitc::BitCompactorConfig& config) {
     std::cout << "\nEncoder running on dataset..." << std::endl;
     uint64_t count_size_diff{};
     uint64_t count_content_diff{};
     uint64_t count_runs{};
 
+#ifdef __BITC__EN_BENCHMARK__
+    EncoderBenchmark benchmark{};
+#endif
+
     std::string decompressed_data_path = std::get<std::string>(config_test.at("decompressed_data_path"));
     const string_vector& decompressed_data_set = std::get<string_vector>(config_test.at("decompressed_data"));
     const string_vector& compressed_data_set = std::get<string_vector>(config_test.at("compressed_data"));
@@ -57,6 +113,9 @@ int check_dataset_compression(const config_map& config_test, bitc::BitCompactorC
 #ifdef __BITC__EN_DBG__
             std::cout << "Encoder compressed output size: " << compressed_data_out.size() << " bytes" << std::endl;
 #endif
+#ifdef __BITC__EN_BENCHMARK__
+            benchmark_encoder(config, decompressed_data, benchmark);
+#endif
 
             std::string golden_compressed_data_file_path = compressed_data_set[idx];
 #ifdef __BITC__EN_OUT_WRITE__
@@ -111,7 +170,21 @@ int check_dataset_compression(const config_map& config_test, bitc::BitCompactorC
     std::cout << count_content_diff << " files from dataset doesn't match the golden one in terms of content"
               << std::endl;
 
+#ifdef __BITC__EN_BENCHMARK__
+    std::cout << "\nEncoder benchmark (" << std::thread::hardware_concurrency() << " threads)" << std::endl;
+    std::cout << "Serial duration: " << benchmark.serial_us << " microseconds" << std::endl;
+    std::cout << "Parallel duration: " << benchmark.parallel_us << " microseconds" << std::endl;
+    if (benchmark.parallel_us != 0) {
+        std::cout << "Speedup: " << static_cast<double>(benchmark.serial_us) / benchmark.parallel_us << "x"
+                  << std::endl;
+    }
+    std::cout << benchmark.count_parallel_diff
+              << " files from dataset doesn't match the serial output in parallel mode" << std::endl;
+
+    return count_content_diff || count_size_diff || benchmark.count_parallel_diff;
+#else
     return count_content_diff || count_size_diff;
+#endif
 }
 
 int check_dataset_decompression(const config_map& config_test, const bitc::BitCompactorConfig& config) {
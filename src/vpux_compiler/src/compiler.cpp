@@ -20,6 +20,7 @@
 #include "vpux/compiler/dialect/VPUIP/interfaces/network_description.hpp"
 #include "vpux/compiler/dialect/VPUMI37XX/network_description.hpp"
 #include "vpux/compiler/dialect/const/utils/constant_folding_in_background.hpp"
+#include "vpux/compiler/dialect/const/utils/persistent_folding_cache.hpp"
 #include "vpux/compiler/frontend/IE.hpp"
 #include "vpux/compiler/init.hpp"
 #include "vpux/compiler/interfaces_registry.hpp"
@@ -27,6 +28,7 @@
 #include "vpux/compiler/utils/dot_printer.hpp"
 #include "vpux/compiler/utils/locations_verifier.hpp"
 #include "vpux/compiler/utils/logging.hpp"
+#include "vpux/compiler/utils/pass_flight_recorder.hpp"
 
 #include "vpux/utils/IE/itt.hpp"
 #include "vpux/utils/IE/private_properties.hpp"
@@ -548,6 +550,100 @@ std::optional<size_t> getBatchSize(const std::shared_ptr<ov::Model>& model, cons
     return *it;
 }
 
+// Options of the compilation itself rather than of the pipeline, they are parsed once from COMPILATION_MODE_PARAMS
+struct PassManagerOptions {
+    std::string passFlightRecorderOutput;
+    std::string constantFoldingCacheDir;
+    int64_t constantFoldingCacheMinEntrySize;
+};
+
+template <typename Options>
+PassManagerOptions getPassManagerOptions(const intel_npu::Config& config) {
+    const auto options = Options::createFromString(config.get<intel_npu::COMPILATION_MODE_PARAMS>());
+    VPUX_THROW_UNLESS(options != nullptr, "failed to parse COMPILATION_MODE_PARAMS");
+    return PassManagerOptions{options->passFlightRecorderOutput, options->constantFoldingCacheDir,
+                              options->constantFoldingCacheMinEntrySize};
+}
+
+template <typename ReferenceSWOptions, typename ReferenceHWOptions, typename DefaultHWOptions>
+PassManagerOptions getPassManagerOptions(const intel_npu::Config& config) {
+    const auto compilationMode = getCompilationMode(config);
+    if (compilationMode == VPU::CompilationMode::ReferenceSW) {
+        return getPassManagerOptions<ReferenceSWOptions>(config);
+    } else if (compilationMode == VPU::CompilationMode::ReferenceHW) {
+        return getPassManagerOptions<ReferenceHWOptions>(config);
+    } else if (compilationMode == VPU::CompilationMode::DefaultHW) {
+        return getPassManagerOptions<DefaultHWOptions>(config);
+    } else {
+        VPUX_THROW("Unsupported compilation mode: {0}", compilationMode);
+    }
+}
+
+PassManagerOptions getPassManagerOptions(const intel_npu::Config& config) {
+    const auto arch = getArchKind(config);
+    if (arch == VPU::ArchKind::NPU37XX) {
+        return getPassManagerOptions<ReferenceSWOptions37XX, ReferenceHWOptions37XX, DefaultHWOptions37XX>(config);
+    } else if (arch == VPU::ArchKind::NPU40XX) {
+        return getPassManagerOptions<ReferenceSWOptions40XX, ReferenceHWOptions40XX, DefaultHWOptions40XX>(config);
+    } else {
+        VPUX_THROW("Unsupported device type: {0}", arch);
+    }
+}
+
+//
+// PassManagerSetup
+//
+
+// Sets up all pass managers of one compilation: logging, developer options and the pass flight recorder. It also
+// attaches the persistent constant folding cache to the context for the lifetime of the compilation.
+// The flight recorder report is written on destruction, so that it is available when the compilation fails too
+class PassManagerSetup final {
+public:
+    PassManagerSetup(mlir::MLIRContext& ctx, DeveloperConfig& devConf, const intel_npu::Config& config, Logger log)
+            : _ctx(ctx), _devConf(devConf), _options(getPassManagerOptions(config)), _log(log) {
+        if (!_options.passFlightRecorderOutput.empty()) {
+            _flightRecorder = std::make_unique<PassFlightRecorder>(_log);
+        }
+        if (!_options.constantFoldingCacheDir.empty()) {
+            Const::PersistentFoldingCacheManager::getInstance().addCache(
+                    &_ctx, _options.constantFoldingCacheDir,
+                    vpux::KB(_options.constantFoldingCacheMinEntrySize).to<vpux::Byte>(), _log);
+        }
+    }
+
+    ~PassManagerSetup() {
+        auto& persistentCacheManager = Const::PersistentFoldingCacheManager::getInstance();
+        if (auto* persistentCache = persistentCacheManager.find(&_ctx)) {
+            _log.info("Persistent constant folding cache '{0}': {1} hits, {2} misses, {3} new entries",
+                      persistentCache->getCacheDir(), persistentCache->getNumHits(), persistentCache->getNumMisses(),
+                      persistentCache->getNumStores());
+            persistentCacheManager.removeCache(&_ctx);
+        }
+        if (_flightRecorder != nullptr) {
+            _flightRecorder->writeReport(_options.passFlightRecorderOutput);
+        }
+    }
+
+    PassManagerSetup(const PassManagerSetup&) = delete;
+    PassManagerSetup& operator=(const PassManagerSetup&) = delete;
+
+    // `pipelineName` tells the pipelines apart in the flight recorder report
+    void setup(mlir::PassManager& pm, StringRef pipelineName) const {
+        addLogging(pm, _log);
+        _devConf.setup(pm);
+        if (_flightRecorder != nullptr) {
+            _flightRecorder->attach(pm, pipelineName);
+        }
+    }
+
+private:
+    mlir::MLIRContext& _ctx;
+    DeveloperConfig& _devConf;
+    PassManagerOptions _options;
+    Logger _log;
+    std::unique_ptr<PassFlightRecorder> _flightRecorder;
+};
+
 #ifdef BACKGROUND_FOLDING_ENABLED
 struct ConstantFoldingConfig {
     bool foldingInBackgroundEnabled;
@@ -555,16 +651,23 @@ struct ConstantFoldingConfig {
     bool collectStatistics;
     int64_t memoryUsageLimit;
     double cacheCleanThreshold;
+    Const::CacheEvictionPolicy evictionPolicy;
 };
 
 template <typename Options>
 ConstantFoldingConfig getConstantFoldingInBackground(const intel_npu::Config& config) {
     const auto options = Options::createFromString(config.get<intel_npu::COMPILATION_MODE_PARAMS>());
     VPUX_THROW_UNLESS(options != nullptr, "failed to parse COMPILATION_MODE_PARAMS");
-    return ConstantFoldingConfig{options->constantFoldingInBackground, options->constantFoldingInBackgroundNumThreads,
+    const auto evictionPolicy =
+            Const::symbolizeCacheEvictionPolicy(options->constantFoldingInBackgroundEvictionPolicy.getValue());
+    VPUX_THROW_UNLESS(evictionPolicy.has_value(), "Unsupported constant folding cache eviction policy '{0}'",
+                      options->constantFoldingInBackgroundEvictionPolicy.getValue());
+    return ConstantFoldingConfig{options->constantFoldingInBackground,
+                                 options->constantFoldingInBackgroundNumThreads,
                                  options->constantFoldingInBackgroundCollectStatistics,
                                  options->constantFoldingInBackgroundMemoryUsageLimit,
-                                 options->constantFoldingInBackgroundCacheCleanThreshold};
+                                 options->constantFoldingInBackgroundCacheCleanThreshold,
+                                 evictionPolicy.value()};
 }
 
 template <typename ReferenceSWOptions, typename ReferenceHWOptions, typename DefaultHWOptions>
@@ -621,9 +724,10 @@ mlir::OwningOpRef<mlir::ModuleOp> compileModel(mlir::MLIRContext& ctx, const std
 
     OV_ITT_TASK_NEXT(COMPILER_IMPLEMENTATION, "PassManager");
 
+    PassManagerSetup pmSetup(ctx, devConf, config, log);
+
     mlir::PassManager pm(module.get()->getName(), mlir::OpPassManager::Nesting::Implicit);
-    addLogging(pm, log);
-    devConf.setup(pm);
+    pmSetup.setup(pm, "main");
 
     auto pipelineFactory = createPipelineStrategy(arch);
 
@@ -637,7 +741,7 @@ mlir::OwningOpRef<mlir::ModuleOp> compileModel(mlir::MLIRContext& ctx, const std
     if (foldingConfig.foldingInBackgroundEnabled) {
         foldingManager = std::make_unique<vpux::Const::BackgroundConstantFolding>(
                 &ctx, foldingConfig.maxConcurrentTasks, foldingConfig.collectStatistics, foldingConfig.memoryUsageLimit,
-                foldingConfig.cacheCleanThreshold, log);
+                foldingConfig.cacheCleanThreshold, foldingConfig.evictionPolicy, log);
     }
 #endif
 
@@ -647,10 +751,11 @@ mlir::OwningOpRef<mlir::ModuleOp> compileModel(mlir::MLIRContext& ctx, const std
 
     if (isELFEnabled(config)) {
         mlir::PassManager elfPm(module.get()->getName(), mlir::OpPassManager::Nesting::Implicit);
-        addLogging(elfPm, log);
-        devConf.setup(elfPm);
+        pmSetup.setup(elfPm, "elf");
         pipelineFactory->buildELFPipeline(elfPm, config, rootTiming, log);
-        if (getWlmRollback(config).value_or(false)) {
+        // The checkpoint is needed only when the ELF pipeline runs the workload management passes. Cloning the module
+        // copies the operations only, constants are attributes owned by the context and shared with the checkpoint.
+        if (getWlmRollback(config).value_or(false) && pipelineFactory->mayRequireWlmRollback(config)) {
             auto backup_module = mlir::OwningOpRef<mlir::ModuleOp>(module.get().clone());
             try {
                 compileNetwork(module.get(), elfPm, rootTiming);
@@ -660,8 +765,7 @@ mlir::OwningOpRef<mlir::ModuleOp> compileModel(mlir::MLIRContext& ctx, const std
                 auto safeConfig = config;
                 setSafeOptions(safeConfig);
                 mlir::PassManager simpleElfPm(module.get()->getName(), mlir::OpPassManager::Nesting::Implicit);
-                addLogging(simpleElfPm, log);
-                devConf.setup(simpleElfPm);
+                pmSetup.setup(simpleElfPm, "elf-rollback");
                 pipelineFactory->buildELFPipeline(simpleElfPm, safeConfig, rootTiming, log);
                 compileNetwork(module.get(), simpleElfPm, rootTiming);
             }
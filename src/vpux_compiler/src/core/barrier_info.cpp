@@ -11,8 +11,6 @@
 #include "vpux/compiler/utils/dma.hpp"
 #include "vpux/utils/core/range.hpp"
 
-#include <llvm/ADT/SetOperations.h>
-
 using namespace vpux;
 
 //
@@ -97,7 +95,7 @@ VPURT::DeclareVirtualBarrierOp vpux::BarrierInfo::getBarrierOpAtIndex(size_t opI
 // getWaitBarriers
 //
 
-BarrierInfo::TaskSet& vpux::BarrierInfo::getWaitBarriers(size_t taskInd) {
+const BarrierInfo::TaskSet& vpux::BarrierInfo::getWaitBarriers(size_t taskInd) const {
     VPUX_THROW_UNLESS(taskInd <= _taskWaitBarriers.size(), "Task not found in _taskWaitBarriers, '{0}'", taskInd);
     return _taskWaitBarriers[taskInd];
 }
@@ -106,7 +104,7 @@ BarrierInfo::TaskSet& vpux::BarrierInfo::getWaitBarriers(size_t taskInd) {
 // getUpdateBarriers (by Idn)
 //
 
-BarrierInfo::TaskSet& vpux::BarrierInfo::getUpdateBarriers(size_t taskInd) {
+const BarrierInfo::TaskSet& vpux::BarrierInfo::getUpdateBarriers(size_t taskInd) const {
     VPUX_THROW_UNLESS(taskInd < _taskUpdateBarriers.size(), "Task not found in _taskUpdateBarriers, '{0}'", taskInd);
     return _taskUpdateBarriers[taskInd];
 }
@@ -115,7 +113,7 @@ BarrierInfo::TaskSet& vpux::BarrierInfo::getUpdateBarriers(size_t taskInd) {
 // getBarrierProducers
 //
 
-BarrierInfo::TaskSet& vpux::BarrierInfo::getBarrierProducers(size_t barrierInd) {
+const BarrierInfo::TaskSet& vpux::BarrierInfo::getBarrierProducers(size_t barrierInd) const {
     VPUX_THROW_UNLESS(barrierInd <= _barrierProducerMap.size(), "Barrier not found in _barrierProducerMap, '{0}'",
                       barrierInd);
     return _barrierProducerMap[barrierInd];
@@ -125,7 +123,7 @@ BarrierInfo::TaskSet& vpux::BarrierInfo::getBarrierProducers(size_t barrierInd)
 // getBarrierConsumers
 //
 
-BarrierInfo::TaskSet& vpux::BarrierInfo::getBarrierConsumers(size_t barrierInd) {
+const BarrierInfo::TaskSet& vpux::BarrierInfo::getBarrierConsumers(size_t barrierInd) const {
     VPUX_THROW_UNLESS(barrierInd <= _barrierConsumerMap.size(), "Barrier not found in _barrierConsumerMap, '{0}'",
                       barrierInd);
     return _barrierConsumerMap[barrierInd];
@@ -135,7 +133,8 @@ BarrierInfo::TaskSet& vpux::BarrierInfo::getBarrierConsumers(size_t barrierInd)
 // getBarrierProducers
 //
 
-BarrierInfo::TaskSet& vpux::BarrierInfo::getBarrierProducers(VPURT::DeclareVirtualBarrierOp barrierOp) {
+const BarrierInfo::TaskSet& vpux::BarrierInfo::getBarrierProducers(
+        VPURT::DeclareVirtualBarrierOp barrierOp) const {
     auto barrierInd = getIndex(barrierOp);
     return getBarrierProducers(barrierInd);
 }
@@ -144,7 +143,8 @@ BarrierInfo::TaskSet& vpux::BarrierInfo::getBarrierProducers(VPURT::DeclareVirtu
 // getBarrierConsumers
 //
 
-BarrierInfo::TaskSet& vpux::BarrierInfo::getBarrierConsumers(VPURT::DeclareVirtualBarrierOp barrierOp) {
+const BarrierInfo::TaskSet& vpux::BarrierInfo::getBarrierConsumers(
+        VPURT::DeclareVirtualBarrierOp barrierOp) const {
     auto barrierInd = getIndex(barrierOp);
     return getBarrierConsumers(barrierInd);
 }
@@ -301,7 +301,8 @@ bool vpux::BarrierInfo::producersControlsAllConsumers(const TaskSet& origProduce
                                                       ArrayRef<TaskSet> origWaitBarriersMap) {
     // Get new consumers not in original consumers
 
-    auto consumersWithoutDirectControl = llvm::set_difference(newConsumers, origConsumers);
+    auto consumersWithoutDirectControl = newConsumers;
+    consumersWithoutDirectControl.setSubtract(origConsumers);
     if (consumersWithoutDirectControl.empty()) {
         return true;
     }
@@ -318,8 +319,7 @@ bool vpux::BarrierInfo::producersControlsAllConsumers(const TaskSet& origProduce
         return false;
     }
 
-    if (*std::max_element(origProducers.begin(), origProducers.end()) >=
-        *std::min_element(consumersWithoutDirectControl.begin(), consumersWithoutDirectControl.end())) {
+    if (origProducers.back() >= consumersWithoutDirectControl.front()) {
         return false;
     }
 
@@ -415,7 +415,11 @@ void vpux::BarrierInfo::buildBarrierMaps(mlir::func::FuncOp func) {
 
 void vpux::BarrierInfo::addConsumer(size_t barrierInd, size_t taskInd) {
     _log.trace("Add consumer '{0}' for barrier '{1}'", taskInd, barrierInd);
-    _barrierConsumerMap[barrierInd].insert(taskInd);
+    if (_barrierConsumerMap[barrierInd].insert(taskInd).second) {
+        for (auto producerInd : _barrierProducerMap[barrierInd]) {
+            updateTaskControlMap(producerInd, taskInd);
+        }
+    }
     _taskWaitBarriers[taskInd].insert(barrierInd);
 }
 
@@ -429,7 +433,11 @@ void vpux::BarrierInfo::addConsumer(VPURT::DeclareVirtualBarrierOp barrierOp, si
 
 void vpux::BarrierInfo::addConsumers(size_t barrierInd, const TaskSet& taskInds) {
     for (const auto& taskInd : taskInds) {
-        _barrierConsumerMap[barrierInd].insert(taskInd);
+        if (_barrierConsumerMap[barrierInd].insert(taskInd).second) {
+            for (auto producerInd : _barrierProducerMap[barrierInd]) {
+                updateTaskControlMap(producerInd, taskInd);
+            }
+        }
         _taskWaitBarriers[taskInd].insert(barrierInd);
     }
 }
@@ -440,7 +448,11 @@ void vpux::BarrierInfo::addConsumers(size_t barrierInd, const TaskSet& taskInds)
 
 void vpux::BarrierInfo::addProducer(size_t barrierInd, size_t taskInd) {
     _log.trace("Add producer '{0}' for barrier '{1}'", taskInd, barrierInd);
-    _barrierProducerMap[barrierInd].insert(taskInd);
+    if (_barrierProducerMap[barrierInd].insert(taskInd).second) {
+        for (auto consumerInd : _barrierConsumerMap[barrierInd]) {
+            updateTaskControlMap(taskInd, consumerInd);
+        }
+    }
     _taskUpdateBarriers[taskInd].insert(barrierInd);
 }
 
@@ -454,7 +466,11 @@ void vpux::BarrierInfo::addProducer(VPURT::DeclareVirtualBarrierOp barrierOp, si
 
 void vpux::BarrierInfo::addProducers(size_t barrierInd, const TaskSet& taskInds) {
     for (const auto& taskInd : taskInds) {
-        _barrierProducerMap[barrierInd].insert(taskInd);
+        if (_barrierProducerMap[barrierInd].insert(taskInd).second) {
+            for (auto consumerInd : _barrierConsumerMap[barrierInd]) {
+                updateTaskControlMap(taskInd, consumerInd);
+            }
+        }
         _taskUpdateBarriers[taskInd].insert(barrierInd);
     }
 }
@@ -463,6 +479,7 @@ void vpux::BarrierInfo::addProducers(size_t barrierInd, const TaskSet& taskInds)
 // removeProducers
 //
 void vpux::BarrierInfo::removeProducers(size_t barrierInd, const TaskSet& taskInds) {
+    invalidateTaskControlMap();
     for (const auto& taskInd : taskInds) {
         _barrierProducerMap[barrierInd].erase(taskInd);
         _taskUpdateBarriers[taskInd].erase(barrierInd);
@@ -478,6 +495,7 @@ void vpux::BarrierInfo::removeProducers(VPURT::DeclareVirtualBarrierOp barrierOp
 // removeConsumers
 //
 void vpux::BarrierInfo::removeConsumers(size_t barrierInd, const TaskSet& taskInds) {
+    invalidateTaskControlMap();
     for (const auto& taskInd : taskInds) {
         _barrierConsumerMap[barrierInd].erase(taskInd);
         _taskWaitBarriers[taskInd].erase(barrierInd);
@@ -533,6 +551,8 @@ size_t vpux::BarrierInfo::addNewBarrier(VPURT::DeclareVirtualBarrierOp barrierOp
 //
 
 void vpux::BarrierInfo::setWaitBarriers(size_t taskInd, const TaskSet& barriers) {
+    invalidateTaskControlMap();
+
     // remove previous wait barriers
     for (auto barrierInd : _taskWaitBarriers[taskInd]) {
         _barrierConsumerMap[static_cast<size_t>(barrierInd)].erase(taskInd);
@@ -549,6 +569,8 @@ void vpux::BarrierInfo::setWaitBarriers(size_t taskInd, const TaskSet& barriers)
 //
 
 void vpux::BarrierInfo::setUpdateBarriers(size_t taskInd, const TaskSet& barriers) {
+    invalidateTaskControlMap();
+
     // remove previous update barriers
     for (auto barrierInd : _taskUpdateBarriers[taskInd]) {
         _barrierProducerMap[static_cast<size_t>(barrierInd)].erase(taskInd);
@@ -565,6 +587,7 @@ void vpux::BarrierInfo::setUpdateBarriers(size_t taskInd, const TaskSet& barrier
 //
 
 void vpux::BarrierInfo::removeProducer(size_t barrierInd, size_t taskInd) {
+    invalidateTaskControlMap();
     _barrierProducerMap[barrierInd].erase(taskInd);
     _taskUpdateBarriers[taskInd].erase(barrierInd);
 }
@@ -577,6 +600,7 @@ void vpux::BarrierInfo::removeProducer(VPURT::DeclareVirtualBarrierOp barrierOp,
 // removeConsumer
 //
 void vpux::BarrierInfo::removeConsumer(size_t barrierInd, size_t taskInd) {
+    invalidateTaskControlMap();
     _barrierConsumerMap[barrierInd].erase(taskInd);
     _taskWaitBarriers[taskInd].erase(barrierInd);
 }
@@ -600,6 +624,7 @@ void vpux::BarrierInfo::resetBarrier(VPURT::DeclareVirtualBarrierOp barrierOp) {
 
 void vpux::BarrierInfo::resetBarrier(size_t barrierInd) {
     _log.trace("Reset barrier '{0}'", barrierInd);
+    invalidateTaskControlMap();
 
     for (auto taskInd : _barrierProducerMap[barrierInd]) {
         _taskUpdateBarriers[static_cast<size_t>(taskInd)].erase(barrierInd);
@@ -646,6 +671,7 @@ void vpux::BarrierInfo::splitControlGraphToBlocks(size_t blockSize) {
     }
 
     _controlGraphBlockSize = blockSize;
+    invalidateTaskControlMap();
 
     size_t numOfBlocks = tasksSize / blockSize;
     if (tasksSize % blockSize > 0) {
@@ -1522,7 +1548,7 @@ void vpux::BarrierInfo::optimizeBarriersWithSameProducers(size_t blockIdx, bool
                                            static_cast<size_t>(0), addFunc);
         BarrierInfo::TaskSet consumers = _barrierConsumerMap[bar1];
         // Use set operation to remove duplicated consumers
-        llvm::set_union(consumers, _barrierConsumerMap[bar2]);
+        consumers.setUnion(_barrierConsumerMap[bar2]);
         slotCount = std::accumulate(consumers.begin(), consumers.end(), slotCount, addFunc);
         return slotCount <= maxVariantCount;
     };
@@ -1588,7 +1614,7 @@ bool vpux::BarrierInfo::mergeParallelWaitBarriers(size_t taskInd, size_t availab
         for (auto& waitBarrierInd : waitBarriers) {
             // merge all producers
             const auto& barrierProducers = getBarrierProducers(waitBarrierInd);
-            llvm::set_union(newBarrierProducers, barrierProducers);
+            newBarrierProducers.setUnion(barrierProducers);
         }
 
         return newBarrierProducers;
@@ -1596,7 +1622,7 @@ bool vpux::BarrierInfo::mergeParallelWaitBarriers(size_t taskInd, size_t availab
 
     BarrierInfo::TaskSet parallelConsumers;
     for (auto& waitBarrier : waitBarriers) {
-        llvm::set_union(parallelConsumers, getBarrierConsumers(waitBarrier));
+        parallelConsumers.setUnion(getBarrierConsumers(waitBarrier));
     }
 
     auto getBarriersConsumerTasks = [&](const BarrierInfo::TaskSet& waitBarriers, size_t availableSlotsForConsumer) {
@@ -1710,7 +1736,7 @@ SmallVector<BarrierInfo::TaskSet> BarrierInfo::createProducerBatches(const Barri
 
         prevLastUserInd = VPURT::getMaxEntry(barrierProducers);
         auto currentBatchPlusBarrierProducers = legalBatches.back();
-        llvm::set_union(currentBatchPlusBarrierProducers, barrierProducers);
+        currentBatchPlusBarrierProducers.setUnion(barrierProducers);
 
         if (canMergeBarriersForTasks(currentBatchPlusBarrierProducers, availableSlots)) {
             // can add to the same batch
@@ -1860,6 +1886,8 @@ void vpux::BarrierInfo::setBarrierMask(llvm::BitVector& mask, const BarrierInfo:
 //
 
 void vpux::BarrierInfo::buildTaskQueueTypeMap(bool considerTaskFifoDependency) {
+    invalidateTaskControlMap();
+
     if (_taskQueueTypeMap.empty()) {
         // resize implicit dependency map
         const auto module = _func->getParentOfType<mlir::ModuleOp>();
@@ -1905,44 +1933,73 @@ std::pair<SmallVector<llvm::BitVector>, size_t> vpux::BarrierInfo::buildTaskCont
 
     _log.trace("Build task control map for task range [{0}, {1}]", blockStartInd, blockEndInd);
     auto newTaskControlMapSize = blockEndInd - blockStartInd + 1;
-    if (taskControlMap.size() != newTaskControlMapSize) {
-        resizeBitMap(taskControlMap, newTaskControlMapSize, checked_cast<uint32_t>(newTaskControlMapSize));
+    resizeBitMap(taskControlMap, newTaskControlMapSize, checked_cast<uint32_t>(newTaskControlMapSize));
+    buildTaskControlMapRows(taskControlMap, blockStartInd, blockEndInd, blockEndInd, considerTaskFifoDependency);
+
+    return std::make_pair(taskControlMap, blockStartInd);
+}
+
+//
+// getTaskControlMap
+//
+
+std::pair<ArrayRef<llvm::BitVector>, size_t> vpux::BarrierInfo::getTaskControlMap(size_t blockIdx,
+                                                                                  bool considerTaskFifoDependency) {
+    auto& cache = _taskControlMapCache;
+    if (!cache.valid || cache.blockIdx != blockIdx || cache.considerTaskFifoDependency != considerTaskFifoDependency) {
+        std::tie(cache.taskControlMap, cache.blockStartInd) = buildTaskControlMap(blockIdx, considerTaskFifoDependency);
+        cache.blockIdx = blockIdx;
+        cache.considerTaskFifoDependency = considerTaskFifoDependency;
+        cache.lastOutdatedTaskInd.reset();
+        cache.valid = true;
+    } else if (cache.lastOutdatedTaskInd.has_value()) {
+        const auto blockEndInd = cache.blockStartInd + cache.taskControlMap.size() - 1;
+        buildTaskControlMapRows(cache.taskControlMap, cache.blockStartInd, blockEndInd,
+                                cache.lastOutdatedTaskInd.value(), considerTaskFifoDependency);
+        cache.lastOutdatedTaskInd.reset();
     }
-    resetBitMap(taskControlMap);
+    return std::make_pair(ArrayRef<llvm::BitVector>(cache.taskControlMap), cache.blockStartInd);
+}
 
-    if (considerTaskFifoDependency) {
-        auto copyBitsRange = [](const llvm::BitVector& srcVec, int fromIdx, int toIdx) {
-            llvm::SmallVector<int> dstVec;  // implementation on SmallVector is faster than on a slice of BitVector
-            for (int idx = srcVec.find_first_in(fromIdx, toIdx, true); idx <= toIdx && idx != -1;
-                 idx = srcVec.find_next(idx)) {
-                dstVec.push_back(idx - fromIdx);
-            }
-            return dstVec;
-        };
+//
+// buildTaskControlMapRows
+//
 
-        for (const auto& item : _taskQueueTypeMap) {
-            const auto tasksInSameFIFO = copyBitsRange(item.second, blockStartInd, blockEndInd);
-            for (size_t i = 0; i < tasksInSameFIFO.size(); i++) {
-                auto taskInd = tasksInSameFIFO[i];
-                for (size_t j = i + 1; j < tasksInSameFIFO.size(); j++) {
-                    auto nextTaskInd = tasksInSameFIFO[j];
-                    taskControlMap[taskInd].set(nextTaskInd);
+// Builds the rows of the tasks [blockStartInd, lastTaskInd] of the task control map of the block [blockStartInd,
+// blockEndInd]. The rows of the tasks placed after lastTaskInd are expected to be up to date already.
+// A row contains the tasks which directly follow the task on the same FIFO, the consumers of its update barriers and
+// everything reachable from these consumers. FIFO successors are not propagated further.
+void vpux::BarrierInfo::buildTaskControlMapRows(SmallVector<llvm::BitVector>& taskControlMap, size_t blockStartInd,
+                                                size_t blockEndInd, size_t lastTaskInd,
+                                                bool considerTaskFifoDependency) {
+    for (auto taskInd = lastTaskInd + 1; taskInd-- > blockStartInd;) {
+        auto& row = taskControlMap[taskInd - blockStartInd];
+        row.reset();
+
+        if (considerTaskFifoDependency) {
+            for (const auto& item : _taskQueueTypeMap) {
+                const auto& tasksInFIFO = item.second;
+                if (taskInd >= tasksInFIFO.size() || !tasksInFIFO[taskInd]) {
+                    continue;
+                }
+                for (int nextTaskInd = tasksInFIFO.find_next(taskInd);
+                     nextTaskInd != -1 && static_cast<size_t>(nextTaskInd) <= blockEndInd;
+                     nextTaskInd = tasksInFIFO.find_next(nextTaskInd)) {
+                    row.set(static_cast<size_t>(nextTaskInd) - blockStartInd);
                 }
             }
         }
-    }
 
-    for (auto taskInd = blockEndInd + 1; taskInd-- > blockStartInd;) {
         for (auto updateBarrierInd : _taskUpdateBarriers[taskInd]) {
             for (auto consumerIdx : _barrierConsumerMap[static_cast<size_t>(updateBarrierInd)]) {
                 if (inRange(blockStartInd, blockEndInd, consumerIdx)) {
-                    taskControlMap[taskInd - blockStartInd].set(consumerIdx - blockStartInd);
+                    row.set(consumerIdx - blockStartInd);
                 }
             }
         }
     }
 
-    for (auto taskInd = blockEndInd + 1; taskInd-- > blockStartInd;) {
+    for (auto taskInd = lastTaskInd + 1; taskInd-- > blockStartInd;) {
         if (taskInd == blockEndInd && isSyncPoint(taskInd)) {
             continue;
         }
@@ -1959,15 +2016,47 @@ std::pair<SmallVector<llvm::BitVector>, size_t> vpux::BarrierInfo::buildTaskCont
             }
         }
     }
+}
 
-    return std::make_pair(taskControlMap, blockStartInd);
+//
+// updateTaskControlMap
+//
+
+// Records the new dependency producerInd -> consumerInd in the cached task control map. Only the tasks which could
+// reach the producer are affected and, since tasks are topologically ordered, they are all placed before it. Their
+// rows are rebuilt with buildTaskControlMapRows on the next getTaskControlMap, so the cached map stays identical to
+// the one buildTaskControlMap would produce.
+void vpux::BarrierInfo::updateTaskControlMap(size_t producerInd, size_t consumerInd) {
+    auto& cache = _taskControlMapCache;
+    if (!cache.valid) {
+        return;
+    }
+
+    const auto blockStartInd = cache.blockStartInd;
+    const auto blockEndInd = blockStartInd + cache.taskControlMap.size() - 1;
+    if (!inRange(blockStartInd, blockEndInd, producerInd) || !inRange(blockStartInd, blockEndInd, consumerInd) ||
+        producerInd >= consumerInd) {
+        // Dependencies crossing the block or going against the task order can't be tracked incrementally
+        invalidateTaskControlMap();
+        return;
+    }
+
+    cache.lastOutdatedTaskInd = std::max(cache.lastOutdatedTaskInd.value_or(producerInd), producerInd);
+}
+
+//
+// invalidateTaskControlMap
+//
+
+void vpux::BarrierInfo::invalidateTaskControlMap() {
+    _taskControlMapCache.valid = false;
 }
 
 //
 // controlPathExistsBetweenTasksInSameBlock
 //
 
-bool vpux::BarrierInfo::controlPathExistsBetweenTasksInSameBlock(const SmallVector<llvm::BitVector>& taskControlMap,
+bool vpux::BarrierInfo::controlPathExistsBetweenTasksInSameBlock(ArrayRef<llvm::BitVector> taskControlMap,
                                                                  size_t taskAInd, size_t taskBInd,
                                                                  bool biDirection) const {
     // ensure that taskControlMap is build at given time with buildTaskControlMap() for the correct task block
@@ -2163,9 +2252,20 @@ void BarrierInfoTest::initializeBarrierMaps(BarrierInfoTest::BarrierMaps& barrie
     BarrierInfo::_taskUpdateBarriers = toTaskSet(barrierMaps.taskUpdateBarriers);
     BarrierInfo::_taskWaitBarriers = toTaskSet(barrierMaps.taskWaitBarriers);
     BarrierInfo::_controlGraphBlockSize = barrierMaps.controlGraphBlockSize;
+    invalidateTaskControlMap();
     BarrierInfo::_allBarrierOps.resize(barrierMaps.Nbarriers);
     BarrierInfo::_allTaskOps.resize(barrierMaps.Ntasks);
     BarrierInfo::_syncTasksIds = barrierMaps.syncTasksIds;
+
+    BarrierInfo::_taskQueueTypeMap.clear();
+    for (const auto& p : barrierMaps.taskQueues | indexed) {
+        const VPURT::TaskQueueType queueType{VPU::ExecutorKind::DMA_NN, static_cast<int64_t>(p.index())};
+        auto& tasksInQueue = BarrierInfo::_taskQueueTypeMap[queueType];
+        tasksInQueue.resize(barrierMaps.Ntasks);
+        for (auto taskInd : p.value()) {
+            tasksInQueue.set(taskInd);
+        }
+    }
 }
 
 void vpux::BarrierInfoTest::setMaxVariantCountPerBarrier(size_t variantCount) {
@@ -471,8 +471,8 @@ void FeasibleMemoryScheduler::distributeReadyOps(llvm::ArrayRef<operationIdxType
     _log = _log.nest();
     for (auto& readyOpIdx : readyOps) {
         if (_isDataOp[readyOpIdx]) {
-            VPUX_THROW_UNLESS(_readyDataOps.find(readyOpIdx) == _readyDataOps.end(),
-                              "Operation already in the ready data list '{0}'", readyOpIdx);
+            VPUX_THROW_UNLESS(!_readyDataOps.contains(readyOpIdx), "Operation already in the ready data list '{0}'",
+                              readyOpIdx);
             _log.nest().trace("Add to ready data ops '{0}'", readyOpIdx);
             _readyDataOps.insert(readyOpIdx);
             const auto newReadyOps = reduceInDegreeOfAdjacentOperations(readyOpIdx);
@@ -480,12 +480,12 @@ void FeasibleMemoryScheduler::distributeReadyOps(llvm::ArrayRef<operationIdxType
         } else {
             const auto queueType = getQueueType(readyOpIdx);
             if (VPUIP::VPUIPDialect::isComputeExecutorKind(queueType.execKind)) {
-                VPUX_THROW_UNLESS(_readyComputeOps.find(readyOpIdx) == _readyComputeOps.end(),
+                VPUX_THROW_UNLESS(!_readyComputeOps.contains(readyOpIdx),
                                   "Operation already in ready compute list '{0}'", readyOpIdx);
                 _log.nest().trace("Add to ready compute ops '{0}'", readyOpIdx);
                 _readyComputeOps.insert(readyOpIdx);
             } else {
-                VPUX_THROW_UNLESS(_readyDMAOps.find(readyOpIdx) == _readyDMAOps.end(),
+                VPUX_THROW_UNLESS(!_readyDMAOps.contains(readyOpIdx),
                                   "Operation already in ready compute DMA list '{0}'", readyOpIdx);
                 _log.nest().trace("Add to ready DMA ops '{0}'", readyOpIdx);
                 _readyDMAOps.insert(readyOpIdx);
@@ -662,8 +662,7 @@ mlir::DenseSet<mlir::Value> FeasibleMemoryScheduler::getBuffersToAllocateForOp(o
             continue;
         }
 
-        VPUX_THROW_UNLESS(_readyDataOps.find(dep) != _readyDataOps.end(),
-                          "Failed to get buffers - operation not ready '{0}'", dep);
+        VPUX_THROW_UNLESS(_readyDataOps.contains(dep), "Failed to get buffers - operation not ready '{0}'", dep);
         auto depBuffers = getBuffersToAllocateForOp(dep);
         buffersToAllocate.insert(depBuffers.begin(), depBuffers.end());
     }
@@ -692,8 +691,8 @@ size_t FeasibleMemoryScheduler::scheduleDependencies(operationIdxType opIdx) {
             continue;
         }
 
-        VPUX_THROW_UNLESS(_readyDataOps.find(depIdx) != _readyDataOps.end(),
-                          "Failed to schedule dependencies - operation not ready '{0}'", depIdx);
+        VPUX_THROW_UNLESS(_readyDataOps.contains(depIdx), "Failed to schedule dependencies - operation not ready '{0}'",
+                          depIdx);
         const auto cycleBegin = getCurrentCycleAndExecutorInstanceMask(depIdx).cycle;
         sortedDemandList[cycleBegin].insert(depIdx);
     }
@@ -810,7 +809,7 @@ void FeasibleMemoryScheduler::prefetchOps(ArrayRef<std::pair<operationIdxType, s
         for (const auto& opIdx : entry.second) {
             mlir::DenseSet<mlir::Value> operationBuffers;
             size_t scheduleCycle = 0;
-            if (_readyDataOps.find(opIdx) != _readyDataOps.end()) {
+            if (_readyDataOps.contains(opIdx)) {
                 operationBuffers = getBuffersToAllocateForOp(opIdx);
                 scheduleCycle = getCurrentCycleAndExecutorInstanceMask(opIdx).cycle;
             } else {
@@ -845,7 +844,7 @@ void FeasibleMemoryScheduler::prefetchOps(ArrayRef<std::pair<operationIdxType, s
             // need to allocate more buffers
             buffersToAllocate = std::move(operationBuffers);
 
-            if (_readyDataOps.find(opIdx) != _readyDataOps.end()) {
+            if (_readyDataOps.contains(opIdx)) {
                 // schedule prefetch op
                 _log.nest().trace("Scheduling prefetch op: '{0}'", opIdx);
                 scheduleOp(opIdx, EOpType::ORIGINAL_PREFETCHED_OP);
@@ -898,12 +897,12 @@ void FeasibleMemoryScheduler::scheduleComputeOps() {
     // find compute ops to schedule
 
     for (auto& queue : _computeOpOrder) {
-        auto firstOpInQueue = queue.second.begin();
-        if (firstOpInQueue == queue.second.end()) {
+        if (queue.second.empty()) {
             // no ops on queue left
             continue;
         }
-        if (_readyComputeOps.find(*firstOpInQueue) == _readyComputeOps.end()) {
+        const auto firstOpInQueue = queue.second.front();
+        if (!_readyComputeOps.contains(firstOpInQueue)) {
             // operation not ready
             continue;
         }
@@ -912,7 +911,7 @@ void FeasibleMemoryScheduler::scheduleComputeOps() {
             continue;
         }
 
-        auto operationBuffers = getBuffersToAllocateForOp(*firstOpInQueue);
+        auto operationBuffers = getBuffersToAllocateForOp(firstOpInQueue);
         operationBuffers.insert(buffersToAllocate.begin(), buffersToAllocate.end());
         if (!canAllocBuffers(operationBuffers)) {
             // operation does not fit in memory
@@ -921,9 +920,9 @@ void FeasibleMemoryScheduler::scheduleComputeOps() {
 
         // op will be scheduled
         buffersToAllocate = std::move(operationBuffers);
-        computeOpIdxToSchedule.push_back(*firstOpInQueue);
-        _log.trace("Compute op to schedule: '{0}'", *firstOpInQueue);
-        queue.second.erase(firstOpInQueue);
+        computeOpIdxToSchedule.push_back(firstOpInQueue);
+        _log.trace("Compute op to schedule: '{0}'", firstOpInQueue);
+        queue.second.pop();
     }
 
     // schedule compute ops
@@ -989,7 +988,8 @@ void FeasibleMemoryScheduler::scheduleNonComputeOps() {
 
     // schedule operation not belonging to main network compute chain as soon as they become
     // ready so that they execute in the next available cycle since they are not prefetched
-    for (auto& readyOpIdx : llvm::make_early_inc_range(_nonComputeChainOps)) {
+    // iterate over a copy, scheduled operations are removed from the list
+    for (auto readyOpIdx : to_small_vector(_nonComputeChainOps)) {
         // Scheduling such operations can only happen once all input dependencies
         // (both data and compute ops) have already been executed. This is different
         // to standard compute op which as part of its scheduling can force scheduling
@@ -1210,7 +1210,10 @@ void FeasibleMemoryScheduler::forceScheduleActiveOpEviction() {
         _log.error("Scheduler cannot schedule anything and there is no buffer to spill");
         _log.error("Next operations to schedule:");
         for (auto& nextOp : _computeOpOrder) {
-            _log.nest().error("opIdx: {0}, on: {1}", *nextOp.second.begin(), nextOp.first.execKind);
+            if (nextOp.second.empty()) {
+                continue;
+            }
+            _log.nest().error("opIdx: {0}, on: {1}", nextOp.second.front(), nextOp.first.execKind);
         }
         _log.error("Ready operations:");
         for (auto& readyOp : _readyComputeOps) {
@@ -1407,7 +1410,7 @@ bool FeasibleMemoryScheduler::init() {
             _opLevelVec[depInd] = level;
         }
 
-        _computeOpOrder[queueType].push_back(computeOpIdx);
+        _computeOpOrder[queueType].ops.push_back(computeOpIdx);
         ++level;
     }
 
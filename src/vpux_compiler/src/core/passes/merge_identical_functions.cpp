@@ -0,0 +1,115 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/compiler/core/passes.hpp"
+
+#include "vpux/utils/core/small_vector.hpp"
+
+#include <mlir/Dialect/Func/IR/FuncOps.h>
+#include <mlir/IR/OperationSupport.h>
+#include <mlir/IR/SymbolTable.h>
+
+#include <llvm/ADT/MapVector.h>
+
+using namespace vpux;
+
+namespace {
+
+// Cheap fingerprint used to bucket the candidates, the equivalence itself is checked by `areEquivalent`
+llvm::hash_code hashFunction(mlir::func::FuncOp funcOp) {
+    auto hash = mlir::hash_value(funcOp.getFunctionType());
+    funcOp.getBody().walk([&](mlir::Operation* op) {
+        hash = llvm::hash_combine(hash, op->getName(), op->getNumOperands(), op->getNumRegions());
+        for (auto type : op->getResultTypes()) {
+            hash = llvm::hash_combine(hash, type);
+        }
+    });
+    return hash;
+}
+
+SmallVector<mlir::NamedAttribute> getComparableAttrs(mlir::func::FuncOp funcOp) {
+    SmallVector<mlir::NamedAttribute> attrs;
+    for (const auto& attr : funcOp->getAttrs()) {
+        if (attr.getName() == funcOp.getSymNameAttrName() || attr.getName() == funcOp.getSymVisibilityAttrName()) {
+            continue;
+        }
+        attrs.push_back(attr);
+    }
+    return attrs;
+}
+
+bool areEquivalent(mlir::func::FuncOp lhs, mlir::func::FuncOp rhs) {
+    if (getComparableAttrs(lhs) != getComparableAttrs(rhs)) {
+        return false;
+    }
+    return mlir::OperationEquivalence::isRegionEquivalentTo(&lhs.getBody(), &rhs.getBody(),
+                                                            mlir::OperationEquivalence::IgnoreLocations);
+}
+
+//
+// MergeIdenticalFunctionsPass
+//
+
+class MergeIdenticalFunctionsPass final : public MergeIdenticalFunctionsBase<MergeIdenticalFunctionsPass> {
+public:
+    explicit MergeIdenticalFunctionsPass(Logger log) {
+        Base::initLogger(log, Base::getArgumentName());
+    }
+
+private:
+    void safeRunOnModule() final;
+};
+
+void MergeIdenticalFunctionsPass::safeRunOnModule() {
+    auto moduleOp = getOperation();
+
+    // The module order is kept, so that the first function of each group is the one which is kept
+    llvm::MapVector<llvm::hash_code, SmallVector<mlir::func::FuncOp>> candidates;
+    for (auto funcOp : moduleOp.getOps<mlir::func::FuncOp>()) {
+        if (!funcOp.isPrivate() || funcOp.isExternal()) {
+            continue;
+        }
+        candidates[hashFunction(funcOp)].push_back(funcOp);
+    }
+
+    SmallVector<mlir::func::FuncOp> mergedFuncs;
+    for (auto& [hash, funcs] : candidates) {
+        std::ignore = hash;
+
+        SmallVector<mlir::func::FuncOp> uniqueFuncs;
+        for (auto funcOp : funcs) {
+            const auto it = llvm::find_if(uniqueFuncs, [&](mlir::func::FuncOp uniqueFunc) {
+                return areEquivalent(uniqueFunc, funcOp);
+            });
+            if (it == uniqueFuncs.end()) {
+                uniqueFuncs.push_back(funcOp);
+                continue;
+            }
+
+            _log.trace("Function '@{0}' is identical to '@{1}'", funcOp.getSymName(), it->getSymName());
+            if (mlir::failed(mlir::SymbolTable::replaceAllSymbolUses(funcOp, it->getSymNameAttr(), moduleOp))) {
+                _log.warning("Failed to redirect the uses of '@{0}' to '@{1}'", funcOp.getSymName(), it->getSymName());
+                continue;
+            }
+            mergedFuncs.push_back(funcOp);
+        }
+    }
+
+    for (auto funcOp : mergedFuncs) {
+        funcOp.erase();
+    }
+
+    _log.debug("Merged {0} identical functions", mergedFuncs.size());
+}
+
+}  // namespace
+
+//
+// createMergeIdenticalFunctionsPass
+//
+
+std::unique_ptr<mlir::Pass> vpux::createMergeIdenticalFunctionsPass(Logger log) {
+    return std::make_unique<MergeIdenticalFunctionsPass>(log);
+}
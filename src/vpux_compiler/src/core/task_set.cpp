@@ -0,0 +1,500 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/compiler/core/task_set.hpp"
+
+#include "vpux/utils/core/error.hpp"
+
+#include <llvm/Support/MathExtras.h>
+
+#include <algorithm>
+
+using namespace vpux;
+
+namespace {
+
+// Sets are converted back to the vector representation only once they are well below SMALL_SIZE, so that a set
+// oscillating around the threshold does not switch representation on every insert/erase
+constexpr size_t DEMOTE_SIZE = TaskSet::SMALL_SIZE / 2;
+
+}  // namespace
+
+//
+// TaskSet::Chunk
+//
+
+bool TaskSet::Chunk::none() const {
+    return std::all_of(words.begin(), words.end(), [](uint64_t word) {
+        return word == 0;
+    });
+}
+
+size_t TaskSet::Chunk::count() const {
+    size_t result = 0;
+    for (auto word : words) {
+        result += llvm::countPopulation(word);
+    }
+    return result;
+}
+
+size_t TaskSet::Chunk::findNext(size_t bit) const {
+    for (auto wordInd = bit / WORD_BITS; wordInd < WORDS_PER_CHUNK; ++wordInd) {
+        auto word = words[wordInd];
+        if (wordInd == bit / WORD_BITS) {
+            word &= ~uint64_t(0) << (bit % WORD_BITS);
+        }
+        if (word != 0) {
+            return wordInd * WORD_BITS + llvm::countTrailingZeros(word);
+        }
+    }
+    return CHUNK_BITS;
+}
+
+size_t TaskSet::Chunk::findLast() const {
+    for (auto wordInd = WORDS_PER_CHUNK; wordInd-- > 0;) {
+        if (words[wordInd] != 0) {
+            return wordInd * WORD_BITS + (WORD_BITS - 1 - llvm::countLeadingZeros(words[wordInd]));
+        }
+    }
+    return CHUNK_BITS;
+}
+
+//
+// TaskSet::const_iterator
+//
+
+TaskSet::const_iterator::const_iterator(const TaskSet* set, size_t pos, size_t bit): _set(set), _pos(pos), _bit(bit) {
+    updateValue();
+}
+
+void TaskSet::const_iterator::updateValue() {
+    if (!_set->_isLarge) {
+        _value = _pos < _set->_small.size() ? _set->_small[_pos] : 0;
+    } else {
+        _value = _pos < _set->_chunks.size() ? _set->_chunks[_pos].index * CHUNK_BITS + _bit : 0;
+    }
+}
+
+TaskSet::const_iterator& TaskSet::const_iterator::operator++() {
+    if (!_set->_isLarge) {
+        ++_pos;
+        updateValue();
+        return *this;
+    }
+
+    const auto next = _set->_chunks[_pos].findNext(_bit + 1);
+    if (next != CHUNK_BITS) {
+        _bit = next;
+        updateValue();
+        return *this;
+    }
+
+    // Empty chunks are never stored, so the next chunk always has a set bit
+    ++_pos;
+    _bit = _pos < _set->_chunks.size() ? _set->_chunks[_pos].findNext(0) : 0;
+    updateValue();
+    return *this;
+}
+
+TaskSet::const_iterator TaskSet::const_iterator::operator++(int) {
+    auto prev = *this;
+    ++*this;
+    return prev;
+}
+
+//
+// TaskSet
+//
+
+TaskSet::TaskSet(std::initializer_list<size_t> values) {
+    insert(values.begin(), values.end());
+}
+
+void TaskSet::clear() {
+    _isLarge = false;
+    _size = 0;
+    _small.clear();
+    _chunks.clear();
+}
+
+TaskSet::const_iterator TaskSet::begin() const {
+    if (!_isLarge || _chunks.empty()) {
+        return const_iterator(this, 0, 0);
+    }
+    return const_iterator(this, 0, _chunks.front().findNext(0));
+}
+
+TaskSet::const_iterator TaskSet::end() const {
+    if (!_isLarge) {
+        return const_iterator(this, _small.size(), 0);
+    }
+    return const_iterator(this, _chunks.size(), 0);
+}
+
+size_t TaskSet::front() const {
+    VPUX_THROW_WHEN(empty(), "Can't get the first element of an empty TaskSet");
+    return *begin();
+}
+
+size_t TaskSet::back() const {
+    VPUX_THROW_WHEN(empty(), "Can't get the last element of an empty TaskSet");
+    if (!_isLarge) {
+        return _small.back();
+    }
+    return _chunks.back().index * CHUNK_BITS + _chunks.back().findLast();
+}
+
+size_t TaskSet::findChunk(size_t chunkIndex) const {
+    const auto it = std::lower_bound(_chunks.begin(), _chunks.end(), chunkIndex, [](const Chunk& chunk, size_t index) {
+        return chunk.index < index;
+    });
+    return static_cast<size_t>(std::distance(_chunks.begin(), it));
+}
+
+bool TaskSet::hasChunk(size_t pos, size_t chunkIndex) const {
+    return pos < _chunks.size() && _chunks[pos].index == chunkIndex;
+}
+
+bool TaskSet::contains(size_t value) const {
+    if (!_isLarge) {
+        return std::binary_search(_small.begin(), _small.end(), value);
+    }
+
+    const auto pos = findChunk(value / CHUNK_BITS);
+    return hasChunk(pos, value / CHUNK_BITS) && _chunks[pos].test(value % CHUNK_BITS);
+}
+
+std::pair<TaskSet::const_iterator, bool> TaskSet::insert(size_t value) {
+    if (!_isLarge) {
+        const auto it = std::lower_bound(_small.begin(), _small.end(), value);
+        const auto pos = static_cast<size_t>(std::distance(_small.begin(), it));
+        if (it != _small.end() && *it == value) {
+            return {const_iterator(this, pos, 0), false};
+        }
+        if (_small.size() < SMALL_SIZE) {
+            _small.insert(it, value);
+            ++_size;
+            return {const_iterator(this, pos, 0), true};
+        }
+        convertToLarge();
+    }
+
+    const auto chunkIndex = value / CHUNK_BITS;
+    const auto bit = value % CHUNK_BITS;
+    const auto pos = findChunk(chunkIndex);
+    if (!hasChunk(pos, chunkIndex)) {
+        Chunk chunk;
+        chunk.index = chunkIndex;
+        _chunks.insert(_chunks.begin() + pos, chunk);
+    }
+
+    auto& word = _chunks[pos].words[bit / WORD_BITS];
+    const auto mask = uint64_t(1) << (bit % WORD_BITS);
+    const auto inserted = (word & mask) == 0;
+    word |= mask;
+    if (inserted) {
+        ++_size;
+    }
+    return {const_iterator(this, pos, bit), inserted};
+}
+
+bool TaskSet::erase(size_t value) {
+    if (!_isLarge) {
+        const auto it = std::lower_bound(_small.begin(), _small.end(), value);
+        if (it == _small.end() || *it != value) {
+            return false;
+        }
+        _small.erase(it);
+        --_size;
+        return true;
+    }
+
+    const auto chunkIndex = value / CHUNK_BITS;
+    const auto pos = findChunk(chunkIndex);
+    if (!hasChunk(pos, chunkIndex)) {
+        return false;
+    }
+
+    const auto bit = value % CHUNK_BITS;
+    auto& word = _chunks[pos].words[bit / WORD_BITS];
+    const auto mask = uint64_t(1) << (bit % WORD_BITS);
+    if ((word & mask) == 0) {
+        return false;
+    }
+    word &= ~mask;
+    --_size;
+
+    if (_chunks[pos].none()) {
+        _chunks.erase(_chunks.begin() + pos);
+    }
+    convertToSmallIfNeeded();
+    return true;
+}
+
+void TaskSet::convertToLarge() {
+    VPUX_THROW_WHEN(_isLarge, "TaskSet is already in the chunked representation");
+
+    for (auto value : _small) {
+        const auto chunkIndex = value / CHUNK_BITS;
+        if (_chunks.empty() || _chunks.back().index != chunkIndex) {
+            Chunk chunk;
+            chunk.index = chunkIndex;
+            _chunks.push_back(chunk);
+        }
+        const auto bit = value % CHUNK_BITS;
+        _chunks.back().words[bit / WORD_BITS] |= uint64_t(1) << (bit % WORD_BITS);
+    }
+
+    _small.clear();
+    _isLarge = true;
+}
+
+void TaskSet::convertToSmallIfNeeded() {
+    if (!_isLarge || _size > DEMOTE_SIZE) {
+        return;
+    }
+
+    SmallVector<size_t, SMALL_SIZE> values(begin(), end());
+    _chunks.clear();
+    _isLarge = false;
+    _small = std::move(values);
+}
+
+void TaskSet::removeEmptyChunks() {
+    _chunks.erase(std::remove_if(_chunks.begin(), _chunks.end(),
+                                 [](const Chunk& chunk) {
+                                     return chunk.none();
+                                 }),
+                  _chunks.end());
+}
+
+//
+// Bulk operations
+//
+
+bool TaskSet::setUnion(const TaskSet& other) {
+    if (other.empty() || this == &other) {
+        return false;
+    }
+
+    if (!other._isLarge) {
+        const auto prevSize = _size;
+        insert(other._small.begin(), other._small.end());
+        return _size != prevSize;
+    }
+
+    if (!_isLarge) {
+        if (_size + other._size <= SMALL_SIZE) {
+            const auto prevSize = _size;
+            insert(other.begin(), other.end());
+            return _size != prevSize;
+        }
+        convertToLarge();
+    }
+
+    // Merge the two sorted chunk lists
+    SmallVector<Chunk, 0> merged;
+    merged.reserve(_chunks.size() + other._chunks.size());
+
+    size_t newSize = 0;
+    auto lhsIt = _chunks.begin();
+    auto rhsIt = other._chunks.begin();
+    while (lhsIt != _chunks.end() || rhsIt != other._chunks.end()) {
+        if (rhsIt == other._chunks.end() || (lhsIt != _chunks.end() && lhsIt->index < rhsIt->index)) {
+            merged.push_back(*lhsIt++);
+        } else if (lhsIt == _chunks.end() || rhsIt->index < lhsIt->index) {
+            merged.push_back(*rhsIt++);
+        } else {
+            merged.push_back(*lhsIt++);
+            for (size_t wordInd = 0; wordInd < WORDS_PER_CHUNK; ++wordInd) {
+                merged.back().words[wordInd] |= rhsIt->words[wordInd];
+            }
+            ++rhsIt;
+        }
+        newSize += merged.back().count();
+    }
+
+    const auto changed = newSize != _size;
+    _chunks = std::move(merged);
+    _size = newSize;
+    return changed;
+}
+
+void TaskSet::setIntersect(const TaskSet& other) {
+    if (this == &other) {
+        return;
+    }
+
+    if (!_isLarge || !other._isLarge) {
+        SmallVector<size_t, SMALL_SIZE> values;
+        if (!_isLarge) {
+            for (auto value : _small) {
+                if (other.contains(value)) {
+                    values.push_back(value);
+                }
+            }
+        } else {
+            for (auto value : other._small) {
+                if (contains(value)) {
+                    values.push_back(value);
+                }
+            }
+        }
+
+        // The result is never larger than the smaller of the two sets, which is in the vector representation here
+        clear();
+        _small = std::move(values);
+        _size = _small.size();
+        return;
+    }
+
+    size_t newSize = 0;
+    auto rhsIt = other._chunks.begin();
+    for (auto& chunk : _chunks) {
+        while (rhsIt != other._chunks.end() && rhsIt->index < chunk.index) {
+            ++rhsIt;
+        }
+        if (rhsIt == other._chunks.end() || rhsIt->index != chunk.index) {
+            chunk.words = {};
+            continue;
+        }
+        for (size_t wordInd = 0; wordInd < WORDS_PER_CHUNK; ++wordInd) {
+            chunk.words[wordInd] &= rhsIt->words[wordInd];
+        }
+        newSize += chunk.count();
+    }
+
+    _size = newSize;
+    removeEmptyChunks();
+    convertToSmallIfNeeded();
+}
+
+void TaskSet::setSubtract(const TaskSet& other) {
+    if (this == &other) {
+        clear();
+        return;
+    }
+
+    if (!_isLarge) {
+        _small.erase(std::remove_if(_small.begin(), _small.end(),
+                                    [&](size_t value) {
+                                        return other.contains(value);
+                                    }),
+                     _small.end());
+        _size = _small.size();
+        return;
+    }
+
+    if (!other._isLarge) {
+        for (auto value : other._small) {
+            const auto pos = findChunk(value / CHUNK_BITS);
+            if (!hasChunk(pos, value / CHUNK_BITS)) {
+                continue;
+            }
+            const auto bit = value % CHUNK_BITS;
+            auto& word = _chunks[pos].words[bit / WORD_BITS];
+            const auto mask = uint64_t(1) << (bit % WORD_BITS);
+            if ((word & mask) != 0) {
+                word &= ~mask;
+                --_size;
+            }
+        }
+    } else {
+        size_t newSize = 0;
+        auto rhsIt = other._chunks.begin();
+        for (auto& chunk : _chunks) {
+            while (rhsIt != other._chunks.end() && rhsIt->index < chunk.index) {
+                ++rhsIt;
+            }
+            if (rhsIt != other._chunks.end() && rhsIt->index == chunk.index) {
+                for (size_t wordInd = 0; wordInd < WORDS_PER_CHUNK; ++wordInd) {
+                    chunk.words[wordInd] &= ~rhsIt->words[wordInd];
+                }
+            }
+            newSize += chunk.count();
+        }
+        _size = newSize;
+    }
+
+    removeEmptyChunks();
+    convertToSmallIfNeeded();
+}
+
+bool TaskSet::intersects(const TaskSet& other) const {
+    if (empty() || other.empty()) {
+        return false;
+    }
+
+    if (!_isLarge || !other._isLarge) {
+        const auto& smallSet = !_isLarge ? *this : other;
+        const auto& otherSet = !_isLarge ? other : *this;
+        return std::any_of(smallSet._small.begin(), smallSet._small.end(), [&](size_t value) {
+            return otherSet.contains(value);
+        });
+    }
+
+    auto rhsIt = other._chunks.begin();
+    for (const auto& chunk : _chunks) {
+        while (rhsIt != other._chunks.end() && rhsIt->index < chunk.index) {
+            ++rhsIt;
+        }
+        if (rhsIt == other._chunks.end()) {
+            return false;
+        }
+        if (rhsIt->index != chunk.index) {
+            continue;
+        }
+        for (size_t wordInd = 0; wordInd < WORDS_PER_CHUNK; ++wordInd) {
+            if ((chunk.words[wordInd] & rhsIt->words[wordInd]) != 0) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+bool TaskSet::isSubsetOf(const TaskSet& other) const {
+    if (_size > other._size) {
+        return false;
+    }
+
+    if (!_isLarge) {
+        return std::all_of(_small.begin(), _small.end(), [&](size_t value) {
+            return other.contains(value);
+        });
+    }
+
+    if (!other._isLarge) {
+        return std::all_of(begin(), end(), [&](size_t value) {
+            return other.contains(value);
+        });
+    }
+
+    auto rhsIt = other._chunks.begin();
+    for (const auto& chunk : _chunks) {
+        while (rhsIt != other._chunks.end() && rhsIt->index < chunk.index) {
+            ++rhsIt;
+        }
+        if (rhsIt == other._chunks.end() || rhsIt->index != chunk.index) {
+            return false;
+        }
+        for (size_t wordInd = 0; wordInd < WORDS_PER_CHUNK; ++wordInd) {
+            if ((chunk.words[wordInd] & ~rhsIt->words[wordInd]) != 0) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+bool TaskSet::operator==(const TaskSet& other) const {
+    if (_size != other._size) {
+        return false;
+    }
+    if (_isLarge && other._isLarge) {
+        return _chunks == other._chunks;
+    }
+    return std::equal(begin(), end(), other.begin());
+}
@@ -250,6 +250,10 @@ mlir::LogicalResult WeightsDequantizeStructureInfo::initializeStructure(Const::D
 
     inputElemBaseType = initialInputElemStorageType = inputElemConvertType =
             inputAttr.getBaseContent().getShapedType().getElementType();
+    // U4 and I4 constants shared with OpenVINO keep the packed data in the base content
+    if (inputElemBaseType.isInteger(4)) {
+        inputVirtualI4ElemType = inputElemBaseType;
+    }
 
     // since U4 and I4 aren't aren't fully supported, they are represented through ConvertElemType transforms
     for (const auto& attr : inputAttr.getTransformations()) {
@@ -294,6 +294,10 @@ void StrategyManagerImplPass::safeRunOnFunc() {
     };
 
     func.walk(setStrategyCallback);
+
+    const auto cacheStats = _costModel->getCacheStatistics();
+    _log.trace("VPUNN cost cache: {0} hits, {1} misses, hit rate {2}, {3} entries", cacheStats.numHits,
+               cacheStats.numMisses, cacheStats.getHitRate(), cacheStats.numEntries);
 }
 
 }  // namespace
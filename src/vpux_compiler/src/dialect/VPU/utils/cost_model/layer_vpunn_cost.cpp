@@ -39,6 +39,15 @@ void MultiClusterStrategySetter::setTemporaryStrategy(VPU::MultiClusterStrategy
 }
 
 StrategyCost LayerVPUNNCost::getStrategyCost(mlir::Operation* operation, const VPUNNCostParameters& parameters) const {
+    VPUNNWorkloadKey key(operation, parameters._strategy, parameters._tiling, parameters._mode,
+                         parameters._operandsTiling);
+    return _costCache->getOrCompute(std::move(key), [&] {
+        return computeStrategyCost(operation, parameters);
+    });
+}
+
+StrategyCost LayerVPUNNCost::computeStrategyCost(mlir::Operation* operation,
+                                                 const VPUNNCostParameters& parameters) const {
     if (mlir::isa<VPU::NCEPermuteOp>(operation)) {
         return getSimpleLayerCost(operation->getResult(0).getType().cast<vpux::NDTypeInterface>(), parameters);
     } else if (auto nceOp = mlir::dyn_cast<VPU::NCEOpInterface>(operation)) {
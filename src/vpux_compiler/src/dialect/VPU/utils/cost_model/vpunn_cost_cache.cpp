@@ -0,0 +1,127 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/compiler/dialect/VPU/utils/cost_model/vpunn_cost_cache.hpp"
+#include "vpux/compiler/dialect/VPU/utils/manual_strategy_utils.hpp"
+
+#include "vpux/utils/core/range.hpp"
+
+#include <llvm/ADT/Hashing.h>
+
+#include <algorithm>
+
+using namespace vpux;
+using namespace VPU;
+
+namespace {
+
+bool isTileEqual(const TileInfo& lhs, const TileInfo& rhs) {
+    return lhs == rhs && lhs.isCompletedTile == rhs.isCompletedTile;
+}
+
+bool isTilingEqual(ArrayRef<TileInfo> lhs, ArrayRef<TileInfo> rhs) {
+    return lhs.size() == rhs.size() && std::equal(lhs.begin(), lhs.end(), rhs.begin(), isTileEqual);
+}
+
+llvm::hash_code hashTile(const TileInfo& tile) {
+    return llvm::hash_combine(llvm::hash_combine_range(tile.shape.begin(), tile.shape.end()),
+                              llvm::hash_combine_range(tile.offsets.begin(), tile.offsets.end()),
+                              llvm::hash_combine_range(tile.axis.begin(), tile.axis.end()), tile.isCompletedTile);
+}
+
+llvm::hash_code hashTiling(ArrayRef<TileInfo> tiling) {
+    auto hash = llvm::hash_value(tiling.size());
+    for (const auto& tile : tiling) {
+        hash = llvm::hash_combine(hash, hashTile(tile));
+    }
+    return hash;
+}
+
+}  // namespace
+
+//
+// VPUNNWorkloadKey
+//
+
+VPUNNWorkloadKey::VPUNNWorkloadKey(mlir::Operation* operation, VPU::MultiClusterStrategy strategy,
+                                   const OutputTiling& tiling, TilingMode mode,
+                                   ArrayRef<SmallVector<TileInfo>> operandsTiling)
+        : name(operation->getName()),
+          operandTypes(to_small_vector(operation->getOperandTypes())),
+          resultTypes(to_small_vector(operation->getResultTypes())),
+          strategy(strategy),
+          mode(mode),
+          tiling(tiling),
+          operandsTiling(operandsTiling.begin(), operandsTiling.end()) {
+    for (const auto& attr : operation->getAttrs()) {
+        const auto attrName = attr.getName().getValue();
+        if (attrName == vpux::multiClusterStrategy || attrName == vpux::tilingStrategy) {
+            continue;
+        }
+        attrs.push_back(attr);
+    }
+}
+
+bool VPUNNWorkloadKey::operator==(const VPUNNWorkloadKey& other) const {
+    return name == other.name && strategy == other.strategy && mode == other.mode && attrs == other.attrs &&
+           operandTypes == other.operandTypes && resultTypes == other.resultTypes &&
+           isTilingEqual(tiling, other.tiling) &&
+           std::equal(operandsTiling.begin(), operandsTiling.end(), other.operandsTiling.begin(),
+                      other.operandsTiling.end(), [](const auto& lhs, const auto& rhs) {
+                          return isTilingEqual(lhs, rhs);
+                      });
+}
+
+size_t VPUNNWorkloadKeyHash::operator()(const VPUNNWorkloadKey& key) const {
+    auto hash = llvm::hash_combine(key.name, key.strategy, key.mode,
+                                   llvm::hash_combine_range(key.operandTypes.begin(), key.operandTypes.end()),
+                                   llvm::hash_combine_range(key.resultTypes.begin(), key.resultTypes.end()),
+                                   hashTiling(key.tiling));
+    for (const auto& attr : key.attrs) {
+        hash = llvm::hash_combine(hash, attr.getName(), attr.getValue());
+    }
+    for (const auto& operandTiling : key.operandsTiling) {
+        hash = llvm::hash_combine(hash, hashTiling(operandTiling));
+    }
+    return hash;
+}
+
+//
+// VPUNNCostCache
+//
+
+std::optional<StrategyCost> VPUNNCostCache::find(const VPUNNWorkloadKey& key) {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        const auto it = _costs.find(key);
+        if (it != _costs.end()) {
+            ++_numHits;
+            return it->second;
+        }
+    }
+    ++_numMisses;
+    return std::nullopt;
+}
+
+void VPUNNCostCache::insert(VPUNNWorkloadKey key, StrategyCost cost) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _costs.try_emplace(std::move(key), cost);
+}
+
+VPUNNCostCache::Statistics VPUNNCostCache::getStatistics() const {
+    Statistics stats;
+    stats.numHits = _numHits;
+    stats.numMisses = _numMisses;
+    std::lock_guard<std::mutex> lock(_mutex);
+    stats.numEntries = _costs.size();
+    return stats;
+}
+
+void VPUNNCostCache::clear() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _costs.clear();
+    _numHits = 0;
+    _numMisses = 0;
+}
@@ -13,15 +13,23 @@ using namespace vpux;
 //
 
 void VPUASM::ConstBufferOp::serialize(elf::writer::BinaryDataSection<uint8_t>& binDataSection) {
+    const auto size = getBinarySize();
+    auto ptr = reinterpret_cast<uint8_t*>(binDataSection.expandData(size));
+    serializeToBuffer(MutableArrayRef<uint8_t>(ptr, size));
+}
+
+bool VPUASM::ConstBufferOp::supportsBufferSerialization() {
+    return true;
+}
+
+void VPUASM::ConstBufferOp::serializeToBuffer(MutableArrayRef<uint8_t> buffer) {
     vpux::Const::Content cnt = getContent();
 
-    const auto size = cnt.getType().getTotalAllocSize().count();
-    auto tmpBuf = std::make_unique<char[]>(size);
-    MutableArrayRef<char> buf(tmpBuf.get(), size);
-    cnt.copyTo(buf);
+    const auto size = checked_cast<size_t>(cnt.getType().getTotalAllocSize().count());
+    VPUX_THROW_UNLESS(buffer.size() == size, "Buffer size {0} does not match the constant size {1}", buffer.size(),
+                      size);
 
-    auto ptrCharTmp = reinterpret_cast<uint8_t*>(tmpBuf.get());
-    binDataSection.appendData(ptrCharTmp, getBinarySize());
+    cnt.copyTo(MutableArrayRef<char>(reinterpret_cast<char*>(buffer.data()), buffer.size()));
 }
 
 size_t VPUASM::ConstBufferOp::getBinarySize() {
@@ -7,94 +7,66 @@
 #include "vpux/compiler/dialect/VPUIP/IR/ops.hpp"
 #include "vpux/compiler/dialect/VPUIP/transforms/passes.hpp"
 #include "vpux/compiler/dialect/VPURT/IR/ops.hpp"
+#include "vpux/compiler/dialect/const/utils/resource_blobs.hpp"
 #include "vpux/compiler/utils/codec_factory.hpp"
 #include "vpux/compiler/utils/compression_utils.hpp"
 #include "vpux/compiler/utils/rewriter.hpp"
 #include "vpux/compiler/utils/swizzling_utils.hpp"
 #include "vpux/compiler/utils/types.hpp"
 
-using namespace vpux;
-
-namespace {
+#include <mlir/IR/Threading.h>
 
-//
-// CompressWeightsBTCPass
-//
+#include <cstring>
+#include <exception>
+#include <functional>
+#include <mutex>
 
-class CompressWeightsBTCPass final : public VPUIP::CompressWeightsBTCBase<CompressWeightsBTCPass> {
-public:
-    explicit CompressWeightsBTCPass(Logger log) {
-        Base::initLogger(log, Base::getArgumentName());
-    }
+using namespace vpux;
 
-private:
-    void safeRunOnFunc() final;
-};
+namespace {
 
 //
-// NNDMAOpConverter
+// CompressedWeights
 //
 
-class NNDMAOpConverter final : public mlir::OpRewritePattern<VPUIP::NNDMAOp> {
-public:
-    NNDMAOpConverter(mlir::MLIRContext* ctx, const ICodec::CompressionAlgorithm& algo, VPU::ArchKind arch, Logger log)
-            : mlir::OpRewritePattern<VPUIP::NNDMAOp>(ctx), _log(log), _codec(vpux::makeCodec(algo, arch)) {
-    }
-
-public:
-    mlir::LogicalResult matchAndRewrite(VPUIP::NNDMAOp origOp, mlir::PatternRewriter& rewriter) const final;
-
-private:
-    ICodec::CompressionMode getCompressionMode(Const::DeclareOp constOp) const;
-
-    Logger _log;
-    const std::unique_ptr<ICodec> _codec;
-    mlir::FailureOr<std::vector<uint8_t>> compressDataFromDeclareOp(Const::DeclareOp constOp,
-                                                                    ICodec::CompressionMode compressionMode) const;
+// The result of compressing the constant input of one DMA, computed before the IR is rewritten. The rewrite driver
+// may fold or deduplicate the constant operations in the meantime, so the constant is identified by its content
+struct CompressedWeights {
+    VPUIP::NNDMAOp dmaOp;
+    Const::ContentAttr contentAttr;
+    Byte totalInputSize;
+    ICodec::CompressionMode compressionMode;
+    // Compressed data in its final storage, null if the weights are not worth compressing
+    mlir::ElementsAttr compressedContent;
 };
 
-ICodec::CompressionMode NNDMAOpConverter::getCompressionMode(Const::DeclareOp constOp) const {
-    if (!_codec->supportsFP16compression()) {
-        return ICodec::CompressionMode::UINT8;
-    }
-
-    const auto inputElementType = constOp.getType().cast<vpux::NDTypeInterface>().getElementType();
-    return inputElementType.isF16() ? ICodec::CompressionMode::FP16 : ICodec::CompressionMode::UINT8;
-}
-
-mlir::FailureOr<std::vector<uint8_t>> NNDMAOpConverter::compressDataFromDeclareOp(
-        Const::DeclareOp constOp, ICodec::CompressionMode compressionMode) const {
-    const auto content = constOp.getContent();
-    const Byte totalInputSize = getTotalSize(constOp);
-    std::vector<uint8_t> origData(checked_cast<size_t>(totalInputSize.count()));
-    content.copyTo(MutableArrayRef(reinterpret_cast<char*>(origData.data()), origData.size()));
+using CompressedWeightsMap = llvm::DenseMap<mlir::Operation*, const CompressedWeights*>;
 
-    return _codec->compress(origData, compressionMode, _log);
-}
+// Constants of at least this size are encoded one at a time with their blocks split into parallel tasks, the smaller
+// ones are encoded concurrently as one task each
+constexpr Byte BLOCK_PARALLEL_MIN_SIZE = 1_MB;
 
-mlir::LogicalResult NNDMAOpConverter::matchAndRewrite(VPUIP::NNDMAOp origOp, mlir::PatternRewriter& rewriter) const {
+bool isCompressionCandidate(VPUIP::NNDMAOp origOp, Logger log) {
     const auto loc = origOp->getLoc();
     auto input = origOp.getInput();
     auto output = origOp.getOutputBuff();
     const auto inputType = input.getType().cast<vpux::NDTypeInterface>();
     const auto outputType = output.getType().cast<vpux::NDTypeInterface>();
 
-    auto inConstOp = input.getDefiningOp<Const::DeclareOp>();
-    if (inConstOp == nullptr) {
-        return mlir::failure();
+    if (input.getDefiningOp<Const::DeclareOp>() == nullptr) {
+        return false;
     }
 
-    auto outBufferOp = output.getDefiningOp<VPURT::DeclareBufferOp>();
-    if (outBufferOp == nullptr) {
-        return mlir::failure();
+    if (output.getDefiningOp<VPURT::DeclareBufferOp>() == nullptr) {
+        return false;
     }
 
     if (outputType.getMemoryKind() != VPU::MemoryKind::CMX_NN) {
-        _log.nest().trace("CompressedDMA only support CONST2CMX");
-        return mlir::failure();
+        log.nest().trace("CompressedDMA only support CONST2CMX");
+        return false;
     }
 
-    _log.trace("Check if can change to compressed DMA, operation - '{0}'", loc);
+    log.trace("Check if can change to compressed DMA, operation - '{0}'", loc);
 
     const auto originInShape = inputType.getShape().raw();
     const auto originOutShape = outputType.getShape().raw();
@@ -103,8 +75,8 @@ mlir::LogicalResult NNDMAOpConverter::matchAndRewrite(VPUIP::NNDMAOp origOp, mli
     const auto strideOutReqs = StrideReqs::compact(originOutShape.size());
 
     if (!strideInReqs.checkStrides(input) || !strideOutReqs.checkStrides(output)) {
-        _log.nest().trace("Strides check failed");
-        return mlir::failure();
+        log.nest().trace("Strides check failed");
+        return false;
     }
 
     if (outputType.isa<VPUIP::DistributedBufferType>()) {
@@ -112,72 +84,180 @@ mlir::LogicalResult NNDMAOpConverter::matchAndRewrite(VPUIP::NNDMAOp origOp, mli
         const auto distributionAttr = distributedType.getDistribution();
         const auto distributionMode = distributionAttr.getMode().getValue();
         if (distributionMode != VPU::DistributionMode::DUPLICATED) {
-            _log.nest().trace("Only DUPLICATE Distributed mode supported, mode - '{0}'",
-                              VPU::stringifyDistributionMode(distributionMode));
-            return mlir::failure();
+            log.nest().trace("Only DUPLICATE Distributed mode supported, mode - '{0}'",
+                             VPU::stringifyDistributionMode(distributionMode));
+            return false;
         }
     }
 
-    const Byte totalInputSize = getTotalSize(origOp.getInput());
+    const Byte totalInputSize = getTotalSize(input);
     constexpr Byte MIN_INPUT_SIZE = 4_KB;
     if (totalInputSize < MIN_INPUT_SIZE) {
-        _log.nest().trace("Size smaller than minimal '{0}' < '{1}'", totalInputSize.count(), MIN_INPUT_SIZE.count());
-        return mlir::failure();
+        log.nest().trace("Size smaller than minimal '{0}' < '{1}'", totalInputSize.count(), MIN_INPUT_SIZE.count());
+        return false;
     }
 
-    auto compressionMode = getCompressionMode(inConstOp);
-    _log.trace("Compress constant '{0}', type - '{1}', compression mode: {2}", inConstOp->getLoc(), inputType,
-               ICodec::compressionModeToStr(compressionMode));
+    return true;
+}
 
-    const auto compressedDataOrFailure = compressDataFromDeclareOp(inConstOp, compressionMode);
+ICodec::CompressionMode getCompressionMode(const ICodec& codec, Const::DeclareOp constOp) {
+    if (!codec.supportsFP16compression()) {
+        return ICodec::CompressionMode::UINT8;
+    }
+
+    const auto inputElementType = constOp.getType().cast<vpux::NDTypeInterface>().getElementType();
+    return inputElementType.isF16() ? ICodec::CompressionMode::FP16 : ICodec::CompressionMode::UINT8;
+}
+
+// Folds and encodes the weights, the compressed data is copied into its final storage right away, so that only the
+// buffers of the constants being encoded are alive at the same time
+mlir::ElementsAttr compressContent(const ICodec& codec, const CompressedWeights& weights, Logger log) {
+    mlir::FailureOr<std::vector<uint8_t>> compressedDataOrFailure = mlir::failure();
+    {
+        const auto content = weights.contentAttr.fold();
+        std::vector<uint8_t> origData(checked_cast<size_t>(weights.totalInputSize.count()));
+        content.copyTo(MutableArrayRef(reinterpret_cast<char*>(origData.data()), origData.size()));
 
+        compressedDataOrFailure = codec.compress(origData, weights.compressionMode, log);
+    }
     if (mlir::failed(compressedDataOrFailure)) {
+        return nullptr;
+    }
+
+    const auto& compressedData = compressedDataOrFailure.value();
+    const auto copyCompressedData = [&](MutableArrayRef<char> buf) {
+        std::memcpy(buf.data(), compressedData.data(), buf.size());
+    };
+
+    auto* ctx = weights.contentAttr.getContext();
+    if (weights.compressionMode == ICodec::CompressionMode::UINT8) {
+        const auto storageType =
+                mlir::RankedTensorType::get({checked_cast<int64_t>(compressedData.size()), 1, 1, 1}, getUInt8Type(ctx));
+        return Const::createOwnedContent(storageType, compressedData.size(), copyCompressedData);
+    } else if (weights.compressionMode == ICodec::CompressionMode::FP16) {
+        auto f16Type = mlir::FloatType::getF16(ctx);
+        const auto f16TypeSizeBytes = f16Type.getWidth() / CHAR_BIT;
+        const auto numElements = compressedData.size() / f16TypeSizeBytes;
+        const auto storageType = mlir::RankedTensorType::get({checked_cast<int64_t>(numElements), 1, 1, 1}, f16Type);
+        return Const::createOwnedContent(storageType, numElements * f16TypeSizeBytes, copyCompressedData);
+    }
+    VPUX_THROW("Unsupported compression mode");
+}
+
+// Compresses the weights of all candidates on the context thread pool, exceptions are forwarded to the calling thread.
+// The large constants go first, one at a time with their blocks split into tasks on the same pool, so that a single
+// huge constant does not keep one thread busy while the others are idle. The remaining constants are then encoded
+// concurrently, each of them as one task
+void compressAll(mlir::MLIRContext* ctx, VPU::ArchKind arch, MutableArrayRef<CompressedWeights> candidates,
+                 Logger log) {
+    const auto algo = ICodec::CompressionAlgorithm::BITCOMPACTOR_CODEC;
+    const auto parallelFor = [ctx](size_t numTasks, const std::function<void(size_t)>& task) {
+        mlir::parallelFor(ctx, 0, numTasks, task);
+    };
+    const auto blockParallelCodec = vpux::makeCodec(algo, arch, parallelFor);
+    const auto codec = vpux::makeCodec(algo, arch);
+
+    // Start with the largest constants, so that the small ones balance the load at the end
+    llvm::stable_sort(candidates, [](const CompressedWeights& lhs, const CompressedWeights& rhs) {
+        return lhs.totalInputSize > rhs.totalInputSize;
+    });
+
+    const auto smallCandidates = llvm::find_if(candidates, [](const CompressedWeights& candidate) {
+        return candidate.totalInputSize < BLOCK_PARALLEL_MIN_SIZE;
+    });
+    for (auto& candidate : llvm::make_range(candidates.begin(), smallCandidates)) {
+        candidate.compressedContent = compressContent(*blockParallelCodec, candidate, log);
+    }
+
+    std::mutex errorMutex;
+    std::exception_ptr error;
+    mlir::parallelForEach(ctx, smallCandidates, candidates.end(), [&](CompressedWeights& candidate) {
+        try {
+            candidate.compressedContent = compressContent(*codec, candidate, log);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(errorMutex);
+            if (error == nullptr) {
+                error = std::current_exception();
+            }
+        }
+    });
+
+    if (error != nullptr) {
+        std::rethrow_exception(error);
+    }
+}
+
+//
+// CompressWeightsBTCPass
+//
+
+class CompressWeightsBTCPass final : public VPUIP::CompressWeightsBTCBase<CompressWeightsBTCPass> {
+public:
+    explicit CompressWeightsBTCPass(Logger log) {
+        Base::initLogger(log, Base::getArgumentName());
+    }
+
+private:
+    void safeRunOnFunc() final;
+};
+
+//
+// NNDMAOpConverter
+//
+
+class NNDMAOpConverter final : public mlir::OpRewritePattern<VPUIP::NNDMAOp> {
+public:
+    NNDMAOpConverter(mlir::MLIRContext* ctx, const CompressedWeightsMap& compressedWeights, Logger log)
+            : mlir::OpRewritePattern<VPUIP::NNDMAOp>(ctx), _log(log), _compressedWeights(compressedWeights) {
+    }
+
+public:
+    mlir::LogicalResult matchAndRewrite(VPUIP::NNDMAOp origOp, mlir::PatternRewriter& rewriter) const final;
+
+private:
+    Logger _log;
+    const CompressedWeightsMap& _compressedWeights;
+};
+
+mlir::LogicalResult NNDMAOpConverter::matchAndRewrite(VPUIP::NNDMAOp origOp, mlir::PatternRewriter& rewriter) const {
+    const auto compressedWeightsIt = _compressedWeights.find(origOp.getOperation());
+    if (compressedWeightsIt == _compressedWeights.end()) {
         return mlir::failure();
     }
-    const auto compressedData = compressedDataOrFailure.value();
-
-    const auto ctx = rewriter.getContext();
-    auto u8Type = getUInt8Type(ctx);
-    auto f16Type = mlir::FloatType::getF16(ctx);
-    auto newDstType = outputType;
-    mlir::MemRefType newSrcType;
-    mlir::DenseElementsAttr newSrcContentAttr;
-
-    if (compressionMode == ICodec::CompressionMode::UINT8) {
-        const Shape newDstShape{totalInputSize.count(), 1, 1, 1};
-        newDstType = mlir::isa<VPUIP::DistributedBufferType>(newDstType)
-                             ? VPU::changeShapeElemTypeForDuplicatedDistributedBuffers(newDstType, newDstShape, u8Type)
-                             : newDstType.changeShapeElemType(newDstShape, u8Type);
-
-        const Shape compressedDataShape{checked_cast<int64_t>(compressedData.size()), 1, 1, 1};
-        newSrcType = getMemRefType(compressedDataShape, u8Type, DimsOrder::NCHW, inputType.getMemSpace(),
-                                   /*strides=*/StridesRef(), getSwizzlingSchemeAttr(inputType));
-        newSrcType = mlir::cast<mlir::MemRefType>(
-                vpux::setCompressionState(newSrcType, VPUIP::CompressionState::CompiletimeCompressed));
-        const auto newSrcStorageType = mlir::RankedTensorType::get(compressedDataShape.raw(), u8Type);
-        newSrcContentAttr = mlir::DenseElementsAttr::get(newSrcStorageType, ArrayRef(compressedData));
-    } else if (compressionMode == ICodec::CompressionMode::FP16) {
-        unsigned f16TypeSizeBytes = f16Type.getWidth() / CHAR_BIT;
-        const Shape newDstShape{totalInputSize.count() / f16TypeSizeBytes, 1, 1, 1};
-        newDstType = mlir::isa<VPUIP::DistributedBufferType>(newDstType)
-                             ? VPU::changeShapeElemTypeForDuplicatedDistributedBuffers(newDstType, newDstShape, f16Type)
-                             : newDstType.changeShapeElemType(newDstShape, f16Type);
-
-        const Shape compressedDataShape{checked_cast<int64_t>(compressedData.size() / f16TypeSizeBytes), 1, 1, 1};
-        newSrcType = getMemRefType(compressedDataShape, f16Type, DimsOrder::NCHW, inputType.getMemSpace(),
-                                   /*strides=*/StridesRef(), getSwizzlingSchemeAttr(inputType));
-        newSrcType = mlir::cast<mlir::MemRefType>(
-                vpux::setCompressionState(newSrcType, VPUIP::CompressionState::CompiletimeCompressed));
-        const auto newSrcStorageType = mlir::RankedTensorType::get(compressedDataShape.raw(), f16Type);
-        newSrcContentAttr = mlir::DenseElementsAttr::get(
-                newSrcStorageType, ArrayRef<vpux::type::float16>(
-                                           const_cast<vpux::type::float16*>(
-                                                   reinterpret_cast<const vpux::type::float16*>(compressedData.data())),
-                                           compressedData.size() / f16TypeSizeBytes));
-    } else {
-        VPUX_THROW("Unsupported compression mode");
+    const auto& compressedWeights = *compressedWeightsIt->second;
+
+    const auto loc = origOp->getLoc();
+    auto input = origOp.getInput();
+    auto output = origOp.getOutputBuff();
+    const auto inputType = input.getType().cast<vpux::NDTypeInterface>();
+    const auto outputType = output.getType().cast<vpux::NDTypeInterface>();
+    auto inConstOp = input.getDefiningOp<Const::DeclareOp>();
+    auto outBufferOp = output.getDefiningOp<VPURT::DeclareBufferOp>();
+    if (inConstOp == nullptr || inConstOp.getContentAttr() != compressedWeights.contentAttr || outBufferOp == nullptr) {
+        return mlir::failure();
     }
 
+    const auto totalInputSize = compressedWeights.totalInputSize;
+    const auto compressedContent = compressedWeights.compressedContent;
+    if (compressedContent == nullptr) {
+        return mlir::failure();
+    }
+
+    const auto compressedElemType = compressedContent.getShapedType().getElementType();
+    const auto compressedElemSize = compressedElemType.getIntOrFloatBitWidth() / CHAR_BIT;
+    const Shape compressedDataShape(compressedContent.getShapedType().getShape());
+    const Shape newDstShape{totalInputSize.count() / compressedElemSize, 1, 1, 1};
+
+    auto newDstType = mlir::isa<VPUIP::DistributedBufferType>(outputType)
+                              ? VPU::changeShapeElemTypeForDuplicatedDistributedBuffers(outputType, newDstShape,
+                                                                                        compressedElemType)
+                              : outputType.changeShapeElemType(newDstShape, compressedElemType);
+
+    auto newSrcType = getMemRefType(compressedDataShape, compressedElemType, DimsOrder::NCHW, inputType.getMemSpace(),
+                                    /*strides=*/StridesRef(), getSwizzlingSchemeAttr(inputType));
+    newSrcType = mlir::cast<mlir::MemRefType>(
+            vpux::setCompressionState(newSrcType, VPUIP::CompressionState::CompiletimeCompressed));
+
     newDstType = newDstType.changeDimsOrder(DimsOrder::NCHW);
 
     rewriter.setInsertionPointAfter(outBufferOp);
@@ -187,7 +267,7 @@ mlir::LogicalResult NNDMAOpConverter::matchAndRewrite(VPUIP::NNDMAOp origOp, mli
 
     rewriter.setInsertionPointAfter(inConstOp);
     auto newSrcConstOp = rewriter.create<Const::DeclareOp>(inConstOp->getLoc(), newSrcType,
-                                                           Const::ContentAttr::get(newSrcContentAttr));
+                                                           Const::ContentAttr::get(compressedContent));
 
     rewriter.setInsertionPoint(origOp);
     rewriter.create<VPUIP::DecompressDMAOp>(loc, newSrcConstOp.getOutput(), /*act_compression_size_entry*/ nullptr,
@@ -199,7 +279,7 @@ mlir::LogicalResult NNDMAOpConverter::matchAndRewrite(VPUIP::NNDMAOp origOp, mli
     rewriter.replaceOp(origOp, {outBufferOp.getBuffer()});
 
     const auto uncompressed = totalInputSize.count();
-    const auto compressed = compressedData.size();
+    const auto compressed = compressedDataShape.totalSize() * compressedElemSize;
     _log.trace("Compressed weights for {0}: {1} / {2} ({3})", loc, compressed, uncompressed,
                (double)compressed / uncompressed);
 
@@ -214,9 +294,31 @@ void CompressWeightsBTCPass::safeRunOnFunc() {
 
     _log.trace("VPUIP CompressWeightsBTCPass");
     auto& ctx = getContext();
+    const auto codec = vpux::makeCodec(algo, arch);
+
+    SmallVector<CompressedWeights> candidates;
+    func.walk([&](VPUIP::NNDMAOp dmaOp) {
+        if (!isCompressionCandidate(dmaOp, _log)) {
+            return;
+        }
+
+        auto constOp = dmaOp.getInput().getDefiningOp<Const::DeclareOp>();
+        const auto compressionMode = getCompressionMode(*codec, constOp);
+        _log.trace("Compress constant '{0}', type - '{1}', compression mode: {2}", constOp->getLoc(),
+                   constOp.getType(), ICodec::compressionModeToStr(compressionMode));
+        candidates.push_back({dmaOp, constOp.getContentAttr(), getTotalSize(dmaOp.getInput()), compressionMode});
+    });
+
+    compressAll(&ctx, arch, candidates, _log);
+
+    // NNDMAOp has no folder, so the DMA operations outlive the rewrite and can be used as keys
+    CompressedWeightsMap compressedWeights;
+    for (const auto& candidate : candidates) {
+        compressedWeights.try_emplace(candidate.dmaOp.getOperation(), &candidate);
+    }
 
     mlir::RewritePatternSet patterns(&ctx);
-    patterns.add<NNDMAOpConverter>(&ctx, algo, arch, _log);
+    patterns.add<NNDMAOpConverter>(&ctx, compressedWeights, _log);
 
     if (mlir::failed(applyPatternsAndFoldGreedily(func, std::move(patterns), vpux::getDefaultGreedyRewriteConfig()))) {
         signalPassFailure();
@@ -8,8 +8,6 @@
 #include "vpux/compiler/dialect/VPURT/IR/ops.hpp"
 #include "vpux/compiler/dialect/VPURT/utils/barrier_legalization_utils.hpp"
 
-#include <llvm/ADT/SetOperations.h>
-
 using namespace vpux;
 namespace {
 
@@ -23,7 +21,7 @@ namespace {
     DMA[0] DMA[0] DMA[1]       DMA[0] DMA[1]
 */
 void removeRedundantDependencies(BarrierInfo& barrierInfo, bool considerTaskFifoDependency, vpux::Logger log) {
-    const auto findRedundantDependencies = [&](const SmallVector<llvm::BitVector>& taskControlMap,
+    const auto findRedundantDependencies = [&](ArrayRef<llvm::BitVector> taskControlMap,
                                                size_t taskControlMapOffset, const BarrierInfo::TaskSet& dependencies,
                                                bool producer = true) {
         // find dependencies to remove
@@ -53,7 +51,8 @@ void removeRedundantDependencies(BarrierInfo& barrierInfo, bool considerTaskFifo
     // Perform optimization in tasks blocks matching the distribution of synchronization points.
     for (size_t taskBlockIndex = 0; taskBlockIndex < barrierInfo.getControlGraphBlockCount(); ++taskBlockIndex) {
         // Build or update the control relationship between any two tasks. Note that the relationship includes the
-        // dependency by the barriers as well as the implicit dependence by FIFO
+        // dependency by the barriers as well as the implicit dependence by FIFO. A snapshot is built instead of using
+        // the cached getTaskControlMap() since the dependencies removed below invalidate the cached map
         auto [taskControlMap, controlMapOffset] =
                 barrierInfo.buildTaskControlMap(taskBlockIndex, considerTaskFifoDependency);
 
@@ -226,7 +225,7 @@ void mergeBarriers(BarrierInfo& barrierInfo, ArrayRef<BarrierInfo::TaskSet> orig
             if (producers.empty()) {
                 numOfBarriersWithNoProducers++;
             } else {
-                maxProducer = *std::max_element(producers.begin(), producers.end());
+                maxProducer = producers.back();
             }
 
             barIndAndMaxProdVec.push_back(std::make_pair(barrierInd, maxProducer));
@@ -243,8 +242,8 @@ void mergeBarriers(BarrierInfo& barrierInfo, ArrayRef<BarrierInfo::TaskSet> orig
 
         const auto allProducersAfterConsumers = [](const BarrierInfo::TaskSet& producers,
                                                    const BarrierInfo::TaskSet& consumers) {
-            const auto maxConsumer = *std::max_element(consumers.begin(), consumers.end());
-            const auto minProducer = *std::min_element(producers.begin(), producers.end());
+            const auto maxConsumer = consumers.back();
+            const auto minProducer = producers.front();
 
             return minProducer > maxConsumer;
         };
@@ -290,8 +289,8 @@ void mergeBarriers(BarrierInfo& barrierInfo, ArrayRef<BarrierInfo::TaskSet> orig
                 barrierInfo.addProducers(barrierInd, barrierProducersB);
                 barrierInfo.addConsumers(barrierInd, barrierConsumersB);
                 barrierInfo.resetBarrier(nextBarrierInd);
-                llvm::set_union(barrierProducersA, barrierProducersB);
-                llvm::set_union(barrierConsumersA, barrierConsumersB);
+                barrierProducersA.setUnion(barrierProducersB);
+                barrierConsumersA.setUnion(barrierConsumersB);
             }
         }
     }
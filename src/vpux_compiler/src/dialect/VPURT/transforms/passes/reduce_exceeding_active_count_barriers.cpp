@@ -31,13 +31,11 @@ private:
     // This is optional feature as nevertheless unnecessary dependencies are being removed in optimizeBarriers step
     // The benefit of having this disabled is smaller memory footprint
     bool _checkDependencyWhenLinearizing = true;
-    bool _rebuildControlMap = true;
+    bool _resetControlMapBlock = true;
     const bool _considerTaskFifoDependency = false;
     const bool _mergeWaitBarriersIteratively = false;
     bool _wlmFlag = false;
     bool _unevenVariantSplitFlag = false;
-    SmallVector<llvm::BitVector> _taskControlMap;
-    size_t _controlMapOffset = 0;
     size_t _controlMapBlockIdx = 0;
     size_t _availableSlots = 0;
 
@@ -109,13 +107,11 @@ bool ReduceExceedingActiveCountBarriersPass::linearizeTasks(std::set<size_t>& li
     };
 
     auto linearizationTasksBlockIndexes = getBlockIndexesForTasksBatch(linearizationTasks);
-    if (_checkDependencyWhenLinearizing && _rebuildControlMap) {
+    if (_checkDependencyWhenLinearizing && _resetControlMapBlock) {
         _controlMapBlockIdx = barrierInfo.isSyncPoint(*currTask) ? linearizationTasksBlockIndexes[*nextTask]
                                                                  : linearizationTasksBlockIndexes[*currTask];
-        std::tie(_taskControlMap, _controlMapOffset) =
-                barrierInfo.buildTaskControlMap(_controlMapBlockIdx, _considerTaskFifoDependency);
     }
-    _rebuildControlMap = false;
+    _resetControlMapBlock = false;
     nextTask = currTask;
 
     // linearize all tasks
@@ -134,8 +130,6 @@ bool ReduceExceedingActiveCountBarriersPass::linearizeTasks(std::set<size_t>& li
             unsigned nextTaskBlockIdx = linearizationTasksBlockIndexes[*nextTask];
             if (nextTaskBlockIdx > _controlMapBlockIdx) {
                 _controlMapBlockIdx = nextTaskBlockIdx;
-                std::tie(_taskControlMap, _controlMapOffset) =
-                        barrierInfo.buildTaskControlMap(_controlMapBlockIdx, _considerTaskFifoDependency);
             }
 
             if (currTaskBlockIdx != nextTaskBlockIdx) {
@@ -145,8 +139,11 @@ bool ReduceExceedingActiveCountBarriersPass::linearizeTasks(std::set<size_t>& li
             } else if (currTaskBlockIdx == _controlMapBlockIdx) {
                 // skip if barrier already exists
                 // TODO: E#80600 also check FIFO dependency
-                if (barrierInfo.controlPathExistsBetweenTasksInSameBlock(_taskControlMap, *currTask - _controlMapOffset,
-                                                                         *nextTask - _controlMapOffset)) {
+                // The cached map already reflects the barriers added by the previous linearization steps
+                const auto [taskControlMap, controlMapOffset] =
+                        barrierInfo.getTaskControlMap(_controlMapBlockIdx, _considerTaskFifoDependency);
+                if (barrierInfo.controlPathExistsBetweenTasksInSameBlock(taskControlMap, *currTask - controlMapOffset,
+                                                                         *nextTask - controlMapOffset)) {
                     currTask = nextTask;
                     ++nextTask;
                     continue;
@@ -295,7 +292,7 @@ void ReduceExceedingActiveCountBarriersPass::safeRunOnFunc() {
     for (size_t it = 0; it < barrierInfo.getNumOfVirtualBarriers() && !barrierBatchesToLegalize.empty(); ++it) {
         _log.trace("Iteration '{0}', there are '{1}' batches", it, barrierBatchesToLegalize.size());
 
-        _rebuildControlMap = true;  // rebuild task control map on each new iteration
+        _resetControlMapBlock = true;  // select the control map block again on each new iteration
         for (auto& activeBarriers : barrierBatchesToLegalize) {
             _log.trace("There are '{0}' active barriers, reduce active barrier count", activeBarriers.size());
 
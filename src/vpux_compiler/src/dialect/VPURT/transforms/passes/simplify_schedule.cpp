@@ -11,8 +11,6 @@
 #include "vpux/compiler/dialect/VPURT/transforms/passes.hpp"
 #include "vpux/compiler/dialect/VPURT/utils/barrier_legalization_utils.hpp"
 
-#include <llvm/ADT/SetOperations.h>
-
 using namespace vpux;
 namespace {
 
@@ -77,7 +75,7 @@ void linkTasksToBarriers(const BarrierInfo::TaskSet& tasksToAdd, const BarrierIn
             barrierTasks = barrierInfo.getBarrierProducers(barrierIdn);
         }
 
-        llvm::set_union(barrierTasks, tasksToAdd);
+        barrierTasks.setUnion(tasksToAdd);
         auto batches = barrierInfo.createLegalVariantBatches(barrierTasks, legalVariantCount);
         if (batches.size() > 1) {
             auto insertionPoint = barrierInfo.getBarrierOpAtIndex(barrierIdn);
@@ -303,8 +301,8 @@ void reduceParallelControlFlowsForQueue(VPURT::TaskConfigVec& ops, std::map<size
             if (VPURT::getMaxEntry(nextWaitBarriers) > minUpdateBarrier) {
                 break;
             }
-            llvm::set_union(intermediateBarriers,
-                            findValidBarrierCandidates(maxWaitBarrier, minUpdateBarrier, nextWaitBarriers));
+            intermediateBarriers.setUnion(
+                    findValidBarrierCandidates(maxWaitBarrier, minUpdateBarrier, nextWaitBarriers));
             ++nextTask;
         }
 
@@ -350,8 +348,8 @@ void reduceParallelControlFlowsForQueue(VPURT::TaskConfigVec& ops, std::map<size
             if (VPURT::getMinEntry(prevUpdateBarriers) < maxWaitBarrier) {
                 break;
             }
-            llvm::set_union(intermediateBarriers,
-                            findValidBarrierCandidates(maxWaitBarrier, minUpdateBarrier, prevUpdateBarriers));
+            intermediateBarriers.setUnion(
+                    findValidBarrierCandidates(maxWaitBarrier, minUpdateBarrier, prevUpdateBarriers));
         } while (prevTask != ops.begin());
 
         BarrierInfo::TaskSet newWaitBarriers;
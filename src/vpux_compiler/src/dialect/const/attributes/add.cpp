@@ -69,9 +69,12 @@ Const::Content vpux::Const::AddAttr::transform(vpux::Const::Content& input) cons
 
     const auto bias = static_cast<float>(getBias().getValue().convertToDouble());
 
-    for (size_t i = 0; i < shiftedVals.size(); ++i) {
-        shiftedVals[i] = values[i] + bias;
-    }
+    loop_chunked(LoopExecPolicy::Parallel, getContext(), checked_cast<int64_t>(shiftedVals.size()),
+                 Const::details::PARALLEL_FOLDING_MIN_CHUNK_SIZE, [&](int64_t begin, int64_t end) {
+                     for (auto i = begin; i < end; ++i) {
+                         shiftedVals[i] = values[i] + bias;
+                     }
+                 });
 
     return output;
 }
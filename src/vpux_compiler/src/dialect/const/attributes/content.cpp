@@ -8,11 +8,16 @@
 
 #include "vpux/compiler/dialect/const/ops.hpp"
 #include "vpux/compiler/dialect/const/utils/constant_folding_cache.hpp"
+#include "vpux/compiler/dialect/const/utils/folding_counters.hpp"
+#include "vpux/compiler/dialect/const/utils/persistent_folding_cache.hpp"
+#include "vpux/compiler/dialect/const/utils/sub_byte.hpp"
+#include "vpux/compiler/dialect/const/utils/transformations.hpp"
 #include "vpux/compiler/utils/types.hpp"
 
 #include "vpux/utils/core/format.hpp"
 #include "vpux/utils/core/func_ref.hpp"
 #include "vpux/utils/core/range.hpp"
+#include "vpux/utils/core/scope_exit.hpp"
 #include "vpux/utils/core/small_vector.hpp"
 
 #include <mlir/IR/AsmState.h>
@@ -25,6 +30,8 @@
 #include <llvm/ADT/TypeSwitch.h>
 #include <mlir/Transforms/InliningUtils.h>
 
+#include <atomic>
+#include <chrono>
 #include <cstring>
 #include <exception>
 #include <numeric>
@@ -106,8 +113,17 @@ mlir::LogicalResult vpux::Const::ContentAttr::verify(FuncRef<mlir::InFlightDiagn
     } else if (const auto denseResource = baseContent.dyn_cast<mlir::DenseResourceElementsAttr>()) {
         // Note: manual checks required since dense resource blob is opaque and does not perform much validation itself
         const auto bytes = denseResource.getRawHandle().getBlob()->getData();
+        const auto bitWidth = getElemTypeSize(baseContent.getShapedType()).count();
         bool ignored = false;
-        if (!mlir::DenseElementsAttr::isValidRawBuffer(baseContent.getShapedType(), bytes, ignored)) {
+        if (Const::isSubByte(bitWidth)) {
+            const auto packedSize = Const::getPackedSize(bitWidth, baseContent.getShapedType().getNumElements());
+            if (checked_cast<int64_t>(bytes.size()) != packedSize) {
+                return printTo(emitError(),
+                               "Size of packed sub-byte dense resource buffer '{0}' in 'baseContent' doesn't match its "
+                               "type '{1}'",
+                               bytes.size(), denseResource.getShapedType());
+            }
+        } else if (!mlir::DenseElementsAttr::isValidRawBuffer(baseContent.getShapedType(), bytes, ignored)) {
             return printTo(emitError(),
                            "Size of dense resource buffer '{0}' in 'baseContent' doesn't match its type '{1}'",
                            bytes.size(), denseResource.getShapedType());
@@ -178,20 +194,44 @@ std::pair<mlir::ArrayRef<char>, bool> getRawDataAndSplatness(mlir::ElementsAttr
     }
 
     auto denseResource = mlir::cast<mlir::DenseResourceElementsAttr>(baseContent);
+    const auto data = denseResource.getRawHandle().getBlob()->getData();
+    const auto type = baseContent.getShapedType();
+    const auto bitWidth = getElemTypeSize(type).count();
+    if (Const::isSubByte(bitWidth)) {
+        return {data, Const::isSubByteSplat(data, bitWidth, type.getNumElements())};
+    }
     // dense resource doesn't support splat detection in MLIR itself
-    return detectSplatManually(baseContent.getShapedType(), denseResource.getRawHandle().getBlob()->getData());
+    return detectSplatManually(type, data);
 }
 
 //
 // wrapBaseContent
 //
 
+// Sub-byte elements can be stored packed only in dense resources (e.g. 4-bit weights shared with OpenVINO).
+// They are unpacked into one element per byte only when folded, the same storage which is used for the sub-byte
+// constants stored in DenseElementsAttr, so that the transformations don't have to handle the packed data
+Const::Content unpackSubByteContent(mlir::ShapedType type, ArrayRef<char> packedData, bool isSplat) {
+    const auto bitWidth = getElemTypeSize(type).count();
+    const auto intType = mlir::cast<mlir::IntegerType>(type.getElementType());
+    const auto storageElemType = mlir::IntegerType::get(type.getContext(), CHAR_BIT, intType.getSignedness());
+
+    auto content = Const::Content::allocTempBuffer(type.cast<vpux::NDTypeInterface>(), storageElemType, isSplat);
+    Const::unpackSubByte(packedData, bitWidth, content.getRawTempBuf());
+    return content;
+}
+
 Const::Content wrapBaseContent(mlir::ElementsAttr baseContent) {
     ArrayRef<char> data = {};
     bool isSplat = false;
 
     std::tie(data, isSplat) = getRawDataAndSplatness(baseContent);
 
+    if (mlir::isa<mlir::DenseResourceElementsAttr>(baseContent) &&
+        Const::isSubByte(getElemTypeSize(baseContent.getShapedType()).count())) {
+        return unpackSubByteContent(baseContent.getShapedType(), data, isSplat);
+    }
+
     return Const::Content::fromRawBuffer(baseContent.getShapedType().cast<vpux::NDTypeInterface>(), data,
                                          baseContent.getShapedType().getElementType(), isSplat);
 }
@@ -210,8 +250,22 @@ bool canAddQuantCast(Const::TransformAttrInterface* begin, Const::TransformAttrI
     return true;
 }
 
+std::atomic<uint64_t> numFoldsCounter{0};
+std::atomic<uint64_t> numCacheHitsCounter{0};
+
 }  // namespace
 
+//
+// getFoldingCounters
+//
+
+Const::FoldingCounters vpux::Const::getFoldingCounters() {
+    Const::FoldingCounters counters;
+    counters.numFolds = numFoldsCounter.load(std::memory_order_relaxed);
+    counters.numCacheHits = numCacheHitsCounter.load(std::memory_order_relaxed);
+    return counters;
+}
+
 //
 // ContentAttr::fold
 //
@@ -220,6 +274,8 @@ Const::Content vpux::Const::ContentAttr::fold(bool bypassCache) const {
     auto baseContent = getBaseContent();
 
 #ifdef BACKGROUND_FOLDING_ENABLED
+    Const::ConstantFoldingCache* backgroundCache = nullptr;
+    bool addResultToCache = false;
     if (!bypassCache) {
         auto& cacheManager = Const::ConstantFoldingCacheManager::getInstance();
         auto ctx = baseContent.getContext();
@@ -227,24 +283,79 @@ Const::Content vpux::Const::ContentAttr::fold(bool bypassCache) const {
             auto& cache = cacheManager.get(ctx);
             auto content = cache.getContent(*this);
             if (content.has_value()) {
+                numCacheHitsCounter.fetch_add(1, std::memory_order_relaxed);
                 return content.value();
             }
+
+            // The content is not in the cache yet: if its request is still queued, it is taken out of the queue and
+            // folded right away in this thread; if it is being folded in background, its completion is awaited
+            const auto claimResult = cache.claimOrWaitRequest(*this);
+            if (claimResult == Const::details::RequestQueue::ClaimResult::Completed) {
+                content = cache.getContent(*this);
+                if (content.has_value()) {
+                    numCacheHitsCounter.fetch_add(1, std::memory_order_relaxed);
+                    return content.value();
+                }
+            }
+            backgroundCache = &cache;
+            addResultToCache = claimResult == Const::details::RequestQueue::ClaimResult::Claimed;
         }
     }
+    const auto foldingStart = std::chrono::steady_clock::now();
+
+    // The claimed request is completed on every path, including the persistent cache hits and the exceptions, since
+    // other threads may be waiting for it
+    VPUX_SCOPE_EXIT {
+        if (addResultToCache) {
+            backgroundCache->markRequestCompleted(*this);
+        }
+    };
+    // The claimed request would have added its result to the cache, which is needed by the requests that reuse it
+    // as a partially folded value
+    const auto publishResult = [&](const Const::Content& content) {
+        if (addResultToCache) {
+            const auto foldingTime = std::chrono::duration_cast<std::chrono::microseconds>(
+                    std::chrono::steady_clock::now() - foldingStart);
+            backgroundCache->addContent(*this, content.copyUnownedBuffer(), foldingTime);
+        }
+    };
 #else
     VPUX_UNUSED(bypassCache);
 #endif
 
-    auto res = wrapBaseContent(baseContent);
+    // The persistent cache is consulted regardless of `bypassCache`, since it is also used by background folding
+    auto* persistentCache = Const::PersistentFoldingCacheManager::getInstance().find(baseContent.getContext());
+    if (persistentCache != nullptr && !persistentCache->isCacheable(*this)) {
+        persistentCache = nullptr;
+    }
+    if (persistentCache != nullptr) {
+        if (auto content = persistentCache->load(*this); content.has_value()) {
+            numCacheHitsCounter.fetch_add(1, std::memory_order_relaxed);
+#ifdef BACKGROUND_FOLDING_ENABLED
+            publishResult(content.value());
+#endif
+            return content.value();
+        }
+    }
+
+    numFoldsCounter.fetch_add(1, std::memory_order_relaxed);
+    auto res = Const::details::applyTransformations(wrapBaseContent(baseContent), getTransformations());
 
-    for (const auto& attr : getTransformations()) {
-        const auto storageElemTypeSize = vpux::getElemTypeSize(res.getStorageElemType()).count();
-        VPUX_THROW_WHEN(storageElemTypeSize < CHAR_BIT && !attr.supportsSubByteStorageType(),
-                        "Unsupported storage type of size '{0}' bits.", storageElemTypeSize);
-        Const::logger().trace("Applying transformation: {0}", attr);
-        res = attr.transform(res);
+    if (persistentCache != nullptr) {
+        persistentCache->store(*this, res);
     }
 
+#ifdef BACKGROUND_FOLDING_ENABLED
+    if (backgroundCache != nullptr) {
+        const auto foldingTime = std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - foldingStart);
+        if (backgroundCache->isStatisticsCollectionEnabled()) {
+            backgroundCache->getStatistics().inlineFoldingTime += foldingTime.count();
+        }
+        publishResult(res);
+    }
+#endif
+
     return res;
 }
 
@@ -53,9 +53,12 @@ Const::Content vpux::Const::DequantizeAttr::transform(vpux::Const::Content& inpu
         const auto scale = uniformType.getScale();
         const auto zeroPoint = uniformType.getZeroPoint();
 
-        for (size_t i = 0; i < realVals.size(); ++i) {
-            realVals[i] = dequantize(qVals[i], scale, zeroPoint);
-        }
+        loop_chunked(LoopExecPolicy::Parallel, getContext(), checked_cast<int64_t>(realVals.size()),
+                     Const::details::PARALLEL_FOLDING_MIN_CHUNK_SIZE, [&](int64_t begin, int64_t end) {
+                         for (auto i = begin; i < end; ++i) {
+                             realVals[i] = dequantize(qVals[i], scale, zeroPoint);
+                         }
+                     });
     } else if (const auto uniformType = qElemType.dyn_cast<mlir::quant::UniformQuantizedPerAxisType>()) {
         const auto scales = uniformType.getScales();
         const auto zeroPoints = uniformType.getZeroPoints();
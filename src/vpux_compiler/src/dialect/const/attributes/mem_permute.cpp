@@ -121,6 +121,14 @@ Const::Content vpux::Const::MemPermuteAttr::transform(vpux::Const::Content& inpu
     return Const::details::memPermuteTransformation(input, outType, memPerm);
 }
 
+//
+// MemPermuteAttr::supportsSubByteStorageType
+//
+
+bool vpux::Const::MemPermuteAttr::supportsSubByteStorageType() const {
+    return true;
+}
+
 //
 // ContentAttr::memPermute
 //
@@ -117,9 +117,12 @@ Const::Content transformImpl(mlir::quant::QuantizedType qElemType, mlir::Type ou
         const auto zeroPoint = uniformType.getZeroPoint();
         const auto quantizer = createQuantizeFn(scale, zeroPoint, qElemType);
 
-        for (size_t i = 0; i < realVals.size(); ++i) {
-            qVals[i] = static_cast<StorageType>(quantizer(realVals[i]));
-        }
+        loop_chunked(LoopExecPolicy::Parallel, ctx, checked_cast<int64_t>(qVals.size()),
+                     Const::details::PARALLEL_FOLDING_MIN_CHUNK_SIZE, [&](int64_t begin, int64_t end) {
+                         for (auto i = begin; i < end; ++i) {
+                             qVals[i] = static_cast<StorageType>(quantizer(realVals[i]));
+                         }
+                     });
     } else if (const auto uniformType = qElemType.dyn_cast<mlir::quant::UniformQuantizedPerAxisType>()) {
         const auto scales = uniformType.getScales();
         const auto zeroPoints = uniformType.getZeroPoints();
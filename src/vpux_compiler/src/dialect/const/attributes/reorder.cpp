@@ -98,6 +98,14 @@ Const::Content vpux::Const::ReorderAttr::transform(vpux::Const::Content& input)
     return Const::details::memPermuteTransformation(input, outType, memPerm);
 }
 
+//
+// ReorderAttr::supportsSubByteStorageType
+//
+
+bool vpux::Const::ReorderAttr::supportsSubByteStorageType() const {
+    return true;
+}
+
 //
 // ContentAttr::reorder
 //
@@ -74,9 +74,12 @@ Const::Content vpux::Const::RescaleAttr::transform(vpux::Const::Content& input)
 
     const auto scale = static_cast<float>(getScale().getValue().convertToDouble());
 
-    for (size_t i = 0; i < scaledVals.size(); ++i) {
-        scaledVals[i] = values[i] * scale;
-    }
+    loop_chunked(LoopExecPolicy::Parallel, getContext(), checked_cast<int64_t>(scaledVals.size()),
+                 Const::details::PARALLEL_FOLDING_MIN_CHUNK_SIZE, [&](int64_t begin, int64_t end) {
+                     for (auto i = begin; i < end; ++i) {
+                         scaledVals[i] = values[i] * scale;
+                     }
+                 });
 
     return output;
 }
@@ -103,6 +103,14 @@ Const::Content vpux::Const::TransposeAttr::transform(vpux::Const::Content& input
     return Const::details::memPermuteTransformation(input, outType, memPerm);
 }
 
+//
+// TransposeAttr::supportsSubByteStorageType
+//
+
+bool vpux::Const::TransposeAttr::supportsSubByteStorageType() const {
+    return true;
+}
+
 //
 // ContentAttr::transpose
 //
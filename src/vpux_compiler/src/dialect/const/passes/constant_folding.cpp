@@ -5,6 +5,7 @@
 
 #include "vpux/compiler/dialect/const/ops.hpp"
 #include "vpux/compiler/dialect/const/passes.hpp"
+#include "vpux/compiler/dialect/const/utils/resource_blobs.hpp"
 
 using namespace vpux;
 
@@ -30,6 +31,13 @@ void ConstantFoldingPass::runOnOperation() {
 
     _log.trace("Folding constant at location '{0}'", origOp.getLoc());
 
+    // Content already folded into an owned blob, e.g. compressed weights, would only be copied into a new blob, which
+    // doubles its memory until the old one is released
+    const auto contentAttr = origOp.getContentAttr();
+    if (contentAttr.getTransformations().empty() && Const::isOwnedContent(contentAttr.getBaseContent())) {
+        return;
+    }
+
     mlir::OpBuilder builder(origOp);
 
     const auto content = origOp.getContent();
@@ -37,8 +45,6 @@ void ConstantFoldingPass::runOnOperation() {
     const auto contentElemType = contentType.getElementType();
 
     const auto bufSize = checked_cast<size_t>(contentType.getTotalAllocSize().count());
-    std::vector<char> tempBuf(bufSize);
-    content.copyTo(MutableArrayRef(tempBuf.data(), bufSize));
 
     auto rankedTensorType = contentType.cast<mlir::RankedTensorType>();
 
@@ -54,17 +60,31 @@ void ConstantFoldingPass::runOnOperation() {
         rankedTensorType = contentType.changeElemType(normalizeQuantStorageType(qtype)).cast<mlir::RankedTensorType>();
     }
 
-    const auto denseAttr = mlir::DenseElementsAttr::getFromRawBuffer(rankedTensorType, tempBuf);
+    // The folded content is written directly into its final storage. Splat content is uniqued as a single value,
+    // so only the non-splat content is worth keeping in an owned blob. I1 content keeps the DenseElementsAttr
+    // storage, since its raw buffer layout is specific to it
+    const auto copyContent = [&](MutableArrayRef<char> buf) {
+        content.copyTo(buf);
+    };
+    mlir::ElementsAttr baseContent;
+    if (content.isSplat() || elemTypeBitSize == 1) {
+        std::vector<char> tempBuf(bufSize);
+        copyContent(tempBuf);
+        baseContent = mlir::DenseElementsAttr::getFromRawBuffer(rankedTensorType, tempBuf);
+    } else {
+        baseContent = Const::createOwnedContent(rankedTensorType, bufSize, copyContent);
+    }
+
     auto origType = origOp.getType().cast<NDTypeInterface>();
     if (isUnsupportedSubByteStorageType) {
         // Temporary fix to enable compilation.
         // Final design to also include a mechanism to FREEZE constants
         // from accepting future transformations due to the fact of packed
         // sub byte values stored, which would require an unpacking and a repacking
-        origOp.setContentAttr(Const::ContentAttr::get(denseAttr).changeShapeAndElemType(origType.getShape(),
-                                                                                        origType.getElementType()));
+        origOp.setContentAttr(Const::ContentAttr::get(baseContent)
+                                      .changeShapeAndElemType(origType.getShape(), origType.getElementType()));
     } else {
-        origOp.setContentAttr(Const::ContentAttr::get(denseAttr));
+        origOp.setContentAttr(Const::ContentAttr::get(baseContent));
     }
 }
 
@@ -0,0 +1,43 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/compiler/dialect/const/passes.hpp"
+#include "vpux/compiler/dialect/const/utils/resource_blobs.hpp"
+
+using namespace vpux;
+
+namespace {
+
+//
+// ReleaseUnusedResourcesPass
+//
+
+class ReleaseUnusedResourcesPass final : public Const::ReleaseUnusedResourcesBase<ReleaseUnusedResourcesPass> {
+public:
+    explicit ReleaseUnusedResourcesPass(Logger log) {
+        Base::initLogger(log, Base::getArgumentName());
+    }
+
+private:
+    void safeRunOnModule() final;
+};
+
+void ReleaseUnusedResourcesPass::safeRunOnModule() {
+    const auto releasedSize = Const::releaseUnusedResources(getOperation());
+    _log.trace("Released {0} bytes of unused constants", releasedSize.count());
+
+    // Only the data of the constants which are no longer referenced is freed, the IR stays intact
+    markAllAnalysesPreserved();
+}
+
+}  // namespace
+
+//
+// createReleaseUnusedResourcesPass
+//
+
+std::unique_ptr<mlir::Pass> vpux::Const::createReleaseUnusedResourcesPass(Logger log) {
+    return std::make_unique<ReleaseUnusedResourcesPass>(log);
+}
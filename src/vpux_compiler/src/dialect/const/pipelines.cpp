@@ -14,5 +14,6 @@ void Const::registerConstPipelines() {
     mlir::PassPipelineRegistration<>(
             "constant-folding-pipeline", "Constant folding pipeline", [](mlir::OpPassManager& pm) {
                 pm.nest<mlir::func::FuncOp>().addNestedPass<Const::DeclareOp>(Const::createConstantFoldingPass());
+                pm.addPass(Const::createReleaseUnusedResourcesPass());
             });
 }
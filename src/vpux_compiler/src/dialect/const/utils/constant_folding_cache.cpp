@@ -6,10 +6,37 @@
 #ifdef BACKGROUND_FOLDING_ENABLED
 
 #include "vpux/compiler/dialect/const/utils/constant_folding_cache.hpp"
-#include "vpux/utils/core/disable_warning.hpp"
+
+#include <llvm/ADT/StringSwitch.h>
+
+#include <tuple>
 
 using namespace vpux;
 
+//
+// CacheEvictionPolicy
+//
+
+StringRef vpux::Const::stringifyCacheEvictionPolicy(Const::CacheEvictionPolicy policy) {
+    switch (policy) {
+    case Const::CacheEvictionPolicy::RefCount:
+        return "refcount";
+    case Const::CacheEvictionPolicy::LRU:
+        return "lru";
+    case Const::CacheEvictionPolicy::GDSF:
+        return "gdsf";
+    }
+    VPUX_THROW("Unknown cache eviction policy");
+}
+
+std::optional<Const::CacheEvictionPolicy> vpux::Const::symbolizeCacheEvictionPolicy(StringRef str) {
+    return llvm::StringSwitch<std::optional<Const::CacheEvictionPolicy>>(str.lower())
+            .Case("refcount", Const::CacheEvictionPolicy::RefCount)
+            .Case("lru", Const::CacheEvictionPolicy::LRU)
+            .Case("gdsf", Const::CacheEvictionPolicy::GDSF)
+            .Default(std::nullopt);
+}
+
 //
 // ConstantFoldingCache
 //
@@ -17,16 +44,35 @@ using namespace vpux;
 void Const::ConstantFoldingCache::enqueueRequest(const Const::FoldingRequest& foldingRequest) {
     _requestQueue.push(foldingRequest);
     if (_collectStatistics) {
-        _statistics.updateMaxNumRequestsInQueue(
-                std::max(static_cast<int64_t>(0), checked_cast<int64_t>(_requestQueue.size())));
+        _statistics.updateMaxNumRequestsInQueue(_requestQueue.size());
     }
 }
 
 Const::FoldingRequest Const::ConstantFoldingCache::getRequest() {
-    Const::FoldingRequest result;
-    NPU_DISABLE_STRINGOP_OVERFLOW(129510)
-    _requestQueue.pop(result);
-    NPU_DISABLE_WARNING_END
+    return _requestQueue.pop();
+}
+
+void Const::ConstantFoldingCache::markRequestInProgress(Const::ContentAttr attr) {
+    _requestQueue.markInProgress(attr);
+}
+
+void Const::ConstantFoldingCache::markRequestCompleted(Const::ContentAttr attr) {
+    _requestQueue.markCompleted(attr);
+}
+
+Const::details::RequestQueue::ClaimResult Const::ConstantFoldingCache::claimOrWaitRequest(Const::ContentAttr attr) {
+    const auto waitStart = std::chrono::steady_clock::now();
+    const auto result = _requestQueue.claimOrWait(attr);
+    if (_collectStatistics) {
+        if (result == Const::details::RequestQueue::ClaimResult::Claimed) {
+            _statistics.numClaimedRequests++;
+        } else if (result == Const::details::RequestQueue::ClaimResult::Completed) {
+            _statistics.numWaitedRequests++;
+            _statistics.waitingTime += std::chrono::duration_cast<std::chrono::microseconds>(
+                                               std::chrono::steady_clock::now() - waitStart)
+                                               .count();
+        }
+    }
     return result;
 }
 
@@ -47,39 +93,86 @@ void Const::ConstantFoldingCache::setCacheCleanThreshold(double cacheCleanThresh
     _cacheCleanThreshold = cacheCleanThreshold;
 }
 
+void Const::ConstantFoldingCache::setEvictionPolicy(Const::CacheEvictionPolicy policy) {
+    _evictionPolicy = policy;
+}
+
+Const::CacheEvictionPolicy Const::ConstantFoldingCache::getEvictionPolicy() const {
+    return _evictionPolicy;
+}
+
+void Const::ConstantFoldingCache::updateAccessInfo(Const::details::CachedContent& cachedContent) {
+    cachedContent.lastAccess = ++_accessClock;
+    const auto frequency = ++cachedContent.frequency;
+
+    // Entries with an unknown folding cost are considered to have the minimal cost, so that only their size and
+    // frequency are taken into account
+    const auto cost = static_cast<double>(std::max<uint64_t>(cachedContent.foldingCost, 1));
+    const auto size = static_cast<double>(std::max<size_t>(cachedContent.size, 1));
+    cachedContent.priority = _gdsfInflation.load() + static_cast<double>(frequency) * cost / size;
+}
+
+// Entries with lower priority are evicted first
+double Const::ConstantFoldingCache::getEvictionPriority(const Const::details::CachedContent& cachedContent) const {
+    switch (_evictionPolicy) {
+    case Const::CacheEvictionPolicy::RefCount:
+        return static_cast<double>(cachedContent.refCount.load());
+    case Const::CacheEvictionPolicy::LRU:
+        return static_cast<double>(cachedContent.lastAccess.load());
+    case Const::CacheEvictionPolicy::GDSF:
+        return cachedContent.priority.load();
+    }
+    VPUX_THROW("Unknown cache eviction policy");
+}
+
 bool Const::ConstantFoldingCache::isMemoryLimitReached() const {
     return _memoryUsedCache >= _memoryUsageLimit;
 }
 
 void Const::ConstantFoldingCache::cleanUpCache() {
-    std::vector<std::pair<Const::ContentAttr, int>> contents;
+    std::vector<std::tuple<Const::ContentAttr, double, size_t>> contents;
     {
-        std::lock_guard<std::mutex> lock(_mutex);
+        // Iteration is not safe with concurrent insertions or removals, so a snapshot is taken under exclusive lock
+        std::unique_lock<std::shared_mutex> lock(_cacheMutex);
         contents.reserve(_cache.size());
         for (const auto& [attr, cachedContent] : _cache) {
-            contents.emplace_back(attr, cachedContent.refCount);
+            contents.emplace_back(attr, getEvictionPriority(cachedContent), cachedContent.size);
         }
     }
     std::sort(contents.begin(), contents.end(), [](const auto& a, const auto& b) {
-        return a.second < b.second;
+        return std::get<1>(a) < std::get<1>(b);
     });
 
-    for (const auto& entry : contents) {
-        removeContent(entry.first);
+    for (const auto& [attr, priority, size] : contents) {
+        removeContent(attr);
+        if (_evictionPolicy == Const::CacheEvictionPolicy::GDSF) {
+            _gdsfInflation = std::max(_gdsfInflation.load(), priority);
+        }
+        if (_collectStatistics) {
+            _statistics.numEvictions++;
+            _statistics.numBytesEvicted += size;
+        }
         if (_memoryUsedCache <= _memoryUsageLimit * _cacheCleanThreshold) {
             break;
         }
     }
 }
 
-void Const::ConstantFoldingCache::addContent(Const::ContentAttr attr, const Const::Content& content) {
-    Const::details::ContentMap::accessor accessor;
-    _cache.insert(accessor, attr);
-    VPUX_THROW_WHEN(accessor.empty(), "Failed to add folding request to cache");
-    accessor->second.content = content;
-    accessor.release();
-
+void Const::ConstantFoldingCache::addContent(Const::ContentAttr attr, const Const::Content& content,
+                                             std::chrono::microseconds foldingCost) {
     auto size = attr.getType().cast<vpux::NDTypeInterface>().getTotalAllocSize();
+
+    {
+        std::shared_lock<std::shared_mutex> lock(_cacheMutex);
+        Const::details::ContentMap::accessor accessor;
+        _cache.insert(accessor, attr);
+        VPUX_THROW_WHEN(accessor.empty(), "Failed to add folding request to cache");
+        accessor->second.content = content;
+        accessor->second.size = checked_cast<size_t>(size.count());
+        accessor->second.foldingCost = checked_cast<uint64_t>(foldingCost.count());
+        updateAccessInfo(accessor->second);
+    }
+
     _memoryUsedCache += size.count();
 
     if (isMemoryLimitReached()) {
@@ -95,6 +188,7 @@ void Const::ConstantFoldingCache::addContent(Const::ContentAttr attr, const Cons
 }
 
 void Const::ConstantFoldingCache::removeContent(Const::ContentAttr attr) {
+    std::shared_lock<std::shared_mutex> lock(_cacheMutex);
     Const::details::ContentMap::accessor accessor;
     if (_cache.find(accessor, attr) && !accessor.empty()) {
         _cache.erase(accessor);
@@ -113,11 +207,15 @@ std::optional<Const::Content> Const::ConstantFoldingCache::getContent(Const::Con
     // Return the value from the cache if it contains it
     Const::details::ContentMap::accessor accessor;
     if (_cache.find(accessor, attr) && !accessor.empty()) {
+        auto& cachedContent = accessor->second;
         if (_collectStatistics) {
             _statistics.numCacheHits++;
+            _statistics.numBytesSaved += cachedContent.size;
+            _statistics.foldingTimeSaved += cachedContent.foldingCost;
         }
-        accessor->second.refCount--;
-        return accessor->second.content;
+        cachedContent.refCount--;
+        updateAccessInfo(cachedContent);
+        return cachedContent.content;
     }
 
     if (_collectStatistics) {
@@ -127,12 +225,21 @@ std::optional<Const::Content> Const::ConstantFoldingCache::getContent(Const::Con
 }
 
 bool Const::ConstantFoldingCache::replaceContentAttr(Const::ContentAttr originalAttr, Const::ContentAttr newAttr) {
+    std::shared_lock<std::shared_mutex> lock(_cacheMutex);
     Const::details::ContentMap::accessor originalAttrAccessor;
     if (_cache.find(originalAttrAccessor, originalAttr) && !originalAttrAccessor.empty()) {
         Const::details::ContentMap::accessor newAttrAccessor;
         _cache.insert(newAttrAccessor, newAttr);
         VPUX_THROW_WHEN(newAttrAccessor.empty(), "Failed to add folding request to cache");
-        newAttrAccessor->second.content = std::move(originalAttrAccessor->second.content);
+        auto& originalContent = originalAttrAccessor->second;
+        auto& newContent = newAttrAccessor->second;
+        newContent.content = std::move(originalContent.content);
+        newContent.refCount = originalContent.refCount.load();
+        newContent.size = originalContent.size;
+        newContent.foldingCost = originalContent.foldingCost;
+        newContent.lastAccess = originalContent.lastAccess.load();
+        newContent.frequency = originalContent.frequency.load();
+        newContent.priority = originalContent.priority.load();
         _cache.erase(originalAttrAccessor);
         return true;
     }
@@ -159,6 +266,96 @@ Const::details::CacheStatistics& Const::ConstantFoldingCache::getStatistics() {
     return _statistics;
 }
 
+//
+// RequestQueue
+//
+
+void Const::details::RequestQueue::push(const Const::FoldingRequest& request) {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        const auto sequence = _nextSequence++;
+        _entries.emplace(sequence, request);
+        if (auto contentAttr = mlir::dyn_cast_or_null<Const::ContentAttr>(request.attr)) {
+            _index[contentAttr].push_back(sequence);
+        }
+    }
+    _requestAvailable.notify_one();
+}
+
+Const::FoldingRequest Const::details::RequestQueue::pop() {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _requestAvailable.wait(lock, [this] {
+        return !_entries.empty();
+    });
+
+    auto node = _entries.extract(_entries.begin());
+    if (auto contentAttr = mlir::dyn_cast_or_null<Const::ContentAttr>(node.mapped().attr)) {
+        eraseFromIndex(contentAttr, node.key());
+    }
+    return std::move(node.mapped());
+}
+
+void Const::details::RequestQueue::eraseFromIndex(mlir::Attribute attr, uint64_t sequence) {
+    auto it = _index.find(attr);
+    if (it == _index.end()) {
+        return;
+    }
+    auto& sequences = it->second;
+    llvm::erase_if(sequences, [&](uint64_t other) {
+        return other == sequence;
+    });
+    if (sequences.empty()) {
+        _index.erase(it);
+    }
+}
+
+void Const::details::RequestQueue::markInProgress(Const::ContentAttr attr) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _inProgress[attr]++;
+}
+
+void Const::details::RequestQueue::markCompleted(Const::ContentAttr attr) {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto it = _inProgress.find(attr);
+        VPUX_THROW_WHEN(it == _inProgress.end(), "Folding request '{0}' was not in progress", attr);
+        if (--it->second == 0) {
+            _inProgress.erase(it);
+        }
+    }
+    _requestCompleted.notify_all();
+}
+
+Const::details::RequestQueue::ClaimResult Const::details::RequestQueue::claimOrWait(Const::ContentAttr attr) {
+    std::unique_lock<std::mutex> lock(_mutex);
+
+    // The request is still queued, so the fastest way to get its result is folding it right away in the calling thread.
+    // All the queued duplicates are dropped as well, since the result will be produced by the caller. The request is
+    // marked in progress, so that other threads needing it wait for the caller instead of folding it again
+    if (auto it = _index.find(attr); it != _index.end()) {
+        for (const auto sequence : it->second) {
+            _entries.erase(sequence);
+        }
+        _index.erase(it);
+        _inProgress[attr]++;
+        return ClaimResult::Claimed;
+    }
+
+    if (_inProgress.find(attr) == _inProgress.end()) {
+        return ClaimResult::NotFound;
+    }
+
+    _requestCompleted.wait(lock, [&] {
+        return _inProgress.find(attr) == _inProgress.end();
+    });
+    return ClaimResult::Completed;
+}
+
+size_t Const::details::RequestQueue::size() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _entries.size();
+}
+
 //
 // CacheStatistics
 //
@@ -7,13 +7,18 @@
 
 #include "vpux/compiler/dialect/const/utils/constant_folding_in_background.hpp"
 #include "vpux/compiler/dialect/const/utils/constant_folding_cache.hpp"
+#include "vpux/compiler/dialect/const/utils/transformations.hpp"
+#include "vpux/utils/core/scope_exit.hpp"
+
+#include <chrono>
 
 using namespace vpux;
 using namespace vpux::Const;
 
 BackgroundConstantFolding::BackgroundConstantFolding(mlir::MLIRContext* ctx, size_t maxConcurrentTasks,
                                                      bool collectStatistics, size_t memoryUsageLimit,
-                                                     double cacheCleanThreshold, Logger log)
+                                                     double cacheCleanThreshold, CacheEvictionPolicy evictionPolicy,
+                                                     Logger log)
         : _ctx(ctx), _maxConcurrentTasks(maxConcurrentTasks), _log(log) {
     if (!_ctx->isMultithreadingEnabled()) {
         _log.warning("Multi thread is disabled, background constant folding is disabled");
@@ -35,6 +40,7 @@ BackgroundConstantFolding::BackgroundConstantFolding(mlir::MLIRContext* ctx, siz
     auto memoryUsageLimitBytes = memoryUsageLimitMB.to<vpux::Byte>();
     cacheManager.get(_ctx).setMemoryUsageLimit(memoryUsageLimitBytes);
     cacheManager.get(_ctx).setCacheCleanThreshold(cacheCleanThreshold);
+    cacheManager.get(_ctx).setEvictionPolicy(evictionPolicy);
     if (collectStatistics) {
         cacheManager.get(_ctx).enableStatisticsCollection();
     }
@@ -85,17 +91,19 @@ bool tryFoldingPartially(vpux::Const::ConstantFoldingCache& cache, Const::Conten
         return false;
     }
 
-    auto partialContent =
-            Const::Content::fromRawBuffer(foldedPartialContent.getType(), foldedPartialContent.getRawTempBuf(),
-                                          foldedPartialContent.getStorageElemType(), foldedPartialContent.isSplat());
-    for (auto tr : lastTransformations) {
-        partialContent = tr.transform(partialContent);
-    }
+    const auto foldingStart = std::chrono::steady_clock::now();
+    auto partialContent = Const::details::applyTransformations(
+            Const::Content::fromRawBuffer(foldedPartialContent.getType(), foldedPartialContent.getRawStorageBuf(),
+                                          foldedPartialContent.getStorageElemType(), foldedPartialContent.isSplat()),
+            lastTransformations);
 
     // Create a copy of the Content which will own the referenced buffer
     // This is done since the Content object obtained after folding may reference an external object without
     // owning it. If that object is erased, the Content object from the cache would point to an invalid object
-    cache.addContent(request, partialContent.copyUnownedBuffer());
+    auto ownedContent = partialContent.copyUnownedBuffer();
+    const auto foldingCost = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() -
+                                                                                   foldingStart);
+    cache.addContent(request, ownedContent, foldingCost);
     cache.removeContent(partialContentAttr);
 
     return true;
@@ -117,15 +125,17 @@ private:
     std::condition_variable* const _cv;
 };
 
-void BackgroundConstantFolding::processFoldingRequest(const FoldingRequest& foldingRequest,
-                                                      ConstantFoldingCache& cache) {
+void BackgroundConstantFolding::waitForAvailableTask() {
     // As the main compilation process also utilizes the pool concurrently, _maxConcurrentTasks is introduced to
     // manually control the resources used by constant folding in background.
     std::unique_lock<std::mutex> lock(_mutex);
     _cv.wait(lock, [this] {
         return _activeTasks < _maxConcurrentTasks;
     });
+}
 
+void BackgroundConstantFolding::processFoldingRequest(const FoldingRequest& foldingRequest,
+                                                      ConstantFoldingCache& cache) {
     _activeTasks++;
     _ctx->getThreadPool().async([this, foldingRequest, &cache]() {
         TaskCompletionNotifier notifier(_activeTasks, _cv);
@@ -141,6 +151,14 @@ void BackgroundConstantFolding::processFoldingRequest(const FoldingRequest& fold
         }
         VPUX_THROW_WHEN(request == nullptr, "Invalid folding request");
 
+        // Threads which need the folded value of the request will wait for the completion instead of folding it again.
+        // The request is marked only once the task is running, so that threads never wait for a task which is still
+        // queued in the thread pool
+        cache.markRequestInProgress(request);
+        VPUX_SCOPE_EXIT {
+            cache.markRequestCompleted(request);
+        };
+
         if (cache.hasContent(request)) {
             if (cache.isStatisticsCollectionEnabled()) {
                 cache.getStatistics().numDuplicatedRequests++;
@@ -159,7 +177,11 @@ void BackgroundConstantFolding::processFoldingRequest(const FoldingRequest& fold
         // This is done since the Content object obtained after folding may reference an external object without
         // owning it. If that object is erased, the Content object from the cache would point to an invalid
         // object
-        cache.addContent(request, request.fold(/*bypassCache=*/true).copyUnownedBuffer());
+        const auto foldingStart = std::chrono::steady_clock::now();
+        auto content = request.fold(/*bypassCache=*/true).copyUnownedBuffer();
+        const auto foldingCost = std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - foldingStart);
+        cache.addContent(request, content, foldingCost);
     });
 }
 
@@ -169,6 +191,9 @@ std::shared_future<void> BackgroundConstantFolding::initFoldingListener(llvm::Th
         auto& cache = cacheManager.get(_ctx);
 
         while (true) {
+            // The request is taken from the queue only once it can be processed, so that the requests which are
+            // claimed by the compilation threads in the meantime are not folded in background too
+            waitForAvailableTask();
             auto foldingRequest = cache.getRequest();
             if (mlir::isa_and_nonnull<Const::TerminateRequestAttr>(foldingRequest.attr)) {
                 break;
@@ -192,7 +217,8 @@ void BackgroundConstantFolding::stopFoldingListener() {
     if (cache.isStatisticsCollectionEnabled()) {
         _log.setName("constant-folding-in-background");
         auto& statistics = cacheManager.get(_ctx).getStatistics();
-        _log.info("Cache statistics");
+        _log.info("Cache statistics ({0} eviction policy)",
+                  stringifyCacheEvictionPolicy(cacheManager.get(_ctx).getEvictionPolicy()));
         _log.nest().info("number of cache hits:                       {0}", statistics.numCacheHits);
         _log.nest().info("number of cache misses:                     {0}", statistics.numCacheMisses);
         _log.nest().info("maximum number of requests in queue:        {0}", statistics.getMaxNumRequestsInQueue());
@@ -203,6 +229,14 @@ void BackgroundConstantFolding::stopFoldingListener() {
         _log.nest().info("number of duplicated requests:              {0}", statistics.numDuplicatedRequests);
         _log.nest().info("total number of elements added to cache:    {0}", statistics.numElementsAddedToCache);
         _log.nest().info("total number of elements erased from cache: {0}", statistics.numElementsErasedFromCache);
+        _log.nest().info("number of evicted elements:                 {0}", statistics.numEvictions);
+        _log.nest().info("total memory evicted from cache:            {0}", statistics.numBytesEvicted);
+        _log.nest().info("total memory served from cache:             {0}", statistics.numBytesSaved);
+        _log.nest().info("folding time saved by cache hits (us):      {0}", statistics.foldingTimeSaved);
+        _log.nest().info("number of requests folded on demand:        {0}", statistics.numClaimedRequests);
+        _log.nest().info("number of waits for background folding:     {0}", statistics.numWaitedRequests);
+        _log.nest().info("time waiting for background folding (us):   {0}", statistics.waitingTime);
+        _log.nest().info("time folding on demand (us):                {0}", statistics.inlineFoldingTime);
     }
 
     cacheManager.removeCache(_ctx);
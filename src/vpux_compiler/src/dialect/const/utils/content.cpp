@@ -4,12 +4,15 @@
 //
 
 #include "vpux/compiler/dialect/const/utils/content.hpp"
+#include "vpux/compiler/dialect/const/utils/elem_type_conversion.hpp"
 
 #include "vpux/compiler/core/layers.hpp"
 #include "vpux/compiler/utils/loop.hpp"
 #include "vpux/compiler/utils/quantization.hpp"
 #include "vpux/utils/core/numeric.hpp"
 
+#include <mutex>
+
 using namespace vpux;
 
 //
@@ -26,6 +29,18 @@ Const::Content vpux::Const::Content::fromRawBuffer(vpux::NDTypeInterface type, A
     return content;
 }
 
+//
+// Content::fromExternalBuffer
+//
+
+Const::Content vpux::Const::Content::fromExternalBuffer(vpux::NDTypeInterface type, ArrayRef<char> data,
+                                                        mlir::Type storageElemType, bool isSplat,
+                                                        std::shared_ptr<const void> owner) {
+    auto content = fromRawBuffer(type, data, storageElemType, isSplat);
+    content._externalBuf = std::move(owner);
+    return content;
+}
+
 //
 // Content::allocTempBuffer
 //
@@ -77,6 +92,9 @@ Const::Content vpux::Const::Content::moveBuffer(vpux::NDTypeInterface type, Cons
     if (other._tempBuf != nullptr) {
         content._tempBuf = std::move(other._tempBuf);
     }
+    if (other._externalBuf != nullptr) {
+        content._externalBuf = std::move(other._externalBuf);
+    }
 
     return content;
 }
@@ -84,7 +102,7 @@ Const::Content vpux::Const::Content::moveBuffer(vpux::NDTypeInterface type, Cons
 // The Content object might not own the referred data. This function ensures the returned Content object owns the
 // referred data by copying it into a new buffer when needed
 Const::Content vpux::Const::Content::copyUnownedBuffer() {
-    if (_tempBuf != nullptr) {
+    if (_tempBuf != nullptr || _externalBuf != nullptr) {
         return *this;
     }
 
@@ -104,25 +122,52 @@ Const::Content vpux::Const::Content::copyUnownedBuffer() {
     return content;
 }
 
+//
+// FP16ClampStats
+//
+
+void vpux::Const::details::reportFP16Clamping(const FP16ClampStats& stats) {
+    if (stats.numClamped == 0) {
+        return;
+    }
+    Logger::global().warning("{0} values in range [{1}, {2}] are out of range for FP16; clamping to [{3}, {4}].",
+                             stats.numClamped, stats.minClamped, stats.maxClamped,
+                             static_cast<float>(std::numeric_limits<vpux::type::float16>::lowest()),
+                             static_cast<float>(std::numeric_limits<vpux::type::float16>::max()));
+}
+
 //
 // Content::copyTo
 //
 
 namespace {
 
-template <class Range>
-void fillBuf(const Range& range, MutableArrayRef<char> buf) {
-    using value_type = typename Range::iterator::value_type;
-    static const auto VALUE_BYTE_SIZE = sizeof(value_type);
+template <typename ElemT>
+void fillBuf(const Const::Content& content, MutableArrayRef<char> buf) {
+    static const auto VALUE_BYTE_SIZE = sizeof(ElemT);
+    const auto numElements = content.getType().getNumElements();
 
-    VPUX_THROW_UNLESS(buf.size() >= range.size() * VALUE_BYTE_SIZE,
+    VPUX_THROW_UNLESS(buf.size() >= static_cast<size_t>(numElements) * VALUE_BYTE_SIZE,
                       "Buffer with byte size '{0}' is not enough to hold actual elements with '{1}' byte size",
-                      buf.size(), range.size() * VALUE_BYTE_SIZE);
-
-    for (size_t i = 0; i < range.size(); ++i) {
-        auto* bufPtr = reinterpret_cast<value_type*>(buf.data() + i * VALUE_BYTE_SIZE);
-        *bufPtr = range[i];
-    }
+                      buf.size(), numElements * VALUE_BYTE_SIZE);
+
+    // The values clamped to FP16 are counted per chunk and reported once for the whole content
+    Const::details::FP16ClampStats clampStats;
+    std::mutex clampStatsMutex;
+    loop_chunked(LoopExecPolicy::Parallel, content.getType().getContext(), numElements,
+                 Const::details::PARALLEL_FOLDING_MIN_CHUNK_SIZE, [&](int64_t begin, int64_t end) {
+                     Const::details::FP16ClampStats chunkClampStats;
+                     const auto range = content.getValues<ElemT>(&chunkClampStats);
+                     for (auto i = begin; i < end; ++i) {
+                         auto* bufPtr = reinterpret_cast<ElemT*>(buf.data() + i * VALUE_BYTE_SIZE);
+                         *bufPtr = range[i];
+                     }
+                     if (chunkClampStats.numClamped != 0) {
+                         std::lock_guard<std::mutex> lock(clampStatsMutex);
+                         clampStats.merge(chunkClampStats);
+                     }
+                 });
+    Const::details::reportFP16Clamping(clampStats);
 }
 
 }  // namespace
@@ -204,9 +249,15 @@ void vpux::Const::Content::copyTo(MutableArrayRef<char> targetData) const {
         return;
     }
 
+    // Conversions between floating-point types are done in bulk, without a conversion callback per element
+    if (!_isSplat &&
+        Const::details::convertElements(_storageElemType, _data, elemType, targetData, getType().getNumElements())) {
+        return;
+    }
+
     dispatchByElemType<void>(elemType, [this, targetData](auto dummy) {
         using ElemT = std::decay_t<decltype(dummy)>;
-        fillBuf(this->getValues<ElemT>(), targetData);
+        fillBuf<ElemT>(*this, targetData);
     });
 }
 
@@ -0,0 +1,292 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/compiler/dialect/const/utils/elem_type_conversion.hpp"
+
+#include "vpux/compiler/dialect/const/utils/content.hpp"
+#include "vpux/compiler/utils/loop.hpp"
+
+#include "vpux/utils/core/error.hpp"
+#include "vpux/utils/core/type/bfloat16.hpp"
+#include "vpux/utils/core/type/float16.hpp"
+#include "vpux/utils/core/type/float8_e4m3.hpp"
+#include "vpux/utils/core/type/float8_e5m2.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <mutex>
+#include <type_traits>
+
+// The SIMD kernels are compiled for the target ISA through function attributes and selected at runtime, so that the
+// rest of the compiler does not have to be built with AVX2 / AVX-512 enabled
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define VPUX_CONST_X86_CONVERSION_KERNELS
+#include <immintrin.h>
+#endif
+
+using namespace vpux;
+
+namespace {
+
+//
+// Scalar kernels
+//
+
+// Same conversion as `CvtHelper<vpux::type::float16>`
+void convertF32ToF16Scalar(const float* src, type::float16* dst, int64_t size, Const::details::FP16ClampStats& stats) {
+    for (int64_t i = 0; i < size; ++i) {
+        auto castedVal = type::float16(src[i]);
+        if (std::isinf(castedVal)) {
+            stats.add(src[i]);
+            castedVal = std::numeric_limits<type::float16>::clamp(castedVal);
+        }
+        dst[i] = castedVal;
+    }
+}
+
+void convertF16ToF32Scalar(const type::float16* src, float* dst, int64_t size) {
+    for (int64_t i = 0; i < size; ++i) {
+        dst[i] = static_cast<float>(src[i]);
+    }
+}
+
+template <typename InT, typename OutT>
+void convertScalar(const InT* src, OutT* dst, int64_t size) {
+    for (int64_t i = 0; i < size; ++i) {
+        dst[i] = OutT(static_cast<float>(src[i]));
+    }
+}
+
+//
+// SIMD kernels
+//
+
+#ifdef VPUX_CONST_X86_CONVERSION_KERNELS
+
+constexpr int16_t F16_EXP_MASK = 0x7c00;
+constexpr int32_t F32_ABS_MASK = 0x7fffffff;
+// Bit pattern of the smallest normal FP16 value (2^-14) stored as FP32
+constexpr int32_t F16_MIN_NORMAL_AS_F32 = 0x38800000;
+
+// Vectors containing Inf / NaN values (either in the input or produced by an overflow) are handled by the scalar
+// kernel, so that clamping and NaN payloads are identical to the element-wise conversion. The same goes for values
+// which become FP16 subnormals, as the rounding of `vpux::type::float16` differs from IEEE rounding for some of them
+__attribute__((target("avx2,f16c"))) void convertF32ToF16Avx2(const float* src, type::float16* dst, int64_t size,
+                                                               Const::details::FP16ClampStats& stats) {
+    const auto expMask = _mm_set1_epi16(F16_EXP_MASK);
+    const auto absMask = _mm256_set1_epi32(F32_ABS_MASK);
+    const auto minNormal = _mm256_set1_epi32(F16_MIN_NORMAL_AS_F32);
+    const auto zero = _mm256_setzero_si256();
+    int64_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        const auto vals = _mm256_loadu_ps(src + i);
+        const auto absBits = _mm256_and_si256(_mm256_castps_si256(vals), absMask);
+        const auto subnormal =
+                _mm256_and_si256(_mm256_cmpgt_epi32(absBits, zero), _mm256_cmpgt_epi32(minNormal, absBits));
+        const auto half = _mm256_cvtps_ph(vals, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        const auto special = _mm_cmpeq_epi16(_mm_and_si128(half, expMask), expMask);
+        if (_mm_testz_si128(special, special) && _mm256_testz_si256(subnormal, subnormal)) {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), half);
+        } else {
+            convertF32ToF16Scalar(src + i, dst + i, 8, stats);
+        }
+    }
+    convertF32ToF16Scalar(src + i, dst + i, size - i, stats);
+}
+
+__attribute__((target("avx512f,avx2,f16c"))) void convertF32ToF16Avx512(const float* src, type::float16* dst,
+                                                                         int64_t size,
+                                                                         Const::details::FP16ClampStats& stats) {
+    const auto expMask = _mm256_set1_epi16(F16_EXP_MASK);
+    const auto absMask = _mm512_set1_epi32(F32_ABS_MASK);
+    const auto minNormal = _mm512_set1_epi32(F16_MIN_NORMAL_AS_F32);
+    int64_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+        const auto vals = _mm512_loadu_ps(src + i);
+        const auto absBits = _mm512_and_si512(_mm512_castps_si512(vals), absMask);
+        const auto subnormal =
+                _mm512_mask_cmplt_epi32_mask(_mm512_test_epi32_mask(absBits, absBits), absBits, minNormal);
+        const auto half = _mm512_cvtps_ph(vals, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        const auto special = _mm256_cmpeq_epi16(_mm256_and_si256(half, expMask), expMask);
+        if (_mm256_testz_si256(special, special) && subnormal == 0) {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), half);
+        } else {
+            convertF32ToF16Scalar(src + i, dst + i, 16, stats);
+        }
+    }
+    convertF32ToF16Avx2(src + i, dst + i, size - i, stats);
+}
+
+__attribute__((target("avx2,f16c"))) void convertF16ToF32Avx2(const type::float16* src, float* dst, int64_t size) {
+    const auto expMask = _mm_set1_epi16(F16_EXP_MASK);
+    int64_t i = 0;
+    for (; i + 8 <= size; i += 8) {
+        const auto half = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        const auto special = _mm_cmpeq_epi16(_mm_and_si128(half, expMask), expMask);
+        if (_mm_testz_si128(special, special)) {
+            _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(half));
+        } else {
+            convertF16ToF32Scalar(src + i, dst + i, 8);
+        }
+    }
+    convertF16ToF32Scalar(src + i, dst + i, size - i);
+}
+
+__attribute__((target("avx512f,avx2,f16c"))) void convertF16ToF32Avx512(const type::float16* src, float* dst,
+                                                                         int64_t size) {
+    const auto expMask = _mm256_set1_epi16(F16_EXP_MASK);
+    int64_t i = 0;
+    for (; i + 16 <= size; i += 16) {
+        const auto half = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        const auto special = _mm256_cmpeq_epi16(_mm256_and_si256(half, expMask), expMask);
+        if (_mm256_testz_si256(special, special)) {
+            _mm512_storeu_ps(dst + i, _mm512_cvtph_ps(half));
+        } else {
+            convertF16ToF32Scalar(src + i, dst + i, 16);
+        }
+    }
+    convertF16ToF32Avx2(src + i, dst + i, size - i);
+}
+
+enum class SimdLevel { None, Avx2, Avx512 };
+
+SimdLevel getSimdLevel() {
+    static const auto level = [] {
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx2") && __builtin_cpu_supports("f16c")) {
+            return SimdLevel::Avx512;
+        }
+        if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("f16c")) {
+            return SimdLevel::Avx2;
+        }
+        return SimdLevel::None;
+    }();
+    return level;
+}
+
+#endif
+
+void convertF32ToF16(const float* src, type::float16* dst, int64_t size, Const::details::FP16ClampStats& stats) {
+#ifdef VPUX_CONST_X86_CONVERSION_KERNELS
+    switch (getSimdLevel()) {
+    case SimdLevel::Avx512:
+        return convertF32ToF16Avx512(src, dst, size, stats);
+    case SimdLevel::Avx2:
+        return convertF32ToF16Avx2(src, dst, size, stats);
+    default:
+        break;
+    }
+#endif
+    convertF32ToF16Scalar(src, dst, size, stats);
+}
+
+void convertF16ToF32(const type::float16* src, float* dst, int64_t size) {
+#ifdef VPUX_CONST_X86_CONVERSION_KERNELS
+    switch (getSimdLevel()) {
+    case SimdLevel::Avx512:
+        return convertF16ToF32Avx512(src, dst, size);
+    case SimdLevel::Avx2:
+        return convertF16ToF32Avx2(src, dst, size);
+    default:
+        break;
+    }
+#endif
+    convertF16ToF32Scalar(src, dst, size);
+}
+
+//
+// Dispatching
+//
+
+template <typename InT, typename OutT>
+void convertSpan(const InT* src, OutT* dst, int64_t size, Const::details::FP16ClampStats& stats) {
+    if constexpr (std::is_same_v<InT, float> && std::is_same_v<OutT, type::float16>) {
+        convertF32ToF16(src, dst, size, stats);
+    } else if constexpr (std::is_same_v<InT, type::float16> && std::is_same_v<OutT, float>) {
+        convertF16ToF32(src, dst, size);
+    } else if constexpr (std::is_same_v<OutT, type::float16>) {
+        for (int64_t i = 0; i < size; ++i) {
+            const auto val = static_cast<float>(src[i]);
+            convertF32ToF16Scalar(&val, dst + i, 1, stats);
+        }
+    } else {
+        convertScalar(src, dst, size);
+    }
+}
+
+template <typename Caller>
+bool dispatchFloatType(mlir::Type elemType, Caller&& caller) {
+    if (elemType.isF32()) {
+        caller(float(0));
+    } else if (elemType.isF16()) {
+        caller(type::float16(0.0f));
+    } else if (elemType.isBF16()) {
+        caller(type::bfloat16(0.0f));
+    } else if (elemType.isFloat8E4M3FN()) {
+        caller(type::float8_e4m3(0.0f));
+    } else if (elemType.isFloat8E5M2()) {
+        caller(type::float8_e5m2(0.0f));
+    } else {
+        return false;
+    }
+    return true;
+}
+
+}  // namespace
+
+//
+// isBulkConversionSupported
+//
+
+bool Const::details::isBulkConversionSupported(mlir::Type srcElemType, mlir::Type dstElemType) {
+    const auto isSupportedType = [](mlir::Type elemType) {
+        return dispatchFloatType(elemType, [](auto) {});
+    };
+    return srcElemType != dstElemType && isSupportedType(srcElemType) && isSupportedType(dstElemType);
+}
+
+//
+// convertElements
+//
+
+bool Const::details::convertElements(mlir::Type srcElemType, ArrayRef<char> src, mlir::Type dstElemType,
+                                     MutableArrayRef<char> dst, int64_t numElements) {
+    if (!isBulkConversionSupported(srcElemType, dstElemType)) {
+        return false;
+    }
+
+    // The values clamped to FP16 are counted per chunk and reported once for the whole buffer
+    details::FP16ClampStats clampStats;
+    std::mutex clampStatsMutex;
+
+    dispatchFloatType(srcElemType, [&](auto srcDummy) {
+        using InT = std::decay_t<decltype(srcDummy)>;
+        dispatchFloatType(dstElemType, [&](auto dstDummy) {
+            using OutT = std::decay_t<decltype(dstDummy)>;
+            VPUX_THROW_UNLESS(src.size() >= static_cast<size_t>(numElements) * sizeof(InT),
+                              "Source buffer with byte size '{0}' is smaller than {1} elements of type '{2}'",
+                              src.size(), numElements, srcElemType);
+            VPUX_THROW_UNLESS(dst.size() >= static_cast<size_t>(numElements) * sizeof(OutT),
+                              "Buffer with byte size '{0}' is not enough to hold {1} elements of type '{2}'",
+                              dst.size(), numElements, dstElemType);
+
+            const auto srcPtr = reinterpret_cast<const InT*>(src.data());
+            const auto dstPtr = reinterpret_cast<OutT*>(dst.data());
+            loop_chunked(LoopExecPolicy::Parallel, srcElemType.getContext(), numElements,
+                         PARALLEL_FOLDING_MIN_CHUNK_SIZE, [&](int64_t begin, int64_t end) {
+                             Const::details::FP16ClampStats chunkStats;
+                             convertSpan(srcPtr + begin, dstPtr + begin, end - begin, chunkStats);
+                             if (chunkStats.numClamped != 0) {
+                                 std::lock_guard<std::mutex> lock(clampStatsMutex);
+                                 clampStats.merge(chunkStats);
+                             }
+                         });
+        });
+    });
+
+    details::reportFP16Clamping(clampStats);
+    return true;
+}
@@ -0,0 +1,342 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/compiler/dialect/const/utils/fused_transformations.hpp"
+
+#include "vpux/compiler/dialect/const/attributes/content.hpp"
+#include "vpux/compiler/utils/loop.hpp"
+#include "vpux/compiler/utils/quantization.hpp"
+#include "vpux/compiler/utils/types.hpp"
+
+#include "vpux/utils/core/error.hpp"
+#include "vpux/utils/core/range.hpp"
+
+#include <mlir/Dialect/Quant/QuantTypes.h>
+
+#include <numeric>
+#include <optional>
+
+using namespace vpux;
+
+namespace {
+
+bool isSupportedStorageType(mlir::Type storageElemType) {
+    if (storageElemType.isF32() || storageElemType.isF16() || storageElemType.isBF16()) {
+        return true;
+    }
+    if (const auto intType = mlir::dyn_cast<mlir::IntegerType>(storageElemType)) {
+        const auto width = intType.getWidth();
+        return width == 8 || width == 16 || width == 32;
+    }
+    return false;
+}
+
+// Returns the memory permutation of an index-remapping transformation, in the form used by
+// `Const::details::memPermuteTransformation`: memory dimension `i` of the output takes the index of memory dimension
+// `perm[i]` of the input
+std::optional<SmallVector<int64_t>> getMemPerm(Const::TransformAttrInterface attr, vpux::NDTypeInterface inType,
+                                               vpux::NDTypeInterface outType) {
+    const auto inOrder = inType.getDimsOrder();
+    const auto outOrder = outType.getDimsOrder();
+    if (inOrder.numDims() != outOrder.numDims()) {
+        return std::nullopt;
+    }
+
+    mlir::AffineMap memPerm;
+    if (mlir::isa<Const::ReorderAttr>(attr)) {
+        SmallVector<int64_t> perm;
+        for (const auto dim : outOrder.toPermutation()) {
+            perm.push_back(inOrder.dimPos(dim));
+        }
+        return perm;
+    } else if (auto memPermuteAttr = mlir::dyn_cast<Const::MemPermuteAttr>(attr)) {
+        memPerm = memPermuteAttr.getMemPerm().getValue();
+    } else if (auto transposeAttr = mlir::dyn_cast<Const::TransposeAttr>(attr)) {
+        memPerm = inOrder.toAffineMap(attr.getContext()).compose(transposeAttr.getOrder().getValue());
+    } else {
+        return std::nullopt;
+    }
+
+    const auto permOrder = DimsOrder::fromAffineMap(memPerm);
+    if (permOrder.numDims() != inOrder.numDims()) {
+        return std::nullopt;
+    }
+    SmallVector<int64_t> perm;
+    for (const auto dim : permOrder.toPermutation()) {
+        perm.push_back(dim.ind());
+    }
+    return perm;
+}
+
+template <typename Caller>
+void dispatchByOutStorageType(mlir::Type storageElemType, Caller&& caller) {
+    auto ctx = storageElemType.getContext();
+    if (storageElemType.isF32()) {
+        caller(float(0));
+    } else if (storageElemType == getSInt8Type(ctx)) {
+        caller(int8_t(0));
+    } else if (storageElemType == getUInt8Type(ctx)) {
+        caller(uint8_t(0));
+    } else if (storageElemType == getSInt16Type(ctx)) {
+        caller(int16_t(0));
+    } else if (storageElemType == getUInt16Type(ctx)) {
+        caller(uint16_t(0));
+    } else if (storageElemType == getSInt32Type(ctx)) {
+        caller(int32_t(0));
+    } else if (storageElemType == getUInt32Type(ctx)) {
+        caller(uint32_t(0));
+    } else {
+        VPUX_THROW("Unsupported storage type '{0}' for fused transformations", storageElemType);
+    }
+}
+
+bool isSupportedOutStorageType(mlir::Type storageElemType) {
+    auto ctx = storageElemType.getContext();
+    return storageElemType.isF32() || storageElemType == getSInt8Type(ctx) || storageElemType == getUInt8Type(ctx) ||
+           storageElemType == getSInt16Type(ctx) || storageElemType == getUInt16Type(ctx) ||
+           storageElemType == getSInt32Type(ctx) || storageElemType == getUInt32Type(ctx);
+}
+
+// Returns the storage type the quantized values are written into, or nullptr if it is not supported. The storage type
+// of the quantized types is usually signless, with the signedness kept in a flag of the quantized type. 4-bit values
+// are stored one per byte, the same way `ConvertElemType` to a sub-byte type leaves them, and packed on copy
+mlir::Type getQuantizeOutStorageType(mlir::quant::QuantizedType qElemType) {
+    auto storageElemType = qElemType.getStorageType();
+    const auto intType = mlir::dyn_cast<mlir::IntegerType>(storageElemType);
+    if (intType != nullptr && intType.isSignless()) {
+        const auto width = intType.getWidth();
+        if (width != 4 && width != 8) {
+            return nullptr;
+        }
+        storageElemType = mlir::IntegerType::get(intType.getContext(), 8,
+                                                 qElemType.isSigned() ? mlir::IntegerType::Signed
+                                                                      : mlir::IntegerType::Unsigned);
+    }
+    return isSupportedOutStorageType(storageElemType) ? storageElemType : nullptr;
+}
+
+}  // namespace
+
+//
+// FusedTransformations::match
+//
+
+Const::details::FusedTransformations Const::details::FusedTransformations::match(
+        const Const::Content& input, ArrayRef<Const::TransformAttrInterface> transformations) {
+    FusedTransformations fused;
+
+    auto storageElemType = input.getStorageElemType();
+    if (input.isSplat() || transformations.size() < 2 || !isSupportedStorageType(storageElemType)) {
+        return fused;
+    }
+
+    auto type = input.getType();
+    auto isIntegerStorage = mlir::isa<mlir::IntegerType>(storageElemType);
+    const auto rank = checked_cast<int64_t>(type.getRank());
+    SmallVector<int64_t> inMemDims(rank);
+    std::iota(inMemDims.begin(), inMemDims.end(), 0);
+
+    size_t numTransformations = 0;
+    size_t numMatchedStages = 0;
+    mlir::Type matchedStorageElemType;
+    vpux::NDTypeInterface matchedType;
+    SmallVector<int64_t> matchedInMemDims;
+    SmallVector<ElementwiseStage> stages;
+
+    for (const auto& attr : transformations) {
+        const auto outType = attr.inferOutputType(type);
+        if (outType.getNumElements() != type.getNumElements()) {
+            break;
+        }
+
+        if (auto addAttr = mlir::dyn_cast<Const::AddAttr>(attr)) {
+            ElementwiseStage stage{ElementwiseStage::Kind::Add};
+            stage.value = static_cast<float>(addAttr.getBias().getValue().convertToDouble());
+            stages.push_back(stage);
+            storageElemType = mlir::Float32Type::get(attr.getContext());
+        } else if (auto rescaleAttr = mlir::dyn_cast<Const::RescaleAttr>(attr)) {
+            ElementwiseStage stage{ElementwiseStage::Kind::Rescale};
+            stage.value = static_cast<float>(rescaleAttr.getScale().getValue().convertToDouble());
+            stages.push_back(stage);
+            storageElemType = mlir::Float32Type::get(attr.getContext());
+        } else if (mlir::isa<Const::DequantizeAttr>(attr)) {
+            const auto qElemType = mlir::dyn_cast<mlir::quant::UniformQuantizedType>(type.getElementType());
+            if (qElemType == nullptr || !isIntegerStorage) {
+                break;
+            }
+            ElementwiseStage stage{ElementwiseStage::Kind::Dequantize};
+            stage.scale = qElemType.getScale();
+            stage.zeroPoint = qElemType.getZeroPoint();
+            stages.push_back(stage);
+            storageElemType = mlir::Float32Type::get(attr.getContext());
+        } else if (auto quantizeAttr = mlir::dyn_cast<Const::QuantizeAttr>(attr)) {
+            const auto qElemType =
+                    mlir::dyn_cast_or_null<mlir::quant::UniformQuantizedType>(quantizeAttr.getTargetType());
+            const auto outStorageElemType = qElemType != nullptr ? getQuantizeOutStorageType(qElemType) : nullptr;
+            if (outStorageElemType == nullptr) {
+                break;
+            }
+            // Same parameters as the ones used by `QuantizeAttr::transform`
+            const auto qMin = qElemType.getStorageTypeMin();
+            const auto qMax = qElemType.getStorageTypeMax();
+            ElementwiseStage stage{ElementwiseStage::Kind::Quantize};
+            stage.inLow = dequantize(qMin, qElemType.getScale(), qElemType.getZeroPoint());
+            stage.inHigh = dequantize(qMax, qElemType.getScale(), qElemType.getZeroPoint());
+            stage.qLow = static_cast<float>(qMin);
+            stage.qHigh = static_cast<float>(qMax);
+            stage.levels = static_cast<float>(qMax - qMin + 1);
+            stages.push_back(stage);
+            storageElemType = outStorageElemType;
+        } else if (mlir::isa<Const::ConvertElemTypeAttr>(attr)) {
+            // The storage is left untouched, the element type is only reinterpreted
+            if (vpux::getElemTypeSize(outType).count() < CHAR_BIT) {
+                break;
+            }
+        } else if (const auto perm = getMemPerm(attr, type, outType); perm.has_value()) {
+            SmallVector<int64_t> newInMemDims(rank);
+            for (auto outMemDim : irange(rank)) {
+                newInMemDims[outMemDim] = inMemDims[perm.value()[outMemDim]];
+            }
+            inMemDims = std::move(newInMemDims);
+        } else {
+            break;
+        }
+
+        isIntegerStorage = mlir::isa<mlir::IntegerType>(storageElemType);
+        type = outType;
+        ++numTransformations;
+
+        // Only prefixes with at least one element-wise transformation need to be evaluated here, pure data movement
+        // is already handled efficiently by the staged path
+        if (!stages.empty()) {
+            fused._numTransformations = numTransformations;
+            numMatchedStages = stages.size();
+            matchedStorageElemType = storageElemType;
+            matchedType = type;
+            matchedInMemDims = inMemDims;
+        }
+    }
+
+    if (fused._numTransformations < 2) {
+        fused._numTransformations = 0;
+        return fused;
+    }
+
+    stages.resize(numMatchedStages);
+    fused._stages = std::move(stages);
+    fused._inMemDims = std::move(matchedInMemDims);
+    fused._outType = matchedType;
+    fused._outStorageElemType = matchedStorageElemType;
+    return fused;
+}
+
+//
+// FusedTransformations::evaluate
+//
+
+// Every step converts its input and result exactly like the corresponding staged transformation does when reading
+// the values of its input content and writing them into its output storage
+double Const::details::FusedTransformations::evaluate(double value) const {
+    for (const auto& stage : _stages) {
+        switch (stage.kind) {
+        case ElementwiseStage::Kind::Add:
+            value = static_cast<float>(value) + stage.value;
+            break;
+        case ElementwiseStage::Kind::Rescale:
+            value = static_cast<float>(value) * stage.value;
+            break;
+        case ElementwiseStage::Kind::Dequantize:
+            value = dequantize(static_cast<int64_t>(value), stage.scale, stage.zeroPoint);
+            break;
+        case ElementwiseStage::Kind::Quantize:
+            value = static_cast<double>(static_cast<int64_t>(fakeQuantize(
+                    static_cast<float>(value), stage.inLow, stage.inHigh, stage.qLow, stage.qHigh, stage.levels)));
+            break;
+        }
+    }
+    return value;
+}
+
+//
+// FusedTransformations::apply
+//
+
+Const::Content Const::details::FusedTransformations::apply(const Const::Content& input) const {
+    VPUX_THROW_WHEN(_numTransformations == 0, "No transformations were matched for fusing");
+
+    auto ctx = _outType.getContext();
+    auto output = Const::Content::allocTempBuffer(_outType, _outStorageElemType, /*isSplat=*/false);
+
+    const auto inMemShape = input.getType().getDimsOrder().toMemoryOrder(input.getType().getShape());
+    const auto outMemShape = _outType.getDimsOrder().toMemoryOrder(_outType.getShape());
+    const auto rank = checked_cast<int64_t>(inMemShape.size());
+    VPUX_THROW_UNLESS(checked_cast<int64_t>(outMemShape.size()) == rank, "Rank mismatch between '{0}' and '{1}'",
+                      inMemShape, outMemShape);
+
+    // Stride of the output buffer for every memory dimension of the input, so that the output index can be updated
+    // incrementally while the input is traversed linearly
+    SmallVector<int64_t> inDims(rank);
+    SmallVector<int64_t> outStrides(rank);
+    int64_t outStride = 1;
+    bool isIdentity = true;
+    for (auto outMemDim : irange(rank) | reversed) {
+        const auto inMemDim = _inMemDims[outMemDim];
+        VPUX_THROW_UNLESS(outMemShape[MemDim(outMemDim)] == inMemShape[MemDim(inMemDim)],
+                          "Memory shape mismatch between '{0}' and '{1}'", inMemShape, outMemShape);
+        inDims[inMemDim] = inMemShape[MemDim(inMemDim)];
+        outStrides[inMemDim] = outStride;
+        outStride *= outMemShape[MemDim(outMemDim)];
+        isIdentity &= inMemDim == outMemDim;
+    }
+
+    const auto numElements = input.getType().getNumElements();
+    const auto isIntegerInput = mlir::isa<mlir::IntegerType>(input.getStorageElemType());
+
+    const auto process = [&](auto inValues, auto outValues) {
+        loop_chunked(LoopExecPolicy::Parallel, ctx, numElements, PARALLEL_FOLDING_MIN_CHUNK_SIZE,
+                     [&](int64_t begin, int64_t end) {
+                         using OutT = typename std::decay_t<decltype(outValues)>::value_type;
+                         if (isIdentity) {
+                             for (auto i = begin; i < end; ++i) {
+                                 outValues[i] = static_cast<OutT>(evaluate(static_cast<double>(inValues[i])));
+                             }
+                             return;
+                         }
+
+                         SmallVector<int64_t> coords(rank);
+                         int64_t outIdx = 0;
+                         for (int64_t dim = rank - 1, rest = begin; dim >= 0; --dim) {
+                             coords[dim] = rest % inDims[dim];
+                             rest /= inDims[dim];
+                             outIdx += coords[dim] * outStrides[dim];
+                         }
+
+                         for (auto i = begin; i < end; ++i) {
+                             outValues[outIdx] = static_cast<OutT>(evaluate(static_cast<double>(inValues[i])));
+
+                             for (auto dim = rank - 1; dim >= 0; --dim) {
+                                 outIdx += outStrides[dim];
+                                 if (++coords[dim] < inDims[dim]) {
+                                     break;
+                                 }
+                                 outIdx -= inDims[dim] * outStrides[dim];
+                                 coords[dim] = 0;
+                             }
+                         }
+                     });
+    };
+
+    dispatchByOutStorageType(_outStorageElemType, [&](auto dummy) {
+        using OutT = std::decay_t<decltype(dummy)>;
+        auto outValues = output.getTempBuf<OutT>();
+        if (isIntegerInput) {
+            process(input.getValues<int64_t>(), outValues);
+        } else {
+            process(input.getValues<float>(), outValues);
+        }
+    });
+
+    return output;
+}
@@ -4,220 +4,440 @@
 //
 
 #include "vpux/compiler/dialect/const/utils/mem_permute_optimized.hpp"
-#include "vpux/compiler/dialect/const/attributes/content.hpp"
 #include "vpux/compiler/utils/loop.hpp"
 
+#include "vpux/utils/core/error.hpp"
+#include "vpux/utils/core/numeric.hpp"
+#include "vpux/utils/core/range.hpp"
+#include "vpux/utils/core/small_vector.hpp"
+
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define VPUX_CONST_SSE2_PERMUTE_KERNELS
+#endif
+
 using namespace vpux;
 
 namespace {
 
-size_t getContentRank(vpux::Const::Content& content) {
-    return content.getType().getRank();
+// Number of elements along each side of the tiles used for 2D transposes, chosen so that the lines of a tile stay in
+// L1 cache while they are read or written
+constexpr int64_t TILE_SIZE = 32;
+// Minimal amount of work given to one task, in tiles for transposes and in bytes for row copies
+constexpr int64_t MIN_TILES_PER_TASK = 16;
+constexpr int64_t MIN_BYTES_PER_TASK = 64 * 1024;
+
+//
+// PermutePlan
+//
+// Output memory shape with the input stride (in elements) of every output memory dimension. Dimensions of size 1 are
+// dropped and consecutive dimensions which are also consecutive in the input are merged, so that e.g. NCHW -> NHWC
+// becomes [N, HW, C] with input strides [CHW, 1, HW].
+//
+
+struct PermutePlan {
+    SmallVector<int64_t> shape;
+    SmallVector<int64_t> inStrides;
+    SmallVector<int64_t> outStrides;
+};
+
+PermutePlan makePlan(ArrayRef<int64_t> inMemShape, DimsOrder permOrder, int64_t innerElemSize) {
+    const auto rank = inMemShape.size();
+    SmallVector<int64_t> inCompactStrides(rank, innerElemSize);
+    for (size_t ind = rank; ind-- > 1;) {
+        inCompactStrides[ind - 1] = inCompactStrides[ind] * inMemShape[ind];
+    }
+
+    PermutePlan plan;
+    const auto appendDim = [&](int64_t size, int64_t inStride) {
+        if (size == 1) {
+            return;
+        }
+        if (!plan.shape.empty() && plan.inStrides.back() == inStride * size) {
+            plan.shape.back() *= size;
+            plan.inStrides.back() = inStride;
+            return;
+        }
+        plan.shape.push_back(size);
+        plan.inStrides.push_back(inStride);
+    };
+    for (auto outInd : irange(rank)) {
+        const auto inInd = checked_cast<size_t>(permOrder.dimAt(outInd).ind());
+        appendDim(inMemShape[inInd], inCompactStrides[inInd]);
+    }
+    // Elements which are not copied as a whole are split into bytes, which are never permuted
+    appendDim(innerElemSize, 1);
+
+    plan.outStrides.assign(plan.shape.size(), 1);
+    for (size_t ind = plan.shape.size(); ind-- > 1;) {
+        plan.outStrides[ind - 1] = plan.outStrides[ind] * plan.shape[ind];
+    }
+    return plan;
 }
 
-struct OvLike4DStrides {
-    OvLike4DStrides(vpux::NDTypeInterface type) {
-        const auto order = type.getDimsOrder();
-        const auto strides = type.getMemStrides();
-        const auto refStrides = order.toLogicalOrder(strides);
-        const auto elemSizeBits = getElemTypeSize(type).count();
+//
+// OuterIndex
+//
+// Walks over the outer dimensions of a plan in row-major order, keeping track of the matching input and output offsets
+//
 
-        this->N = refStrides[Dim(0)].count() / elemSizeBits;
-        this->C = refStrides[Dim(1)].count() / elemSizeBits;
-        this->H = refStrides[Dim(2)].count() / elemSizeBits;
-        this->W = refStrides[Dim(3)].count() / elemSizeBits;
+class OuterIndex final {
+public:
+    OuterIndex(const PermutePlan& plan, ArrayRef<size_t> dims, int64_t linearIndex): _plan(plan), _dims(dims) {
+        _index.resize(dims.size());
+        for (size_t pos = dims.size(); pos-- > 0;) {
+            const auto dim = dims[pos];
+            _index[pos] = linearIndex % plan.shape[dim];
+            linearIndex /= plan.shape[dim];
+            _inOffset += _index[pos] * plan.inStrides[dim];
+            _outOffset += _index[pos] * plan.outStrides[dim];
+        }
     }
 
-    size_t N;
-    size_t C;
-    size_t H;
-    size_t W;
+    int64_t inOffset() const {
+        return _inOffset;
+    }
+
+    int64_t outOffset() const {
+        return _outOffset;
+    }
+
+    void next() {
+        for (size_t pos = _dims.size(); pos-- > 0;) {
+            const auto dim = _dims[pos];
+            _inOffset += _plan.inStrides[dim];
+            _outOffset += _plan.outStrides[dim];
+            if (++_index[pos] < _plan.shape[dim]) {
+                return;
+            }
+            _inOffset -= _index[pos] * _plan.inStrides[dim];
+            _outOffset -= _index[pos] * _plan.outStrides[dim];
+            _index[pos] = 0;
+        }
+    }
+
+private:
+    const PermutePlan& _plan;
+    ArrayRef<size_t> _dims;
+    SmallVector<int64_t> _index;
+    int64_t _inOffset = 0;
+    int64_t _outOffset = 0;
 };
 
-struct OvLike5DStrides {
-    OvLike5DStrides(vpux::NDTypeInterface type) {
-        const auto order = type.getDimsOrder();
-        const auto strides = type.getMemStrides();
-        const auto refStrides = order.toLogicalOrder(strides);
-        const auto elemSizeBits = getElemTypeSize(type).count();
-
-        this->N = refStrides[Dim(0)].count() / elemSizeBits;
-        this->C = refStrides[Dim(1)].count() / elemSizeBits;
-        this->D = refStrides[Dim(2)].count() / elemSizeBits;
-        this->H = refStrides[Dim(3)].count() / elemSizeBits;
-        this->W = refStrides[Dim(4)].count() / elemSizeBits;
-    }
-
-    size_t N;
-    size_t C;
-    size_t D;
-    size_t H;
-    size_t W;
+//
+// Block transpose kernels
+//
+// `run` transposes a square block of SIZE x SIZE elements: dst[b * dstStride + a] = src[a * srcStride + b]
+//
+
+template <typename T>
+struct BlockKernel {
+    static constexpr int64_t SIZE = 1;
+
+    static void run(const T*, int64_t, T*, int64_t) {
+    }
 };
 
-template <typename StorageType>
-void blob_copy_4d_t(vpux::Const::Content& input, vpux::Const::Content& output, mlir::MLIRContext* ctx) {
-    const StorageType* srcPtr = reinterpret_cast<const StorageType*>(input.getRawStorageBuf().data());
-    StorageType* dstPtr = reinterpret_cast<StorageType*>(output.getRawTempBuf().data());
-
-    auto shapeRef = input.getType().getShape();
-    SmallVector<int64_t> shape(shapeRef.begin(), shapeRef.end());
-
-    const size_t N = shape[0];
-    const size_t C = shape[1];
-    const size_t H = shape[2];
-    const size_t W = shape[3];
-
-    const auto inputStrides = OvLike4DStrides(input.getType());
-    const auto outputStrides = OvLike4DStrides(output.getType());
-    const auto loopPolicy = LoopExecPolicy::Parallel;
-    if (input.getType().getDimsOrder() == DimsOrder::NHWC) {
-        loop_2d(loopPolicy, ctx, N, C, [&](size_t n, size_t c) {
-            StorageType* dst_ptr_l = dstPtr + n * outputStrides.N + c * outputStrides.C;
-            const StorageType* src_ptr_l = srcPtr + n * inputStrides.N + c * inputStrides.C;
-            for (size_t h = 0; h < H; h++) {
-                const StorageType* src_ptr_l_l = src_ptr_l + h * inputStrides.H;
-                for (size_t w = 0; w < W; w++) {
-                    *dst_ptr_l = *src_ptr_l_l;
-                    src_ptr_l_l += inputStrides.W;
-                    dst_ptr_l++;
-                }
+#ifdef VPUX_CONST_SSE2_PERMUTE_KERNELS
+
+inline void transpose4x32(__m128i& r0, __m128i& r1, __m128i& r2, __m128i& r3) {
+    const auto t0 = _mm_unpacklo_epi32(r0, r1);
+    const auto t1 = _mm_unpacklo_epi32(r2, r3);
+    const auto t2 = _mm_unpackhi_epi32(r0, r1);
+    const auto t3 = _mm_unpackhi_epi32(r2, r3);
+    r0 = _mm_unpacklo_epi64(t0, t1);
+    r1 = _mm_unpackhi_epi64(t0, t1);
+    r2 = _mm_unpacklo_epi64(t2, t3);
+    r3 = _mm_unpackhi_epi64(t2, t3);
+}
+
+template <>
+struct BlockKernel<uint32_t> {
+    static constexpr int64_t SIZE = 4;
+
+    static void run(const uint32_t* src, int64_t srcStride, uint32_t* dst, int64_t dstStride) {
+        auto r0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+        auto r1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + srcStride));
+        auto r2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 2 * srcStride));
+        auto r3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 3 * srcStride));
+        transpose4x32(r0, r1, r2, r3);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), r0);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + dstStride), r1);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 2 * dstStride), r2);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + 3 * dstStride), r3);
+    }
+};
+
+template <>
+struct BlockKernel<uint16_t> {
+    static constexpr int64_t SIZE = 8;
+
+    static void run(const uint16_t* src, int64_t srcStride, uint16_t* dst, int64_t dstStride) {
+        __m128i r[SIZE];
+        for (int64_t a = 0; a < SIZE; ++a) {
+            r[a] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + a * srcStride));
+        }
+        // Interleave pairs of lines, then transpose the resulting 32-bit pairs of elements
+        auto lo0 = _mm_unpacklo_epi16(r[0], r[1]);
+        auto lo1 = _mm_unpacklo_epi16(r[2], r[3]);
+        auto lo2 = _mm_unpacklo_epi16(r[4], r[5]);
+        auto lo3 = _mm_unpacklo_epi16(r[6], r[7]);
+        auto hi0 = _mm_unpackhi_epi16(r[0], r[1]);
+        auto hi1 = _mm_unpackhi_epi16(r[2], r[3]);
+        auto hi2 = _mm_unpackhi_epi16(r[4], r[5]);
+        auto hi3 = _mm_unpackhi_epi16(r[6], r[7]);
+        transpose4x32(lo0, lo1, lo2, lo3);
+        transpose4x32(hi0, hi1, hi2, hi3);
+        const __m128i out[SIZE] = {lo0, lo1, lo2, lo3, hi0, hi1, hi2, hi3};
+        for (int64_t b = 0; b < SIZE; ++b) {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + b * dstStride), out[b]);
+        }
+    }
+};
+
+template <>
+struct BlockKernel<uint8_t> {
+    static constexpr int64_t SIZE = 8;
+
+    static void run(const uint8_t* src, int64_t srcStride, uint8_t* dst, int64_t dstStride) {
+        __m128i r[SIZE];
+        for (int64_t a = 0; a < SIZE; ++a) {
+            r[a] = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + a * srcStride));
+        }
+        // Interleave pairs of lines into 16-bit units, then 16-bit units into 32-bit ones and so on
+        const auto p0 = _mm_unpacklo_epi8(r[0], r[1]);
+        const auto p1 = _mm_unpacklo_epi8(r[2], r[3]);
+        const auto p2 = _mm_unpacklo_epi8(r[4], r[5]);
+        const auto p3 = _mm_unpacklo_epi8(r[6], r[7]);
+        const auto q0 = _mm_unpacklo_epi16(p0, p1);
+        const auto q1 = _mm_unpackhi_epi16(p0, p1);
+        const auto q2 = _mm_unpacklo_epi16(p2, p3);
+        const auto q3 = _mm_unpackhi_epi16(p2, p3);
+        const __m128i out[SIZE / 2] = {_mm_unpacklo_epi32(q0, q2), _mm_unpackhi_epi32(q0, q2),
+                                       _mm_unpacklo_epi32(q1, q3), _mm_unpackhi_epi32(q1, q3)};
+        for (int64_t b = 0; b < SIZE / 2; ++b) {
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + 2 * b * dstStride), out[b]);
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + (2 * b + 1) * dstStride), _mm_srli_si128(out[b], 8));
+        }
+    }
+};
+
+#endif
+
+// dst[b * dstStride + a] = src[a * srcStride + b], for b in [0, rows) and a in [0, cols)
+template <typename T>
+void transposeTile(const T* src, int64_t srcStride, T* dst, int64_t dstStride, int64_t rows, int64_t cols) {
+    constexpr auto BLOCK = BlockKernel<T>::SIZE;
+
+    int64_t b = 0;
+    if constexpr (BLOCK > 1) {
+        for (; b + BLOCK <= rows; b += BLOCK) {
+            int64_t a = 0;
+            for (; a + BLOCK <= cols; a += BLOCK) {
+                BlockKernel<T>::run(src + a * srcStride + b, srcStride, dst + b * dstStride + a, dstStride);
             }
-        });
-    } else {
-        loop_2d(loopPolicy, ctx, N, C, [&](size_t n, size_t c) {
-            const StorageType* src_ptr_l = srcPtr + n * inputStrides.N + c * inputStrides.C;
-            StorageType* dst_ptr_l = dstPtr + n * outputStrides.N + c;
-            for (size_t h = 0; h < H; h++) {
-                const StorageType* src_ptr_l_l = src_ptr_l + h * inputStrides.H;
-                for (size_t w = 0; w < W; w++) {
-                    *dst_ptr_l = *src_ptr_l_l;
-                    dst_ptr_l += outputStrides.W;
-                    src_ptr_l_l++;
+            for (; a < cols; ++a) {
+                for (int64_t bb = b; bb < b + BLOCK; ++bb) {
+                    dst[bb * dstStride + a] = src[a * srcStride + bb];
                 }
             }
-        });
+        }
+    }
+    for (; b < rows; ++b) {
+        for (int64_t a = 0; a < cols; ++a) {
+            dst[b * dstStride + a] = src[a * srcStride + b];
+        }
     }
 }
 
-inline void blob_copy_4d(vpux::Const::Content& input, vpux::Const::Content& output) {
-    const Bit elemSize = getElemTypeSize(input.getStorageElemType());
-    VPUX_THROW_WHEN(elemSize.count() < CHAR_BIT, "Unsupported blob 4D transformation for sub byte types {0}",
-                    input.getStorageElemType());
-    const size_t elemSizeBytes = elemSize.to<Byte>().count();
-    switch (elemSizeBytes) {
-    case sizeof(float):
-        blob_copy_4d_t<float>(input, output, input.getStorageElemType().getContext());
-        break;
-    case sizeof(uint16_t):
-        blob_copy_4d_t<uint16_t>(input, output, input.getStorageElemType().getContext());
-        break;
-    case sizeof(uint8_t):
-        blob_copy_4d_t<uint8_t>(input, output, input.getStorageElemType().getContext());
-        break;
-    default:
-        VPUX_THROW("Unsupported blob 4D transformation for precision {0}", input.getStorageElemType());
+//
+// Permutation engines
+//
+
+// The innermost output dimension is also the innermost input one: whole rows are copied
+void copyRows(const char* src, char* dst, const PermutePlan& plan, int64_t elemBytes, mlir::MLIRContext* ctx) {
+    const auto rank = plan.shape.size();
+    const auto rowBytes = plan.shape.back() * elemBytes;
+    const auto outerDims = to_small_vector(irange(rank - 1));
+    int64_t numRows = 1;
+    for (auto dim : outerDims) {
+        numRows *= plan.shape[dim];
     }
+
+    loop_chunked(LoopExecPolicy::Parallel, ctx, numRows, divUp(MIN_BYTES_PER_TASK, rowBytes),
+                 [&](int64_t begin, int64_t end) {
+                     OuterIndex index(plan, outerDims, begin);
+                     for (auto row = begin; row < end; ++row, index.next()) {
+                         std::memcpy(dst + index.outOffset() * elemBytes, src + index.inOffset() * elemBytes,
+                                     checked_cast<size_t>(rowBytes));
+                     }
+                 });
 }
 
-template <typename StorageType>
-void blob_copy_5d_t(vpux::Const::Content& input, vpux::Const::Content& output, mlir::MLIRContext* ctx) {
-    const StorageType* srcPtr = reinterpret_cast<const StorageType*>(input.getRawStorageBuf().data());
-    StorageType* dstPtr = reinterpret_cast<StorageType*>(output.getRawTempBuf().data());
-
-    auto shapeRef = input.getType().getShape();
-    SmallVector<int64_t> shape(shapeRef.begin(), shapeRef.end());
-
-    const size_t N = shape[0];
-    const size_t C = shape[1];
-    const size_t D = shape[2];
-    const size_t H = shape[3];
-    const size_t W = shape[4];
-
-    const auto inputStrides = OvLike5DStrides(input.getType());
-    const auto outputStrides = OvLike5DStrides(output.getType());
-    const auto loopPolicy = LoopExecPolicy::Parallel;
-    if (input.getType().getDimsOrder() == DimsOrder::NDHWC) {
-        loop_3d(loopPolicy, ctx, N, C, D, [&](size_t n, size_t c, size_t d) {
-            StorageType* dst_ptr_l = dstPtr + n * outputStrides.N + c * outputStrides.C + d * outputStrides.D;
-            const StorageType* src_ptr_l = srcPtr + n * inputStrides.N + c * inputStrides.C + d * inputStrides.D;
-            for (size_t h = 0; h < H; h++) {
-                const StorageType* src_ptr_l_l = src_ptr_l + h * inputStrides.H;
-                for (size_t w = 0; w < W; w++) {
-                    *dst_ptr_l = *src_ptr_l_l;
-                    src_ptr_l_l += inputStrides.W;
-                    dst_ptr_l++;
-                }
-            }
-        });
-    } else {
-        loop_3d(loopPolicy, ctx, N, C, D, [&](size_t n, size_t c, size_t d) {
-            const StorageType* src_ptr_l = srcPtr + n * inputStrides.N + c * inputStrides.C + d * inputStrides.D;
-            StorageType* dst_ptr_l = dstPtr + n * outputStrides.N + c + d * outputStrides.D;
-            for (size_t h = 0; h < H; h++) {
-                const StorageType* src_ptr_l_l = src_ptr_l + h * inputStrides.H;
-                for (size_t w = 0; w < W; w++) {
-                    *dst_ptr_l = *src_ptr_l_l;
-                    dst_ptr_l += outputStrides.W;
-                    src_ptr_l_l++;
-                }
-            }
-        });
+// The innermost input dimension is an outer output dimension: every pair of such dimensions is transposed by tiles
+template <typename T>
+void transposeTiles(const T* src, T* dst, const PermutePlan& plan, mlir::MLIRContext* ctx) {
+    const auto rank = plan.shape.size();
+    // Innermost output dimension, read with a stride
+    const auto colsDim = rank - 1;
+    // Innermost input dimension, written with a stride
+    size_t rowsDim = 0;
+    while (plan.inStrides[rowsDim] != 1) {
+        ++rowsDim;
     }
+    VPUX_THROW_UNLESS(rowsDim < colsDim, "Unexpected memory permutation plan");
+
+    SmallVector<size_t> outerDims;
+    int64_t numOuter = 1;
+    for (auto dim : irange(colsDim)) {
+        if (dim != rowsDim) {
+            outerDims.push_back(dim);
+            numOuter *= plan.shape[dim];
+        }
+    }
+
+    const auto numRows = plan.shape[rowsDim];
+    const auto numCols = plan.shape[colsDim];
+    const auto srcStride = plan.inStrides[colsDim];
+    const auto dstStride = plan.outStrides[rowsDim];
+    const auto rowTiles = divUp(numRows, TILE_SIZE);
+    const auto colTiles = divUp(numCols, TILE_SIZE);
+    const auto tilesPerOuter = rowTiles * colTiles;
+
+    loop_chunked(LoopExecPolicy::Parallel, ctx, numOuter * tilesPerOuter, MIN_TILES_PER_TASK,
+                 [&](int64_t begin, int64_t end) {
+                     OuterIndex index(plan, outerDims, begin / tilesPerOuter);
+                     auto tile = begin % tilesPerOuter;
+                     for (auto item = begin; item < end; ++item) {
+                         const auto row = tile / colTiles * TILE_SIZE;
+                         const auto col = tile % colTiles * TILE_SIZE;
+                         transposeTile(src + index.inOffset() + col * srcStride + row, srcStride,
+                                       dst + index.outOffset() + row * dstStride + col, dstStride,
+                                       std::min(TILE_SIZE, numRows - row), std::min(TILE_SIZE, numCols - col));
+                         if (++tile == tilesPerOuter) {
+                             tile = 0;
+                             index.next();
+                         }
+                     }
+                 });
 }
 
-inline void blob_copy_5d(vpux::Const::Content& input, vpux::Const::Content& output) {
-    const auto elemSizeBits = getElemTypeSize(input.getStorageElemType()).count();
-    VPUX_THROW_WHEN(elemSizeBits < CHAR_BIT, "Unsupported blob 5D transformation for sub byte types {0}",
-                    input.getStorageElemType());
-    const size_t elemSizeBytes = elemSizeBits / CHAR_BIT;
-    switch (elemSizeBytes) {
-    case sizeof(float):
-        blob_copy_5d_t<float>(input, output, input.getStorageElemType().getContext());
-        break;
-    case sizeof(uint16_t):
-        blob_copy_5d_t<uint16_t>(input, output, input.getStorageElemType().getContext());
-        break;
+template <typename T>
+void permuteTyped(ArrayRef<char> inBuf, MutableArrayRef<char> outBuf, const PermutePlan& plan,
+                  mlir::MLIRContext* ctx) {
+    if (plan.shape.empty() || plan.inStrides.back() == 1) {
+        if (plan.shape.size() <= 1) {
+            std::memcpy(outBuf.data(), inBuf.data(), inBuf.size());
+            return;
+        }
+        copyRows(inBuf.data(), outBuf.data(), plan, sizeof(T), ctx);
+        return;
+    }
+    transposeTiles(reinterpret_cast<const T*>(inBuf.data()), reinterpret_cast<T*>(outBuf.data()), plan, ctx);
+}
+
+void permuteBytes(ArrayRef<char> inBuf, MutableArrayRef<char> outBuf, ArrayRef<int64_t> inMemShape,
+                  DimsOrder permOrder, int64_t elemBytes, mlir::MLIRContext* ctx) {
+    switch (elemBytes) {
     case sizeof(uint8_t):
-        blob_copy_5d_t<uint8_t>(input, output, input.getStorageElemType().getContext());
-        break;
+        return permuteTyped<uint8_t>(inBuf, outBuf, makePlan(inMemShape, permOrder, 1), ctx);
+    case sizeof(uint16_t):
+        return permuteTyped<uint16_t>(inBuf, outBuf, makePlan(inMemShape, permOrder, 1), ctx);
+    case sizeof(uint32_t):
+        return permuteTyped<uint32_t>(inBuf, outBuf, makePlan(inMemShape, permOrder, 1), ctx);
+    case sizeof(uint64_t):
+        return permuteTyped<uint64_t>(inBuf, outBuf, makePlan(inMemShape, permOrder, 1), ctx);
     default:
-        VPUX_THROW("Unsupported blob 5D transformation for precision {0}", input.getStorageElemType());
+        // Other element sizes are copied byte by byte, with an extra innermost dimension which is not permuted
+        return permuteTyped<uint8_t>(inBuf, outBuf, makePlan(inMemShape, permOrder, elemBytes), ctx);
     }
 }
 
-};  // namespace
+//
+// Packed sub-byte elements
+//
+// Elements are stored starting from the least significant bits of each byte. They are unpacked into one byte each,
+// permuted and packed again, so that no two threads ever write into the same byte
+//
 
-bool Const::details::isOptimizedTransformationSupported(vpux::Const::Content& input, vpux::NDTypeInterface outType) {
-    const Bit elemSize = getElemTypeSize(input.getStorageElemType());
-    const size_t elemSizeBytes = checked_cast<size_t>(elemSize.to<Byte>().count());
-    static const std::unordered_set<size_t> optimizedElemTypeSizes = {sizeof(uint8_t), sizeof(uint16_t), sizeof(float)};
-    // Check storage size
-    if (optimizedElemTypeSizes.count(elemSizeBytes) == 0) {
-        return false;
+void permuteSubByte(ArrayRef<char> inBuf, MutableArrayRef<char> outBuf, ArrayRef<int64_t> inMemShape,
+                    DimsOrder permOrder, int64_t elemBits, mlir::MLIRContext* ctx) {
+    VPUX_THROW_UNLESS(CHAR_BIT % elemBits == 0, "Unsupported sub-byte element size of '{0}' bits", elemBits);
+    const auto elemsPerByte = CHAR_BIT / elemBits;
+    const auto mask = checked_cast<uint8_t>((1 << elemBits) - 1);
+
+    int64_t numElems = 1;
+    for (auto size : inMemShape) {
+        numElems *= size;
     }
+    const auto numBytes = divUp(numElems, elemsPerByte);
+    VPUX_THROW_UNLESS(inBuf.size() >= checked_cast<size_t>(numBytes), "Buffer is too small for {0} elements",
+                      numElems);
 
-    const auto createDimsVerifier = [](vpux::DimsOrder order1, vpux::DimsOrder order2) {
-        return [=](vpux::NDTypeInterface type1, vpux::NDTypeInterface type2) {
-            return (type1.getDimsOrder() == order1 && type2.getDimsOrder() == order2) ||
-                   (type1.getDimsOrder() == order2 && type2.getDimsOrder() == order1);
-        };
-    };
-    const auto isBetweenNCHW_NHWC = createDimsVerifier(DimsOrder::NHWC, DimsOrder::NCHW);
-    const auto isBetweenNCDHW_NDHWC = createDimsVerifier(DimsOrder::NCDHW, DimsOrder::NDHWC);
+    std::vector<char> unpackedIn(numElems);
+    std::vector<char> unpackedOut(numElems);
 
-    return isBetweenNCHW_NHWC(input.getType(), outType) || isBetweenNCDHW_NDHWC(input.getType(), outType);
+    loop_chunked(LoopExecPolicy::Parallel, ctx, numBytes, MIN_BYTES_PER_TASK / elemsPerByte,
+                 [&](int64_t begin, int64_t end) {
+                     for (auto byteInd = begin; byteInd < end; ++byteInd) {
+                         const auto byte = static_cast<uint8_t>(inBuf[byteInd]);
+                         const auto lastElem = std::min(numElems, (byteInd + 1) * elemsPerByte);
+                         for (auto elemInd = byteInd * elemsPerByte, shift = int64_t(0); elemInd < lastElem;
+                              ++elemInd, shift += elemBits) {
+                             unpackedIn[elemInd] = static_cast<char>((byte >> shift) & mask);
+                         }
+                     }
+                 });
+
+    permuteBytes(unpackedIn, unpackedOut, inMemShape, permOrder, 1, ctx);
+
+    loop_chunked(LoopExecPolicy::Parallel, ctx, numBytes, MIN_BYTES_PER_TASK / elemsPerByte,
+                 [&](int64_t begin, int64_t end) {
+                     for (auto byteInd = begin; byteInd < end; ++byteInd) {
+                         uint8_t byte = 0;
+                         const auto lastElem = std::min(numElems, (byteInd + 1) * elemsPerByte);
+                         for (auto elemInd = byteInd * elemsPerByte, shift = int64_t(0); elemInd < lastElem;
+                              ++elemInd, shift += elemBits) {
+                             byte |= static_cast<uint8_t>(unpackedOut[elemInd] << shift);
+                         }
+                         outBuf[byteInd] = static_cast<char>(byte);
+                     }
+                 });
 }
 
-// This code is similar to openvino solution,
-// \see{https://github.com/openvinotoolkit/openvino/blob/releases/2023/2/src/inference/src/blob_transform.cpp}
-void Const::details::memPermuteTransformationOptimized(vpux::Const::Content& input, vpux::Const::Content& output) {
-    const size_t numDims = getContentRank(input);
-    if (numDims == 4) {
-        blob_copy_4d(input, output);
-    } else if (numDims == 5) {
-        blob_copy_5d(input, output);
-    } else {
-        VPUX_THROW("Unimplemented blob transformation. Only 4d or 5d supported.");
+}  // namespace
+
+//
+// permuteMemory
+//
+
+void Const::details::permuteMemory(ArrayRef<char> inBuf, MutableArrayRef<char> outBuf, MemShapeRef inMemShape,
+                                   DimsOrder permOrder, Bit elemSize, mlir::MLIRContext* ctx) {
+    VPUX_THROW_UNLESS(inBuf.size() == outBuf.size(), "Storage buffer size mismatch: '{0}' vs '{1}'", inBuf.size(),
+                      outBuf.size());
+    VPUX_THROW_UNLESS(permOrder.numDims() == inMemShape.size(), "Memory permutation '{0}' does not match shape '{1}'",
+                      permOrder, inMemShape);
+
+    const auto elemBits = elemSize.count();
+    if (elemBits < CHAR_BIT) {
+        permuteSubByte(inBuf, outBuf, inMemShape.raw(), permOrder, elemBits, ctx);
+        return;
     }
+
+    VPUX_THROW_UNLESS(elemBits % CHAR_BIT == 0, "Unsupported element size of '{0}' bits", elemBits);
+    const auto elemBytes = elemBits / CHAR_BIT;
+    int64_t numElems = 1;
+    for (auto size : inMemShape) {
+        numElems *= size;
+    }
+    VPUX_THROW_UNLESS(inBuf.size() >= checked_cast<size_t>(numElems * elemBytes),
+                      "Buffer is too small for {0} elements", numElems);
+
+    permuteBytes(inBuf, outBuf, inMemShape.raw(), permOrder, elemBytes, ctx);
 }
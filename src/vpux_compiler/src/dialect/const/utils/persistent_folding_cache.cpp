@@ -0,0 +1,292 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/compiler/dialect/const/utils/persistent_folding_cache.hpp"
+
+#include "vpux/compiler/compiler_version.hpp"
+#include "vpux/compiler/dialect/const/attributes/content.hpp"
+#include "vpux/utils/core/error.hpp"
+#include "vpux/utils/core/numeric.hpp"
+
+#include <mlir/AsmParser/AsmParser.h>
+
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/Format.h>
+#include <llvm/Support/MD5.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/Path.h>
+#include <llvm/Support/raw_ostream.h>
+#include <llvm/Support/xxhash.h>
+
+#include <cstring>
+
+using namespace vpux;
+
+namespace {
+
+constexpr char ENTRY_MAGIC[8] = {'N', 'P', 'U', 'C', 'F', 'C', '\0', '\0'};
+// Must be increased whenever the entry layout or the semantics of a transformation change, so that stale entries
+// produced by older compilers are never reused
+constexpr uint32_t ENTRY_VERSION = 1;
+constexpr uint64_t ENTRY_DATA_ALIGNMENT = 64;
+constexpr StringLiteral ENTRY_EXTENSION = ".npucf";
+
+struct EntryHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t isSplat;
+    uint64_t descriptionSize;
+    uint64_t storageElemTypeSize;
+    uint64_t dataOffset;
+    uint64_t dataSize;
+};
+
+// Returns std::nullopt if the data of the base content is not available, e.g. for a dense resource without a blob.
+// Such content must not be cached, since all of it would get the same key
+std::optional<ArrayRef<char>> getBaseContentData(mlir::ElementsAttr baseContent) {
+    if (auto dense = mlir::dyn_cast<mlir::DenseElementsAttr>(baseContent)) {
+        return dense.getRawData();
+    }
+    if (auto denseResource = mlir::dyn_cast<mlir::DenseResourceElementsAttr>(baseContent)) {
+        if (auto* blob = denseResource.getRawHandle().getBlob()) {
+            return blob->getData();
+        }
+    }
+    return std::nullopt;
+}
+
+std::string printToString(mlir::Type type) {
+    std::string str;
+    llvm::raw_string_ostream os(str);
+    os << type;
+    return os.str();
+}
+
+}  // namespace
+
+//
+// PersistentFoldingCache
+//
+
+Const::PersistentFoldingCache::PersistentFoldingCache(StringRef cacheDir, vpux::Byte minEntrySize, Logger log)
+        : _cacheDir(cacheDir), _minEntrySize(minEntrySize), _log(log) {
+    _log.setName("persistent-folding-cache");
+    if (const auto ec = llvm::sys::fs::create_directories(_cacheDir)) {
+        _log.warning("Failed to create constant folding cache directory '{0}': {1}", _cacheDir, ec.message());
+    }
+}
+
+bool Const::PersistentFoldingCache::isCacheable(Const::ContentAttr attr) const {
+    if (attr.getTransformations().empty()) {
+        return false;
+    }
+    if (!getBaseContentData(attr.getBaseContent()).has_value()) {
+        return false;
+    }
+    return attr.getType().getTotalAllocSize() >= _minEntrySize;
+}
+
+uint64_t Const::PersistentFoldingCache::getBaseContentHash(mlir::ElementsAttr baseContent) {
+    {
+        std::lock_guard<std::mutex> lock(_baseHashMutex);
+        if (auto it = _baseHashes.find(baseContent); it != _baseHashes.end()) {
+            return it->second;
+        }
+    }
+
+    const auto data = getBaseContentData(baseContent).value();
+    const auto hash = llvm::xxHash64(StringRef(data.data(), data.size()));
+
+    std::lock_guard<std::mutex> lock(_baseHashMutex);
+    _baseHashes.try_emplace(baseContent, hash);
+    return hash;
+}
+
+// The description contains everything that determines the folded content. It is also stored in the entry itself, so
+// that a collision of the hashed key cannot result in wrong content being reused
+std::string Const::PersistentFoldingCache::getKeyDescription(Const::ContentAttr attr) {
+    const auto baseContent = attr.getBaseContent();
+    const auto baseData = getBaseContentData(baseContent).value();
+
+    // The compiler version is a part of the key, so that the entries produced by a different build are not reused
+    // even if the semantics of a transformation has changed without ENTRY_VERSION being increased
+    std::string description;
+    llvm::raw_string_ostream os(description);
+    os << "v" << ENTRY_VERSION << ";" << VPUX_COMPILER_VERSION << ";" << baseContent.getShapedType() << ";"
+       << llvm::format_hex(getBaseContentHash(baseContent), 18) << ";" << baseData.size() << ";";
+    for (const auto& transformation : attr.getTransformations()) {
+        os << transformation << ";";
+    }
+    os << attr.getType();
+    return os.str();
+}
+
+std::string Const::PersistentFoldingCache::getKey(Const::ContentAttr attr) {
+    VPUX_THROW_UNLESS(getBaseContentData(attr.getBaseContent()).has_value(),
+                      "Base content of '{0}' has no data to compute the key from", attr);
+    return hashDescription(getKeyDescription(attr));
+}
+
+std::string Const::PersistentFoldingCache::hashDescription(StringRef description) {
+    llvm::MD5 hasher;
+    hasher.update(description);
+    llvm::MD5::MD5Result result;
+    hasher.final(result);
+    return result.digest().str().str();
+}
+
+llvm::SmallString<128> Const::PersistentFoldingCache::getEntryPath(StringRef key) const {
+    llvm::SmallString<128> path(_cacheDir);
+    llvm::sys::path::append(path, llvm::Twine(key) + ENTRY_EXTENSION);
+    return path;
+}
+
+std::optional<Const::Content> Const::PersistentFoldingCache::load(Const::ContentAttr attr) {
+    if (!isCacheable(attr)) {
+        return std::nullopt;
+    }
+
+    const auto description = getKeyDescription(attr);
+    const auto path = getEntryPath(hashDescription(description));
+
+    // Large files are memory-mapped by LLVM, so no copy of the folded data is made here
+    auto maybeBuffer = llvm::MemoryBuffer::getFile(path, /*IsText=*/false, /*RequiresNullTerminator=*/false);
+    if (!maybeBuffer) {
+        _numMisses++;
+        return std::nullopt;
+    }
+    std::shared_ptr<const llvm::MemoryBuffer> buffer = std::move(maybeBuffer.get());
+    const auto bytes = buffer->getBuffer();
+
+    // Invalid entries are removed, so that they get replaced by the next `store` call
+    const auto invalidEntry = [&](StringRef reason) -> std::optional<Const::Content> {
+        _log.debug("Removing invalid cache entry '{0}': {1}", path, reason);
+        std::ignore = llvm::sys::fs::remove(path);
+        _numMisses++;
+        return std::nullopt;
+    };
+
+    EntryHeader header;
+    if (bytes.size() < sizeof(header)) {
+        return invalidEntry("truncated header");
+    }
+    std::memcpy(&header, bytes.data(), sizeof(header));
+    if (std::memcmp(header.magic, ENTRY_MAGIC, sizeof(ENTRY_MAGIC)) != 0 || header.version != ENTRY_VERSION) {
+        return invalidEntry("unknown format");
+    }
+    if (sizeof(header) + header.descriptionSize + header.storageElemTypeSize > header.dataOffset ||
+        header.dataOffset + header.dataSize != bytes.size()) {
+        return invalidEntry("inconsistent sizes");
+    }
+
+    const auto storedDescription = bytes.substr(sizeof(header), header.descriptionSize);
+    if (storedDescription != description) {
+        return invalidEntry("key collision");
+    }
+
+    const auto storageElemTypeStr = bytes.substr(sizeof(header) + header.descriptionSize, header.storageElemTypeSize);
+    const auto storageElemType = mlir::parseType(storageElemTypeStr, attr.getContext());
+    if (storageElemType == nullptr) {
+        return invalidEntry("unknown storage element type");
+    }
+
+    _numHits++;
+    const auto data = ArrayRef<char>(bytes.data() + header.dataOffset, header.dataSize);
+    return Const::Content::fromExternalBuffer(attr.getType(), data, storageElemType, header.isSplat != 0,
+                                              std::move(buffer));
+}
+
+void Const::PersistentFoldingCache::store(Const::ContentAttr attr, const Const::Content& content) {
+    if (!isCacheable(attr)) {
+        return;
+    }
+
+    const auto description = getKeyDescription(attr);
+    const auto path = getEntryPath(hashDescription(description));
+    if (llvm::sys::fs::exists(path)) {
+        return;
+    }
+
+    const auto storageElemTypeStr = printToString(content.getStorageElemType());
+    const auto data = content.getRawStorageBuf();
+
+    EntryHeader header;
+    std::memcpy(header.magic, ENTRY_MAGIC, sizeof(ENTRY_MAGIC));
+    header.version = ENTRY_VERSION;
+    header.isSplat = content.isSplat() ? 1 : 0;
+    header.descriptionSize = description.size();
+    header.storageElemTypeSize = storageElemTypeStr.size();
+    header.dataOffset = alignValUp<uint64_t>(sizeof(header) + description.size() + storageElemTypeStr.size(),
+                                             ENTRY_DATA_ALIGNMENT);
+    header.dataSize = data.size();
+
+    // The entry is written into a unique temporary file first and renamed afterwards, so that concurrent compilations
+    // never observe a partially written entry
+    int fd = -1;
+    llvm::SmallString<128> tempPath;
+    if (const auto ec = llvm::sys::fs::createUniqueFile(llvm::Twine(path) + ".%%%%%%%%.tmp", fd, tempPath)) {
+        _log.warning("Failed to create constant folding cache entry '{0}': {1}", path, ec.message());
+        return;
+    }
+
+    {
+        llvm::raw_fd_ostream os(fd, /*shouldClose=*/true);
+        os.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        os << description << storageElemTypeStr;
+        os.write_zeros(header.dataOffset - os.tell());
+        os.write(data.data(), data.size());
+        os.close();
+        if (os.has_error()) {
+            _log.warning("Failed to write constant folding cache entry '{0}': {1}", path, os.error().message());
+            os.clear_error();
+            llvm::sys::fs::remove(tempPath);
+            return;
+        }
+    }
+
+    if (const auto ec = llvm::sys::fs::rename(tempPath, path)) {
+        _log.warning("Failed to commit constant folding cache entry '{0}': {1}", path, ec.message());
+        llvm::sys::fs::remove(tempPath);
+        return;
+    }
+
+    _numStores++;
+}
+
+//
+// PersistentFoldingCacheManager
+//
+
+Const::PersistentFoldingCacheManager& Const::PersistentFoldingCacheManager::getInstance() {
+    static Const::PersistentFoldingCacheManager instance;
+    return instance;
+}
+
+bool Const::PersistentFoldingCacheManager::addCache(mlir::MLIRContext* ctx, StringRef cacheDir,
+                                                    vpux::Byte minEntrySize, Logger log) {
+    std::lock_guard<std::mutex> lock(_mtx);
+    if (_caches.find(ctx) != _caches.end()) {
+        return false;
+    }
+    _caches[ctx] = std::make_unique<Const::PersistentFoldingCache>(cacheDir, minEntrySize, log);
+    return true;
+}
+
+bool Const::PersistentFoldingCacheManager::removeCache(mlir::MLIRContext* ctx) {
+    std::lock_guard<std::mutex> lock(_mtx);
+    if (auto it = _caches.find(ctx); it != _caches.end()) {
+        _caches.erase(it);
+        return true;
+    }
+    return false;
+}
+
+Const::PersistentFoldingCache* Const::PersistentFoldingCacheManager::find(mlir::MLIRContext* ctx) {
+    std::lock_guard<std::mutex> lock(_mtx);
+    if (auto it = _caches.find(ctx); it != _caches.end()) {
+        return it->second.get();
+    }
+    return nullptr;
+}
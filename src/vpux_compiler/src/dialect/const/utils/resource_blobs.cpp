@@ -0,0 +1,124 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/compiler/dialect/const/utils/resource_blobs.hpp"
+
+#include "vpux/compiler/dialect/const/ops.hpp"
+#include "vpux/compiler/dialect/const/utils/constant_folding_cache.hpp"
+
+#include "vpux/utils/core/checked_cast.hpp"
+#include "vpux/utils/core/small_vector.hpp"
+
+#include <mlir/IR/AsmState.h>
+
+#include <cstddef>
+
+using namespace vpux;
+
+namespace {
+
+constexpr StringLiteral OWNED_RESOURCE_KEY = "vpux_owned_constant";
+
+}  // namespace
+
+//
+// OwnedResourceBlobs
+//
+
+void vpux::Const::OwnedResourceBlobs::add(BlobEntry* entry) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _entries.insert(entry);
+}
+
+bool vpux::Const::OwnedResourceBlobs::contains(BlobEntry* entry) const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _entries.contains(entry);
+}
+
+Byte vpux::Const::OwnedResourceBlobs::releaseUnused(const llvm::DenseSet<BlobEntry*>& usedEntries) {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    int64_t releasedSize = 0;
+    SmallVector<BlobEntry*> unusedEntries;
+    for (auto* entry : _entries) {
+        if (usedEntries.contains(entry)) {
+            continue;
+        }
+        if (auto* blob = entry->getBlob()) {
+            releasedSize += checked_cast<int64_t>(blob->getData().size());
+        }
+        // The entry itself stays in the resource manager under its unique key, only the data is freed
+        entry->setBlob(mlir::AsmResourceBlob());
+        unusedEntries.push_back(entry);
+    }
+    for (auto* entry : unusedEntries) {
+        _entries.erase(entry);
+    }
+
+    return Byte(releasedSize);
+}
+
+//
+// createOwnedContent
+//
+
+mlir::ElementsAttr vpux::Const::createOwnedContent(mlir::ShapedType type, size_t size,
+                                                   FuncRef<void(MutableArrayRef<char>)> fill) {
+    if (Byte(checked_cast<int64_t>(size)) < OWNED_RESOURCE_MIN_SIZE) {
+        std::vector<char> tempBuf(size);
+        fill(MutableArrayRef(tempBuf.data(), size));
+        return mlir::DenseElementsAttr::getFromRawBuffer(type, tempBuf);
+    }
+
+    auto blob = mlir::HeapAsmResourceBlob::allocate(size, alignof(std::max_align_t), /*dataIsMutable=*/true);
+    fill(blob.getMutableData());
+
+    auto* ctx = type.getContext();
+    auto& manager = mlir::DenseResourceElementsHandle::getManagerInterface(ctx);
+    // The manager makes the key unique, so every constant gets its own blob
+    auto handle = manager.insert(OWNED_RESOURCE_KEY, std::move(blob));
+    ctx->getOrLoadDialect<Const::ConstDialect>()->getOwnedResourceBlobs().add(handle.getResource());
+
+    return mlir::DenseResourceElementsAttr::get(type, handle);
+}
+
+//
+// isOwnedContent
+//
+
+bool vpux::Const::isOwnedContent(mlir::ElementsAttr content) {
+    const auto resource = mlir::dyn_cast_or_null<mlir::DenseResourceElementsAttr>(content);
+    if (resource == nullptr) {
+        return false;
+    }
+    auto* ctx = resource.getContext();
+    return ctx->getOrLoadDialect<Const::ConstDialect>()->getOwnedResourceBlobs().contains(
+            resource.getRawHandle().getResource());
+}
+
+//
+// releaseUnusedResources
+//
+
+Byte vpux::Const::releaseUnusedResources(mlir::Operation* root) {
+    auto* ctx = root->getContext();
+
+#ifdef BACKGROUND_FOLDING_ENABLED
+    // Folding requests queued in background may still refer to the content which is already removed from the IR
+    if (Const::ConstantFoldingCacheManager::getInstance().contains(ctx)) {
+        return Byte(0);
+    }
+#endif
+
+    // Constant content is referenced not only by Const::DeclareOp, but also by the attributes of some other operations
+    llvm::DenseSet<OwnedResourceBlobs::BlobEntry*> usedEntries;
+    root->walk([&](mlir::Operation* op) {
+        op->getAttrDictionary().walk([&](mlir::DenseResourceElementsAttr resource) {
+            usedEntries.insert(resource.getRawHandle().getResource());
+        });
+    });
+
+    return ctx->getOrLoadDialect<Const::ConstDialect>()->getOwnedResourceBlobs().releaseUnused(usedEntries);
+}
@@ -5,6 +5,8 @@
 
 #include "vpux/compiler/dialect/const/utils/sub_byte.hpp"
 
+#include <algorithm>
+
 //
 // Const::isSubByte
 //
@@ -31,15 +33,70 @@ mlir::SmallVector<char> vpux::Const::getConstBuffer(const char* sourceData, cons
 
     auto targetData = SmallVector<char>(numElems);
     // For sub 8 bit we need to unpack the data
+    unpackSubByte(ArrayRef(sourceData, getPackedSize(bitWidth, numElems)), bitWidth, targetData);
+    return targetData;
+}
+
+//
+// Const::getPackedSize
+//
+
+int64_t vpux::Const::getPackedSize(const size_t bitWidth, const int64_t numElems) {
+    return alignValUp<int64_t>(numElems * checked_cast<int64_t>(bitWidth), CHAR_BIT) / CHAR_BIT;
+}
+
+//
+// Const::unpackSubByte
+//
+
+void vpux::Const::unpackSubByte(ArrayRef<char> packedData, const size_t bitWidth, MutableArrayRef<char> targetData) {
+    VPUX_THROW_UNLESS(isSubByte(bitWidth), "Invalid sub-byte bitWidth: '{0}'", bitWidth);
     const auto elemPerByte = CHAR_BIT / bitWidth;
     VPUX_THROW_UNLESS(vpux::isPowerOfTwo(elemPerByte), "Invalid number of elements per byte '{0}'", elemPerByte);
-    const size_t mask = checked_cast<uint8_t>(checked_cast<uint16_t>(std::pow(2, bitWidth)) - 1);
-    for (size_t idx = 0; idx < numElems / elemPerByte; idx++) {
-        size_t shift = 0;
-        for (size_t elemIdx = 0; elemIdx <= elemPerByte - 1; elemIdx++) {
-            targetData[idx * elemPerByte + elemIdx] = (sourceData[idx] >> shift) & mask;
-            shift += bitWidth;
-        }
+    VPUX_THROW_UNLESS(packedData.size() * elemPerByte >= targetData.size(),
+                      "Packed data of '{0}' bytes doesn't contain '{1}' elements", packedData.size(),
+                      targetData.size());
+
+    const auto mask = checked_cast<uint8_t>((1u << bitWidth) - 1);
+    for (size_t idx = 0; idx < targetData.size(); ++idx) {
+        const auto byte = static_cast<uint8_t>(packedData[idx / elemPerByte]);
+        const auto shift = (idx % elemPerByte) * bitWidth;
+        targetData[idx] = static_cast<char>((byte >> shift) & mask);
     }
-    return targetData;
+}
+
+//
+// Const::isSubByteSplat
+//
+
+bool vpux::Const::isSubByteSplat(ArrayRef<char> packedData, const size_t bitWidth, const int64_t numElems) {
+    if (numElems <= 0 || packedData.empty()) {
+        return false;
+    }
+    VPUX_THROW_UNLESS(checked_cast<int64_t>(packedData.size()) >= getPackedSize(bitWidth, numElems),
+                      "Packed data of '{0}' bytes doesn't contain '{1}' elements", packedData.size(), numElems);
+
+    char splatValue = 0;
+    unpackSubByte(packedData, bitWidth, MutableArrayRef(&splatValue, 1));
+
+    // Compare whole bytes first, the elements of the last partially filled byte are compared one by one
+    const auto elemPerByte = checked_cast<int64_t>(CHAR_BIT / bitWidth);
+    uint8_t splatByte = 0;
+    for (int64_t elemIdx = 0; elemIdx < elemPerByte; ++elemIdx) {
+        splatByte |= static_cast<uint8_t>(splatValue) << (elemIdx * bitWidth);
+    }
+
+    const auto numFullBytes = numElems / elemPerByte;
+    const auto isFullBytesSplat = std::all_of(packedData.begin(), packedData.begin() + numFullBytes, [&](char byte) {
+        return static_cast<uint8_t>(byte) == splatByte;
+    });
+    if (!isFullBytesSplat) {
+        return false;
+    }
+
+    SmallVector<char> tailValues(numElems % elemPerByte);
+    unpackSubByte(packedData.drop_front(numFullBytes), bitWidth, tailValues);
+    return std::all_of(tailValues.begin(), tailValues.end(), [&](char value) {
+        return value == splatValue;
+    });
 }
@@ -6,6 +6,7 @@
 #include "vpux/compiler/dialect/const/utils/transformations.hpp"
 #include "vpux/compiler/dialect/const/attributes/content.hpp"
 #include "vpux/compiler/dialect/const/utils/const_logger.hpp"
+#include "vpux/compiler/dialect/const/utils/fused_transformations.hpp"
 #include "vpux/compiler/dialect/const/utils/mem_permute_optimized.hpp"
 #include "vpux/compiler/utils/loop.hpp"
 
@@ -37,37 +38,37 @@ Const::Content Const::details::memPermuteTransformation(vpux::Const::Content& in
         const auto inBuf = input.getRawStorageBuf();
         VPUX_THROW_UNLESS(outBuf.size() == inBuf.size(), "Storage buffer size mismatch in 'memPermuteTransformation'");
 
-        const Byte elemSize = getElemTypeSize(input.getStorageElemType());
-        const auto inShape = input.getType().getShape();
-        const auto inMemShape = inOrder.toMemoryOrder(inShape);
-
-        // Check capability to use specific solution. Most transforms are between NCHW and NHWC layouts, so they
-        // implemented separatly
-        if (Const::details::isOptimizedTransformationSupported(input, outType)) {
-            Const::details::memPermuteTransformationOptimized(input, output);
-        } else {
-            // Use generic algorithm
-            const auto outShape = outType.getShape();
-            const auto outMemShape = outOrder.toMemoryOrder(outShape);
-
-            loop_1d(LoopExecPolicy::Parallel, memPerm.getContext(), input.getType().getNumElements(),
-                    [&](int64_t inMemInd1D) {
-                        const auto inMemIndND = getMemIndexND(inMemInd1D, inMemShape);
-                        const auto outMemIndND = permOrder.toMemoryOrder(ShapeRef(inMemIndND.raw()));
-                        const auto outMemInd1D = getMemIndex1D(outMemIndND, outMemShape);
-
-                        const auto inMemRawInd = checked_cast<size_t>(inMemInd1D * elemSize.count());
-                        VPUX_THROW_UNLESS(inMemRawInd < inBuf.size(),
-                                          "Out-of-bound access in 'memPermuteTransformation'");
+        const auto inMemShape = inOrder.toMemoryOrder(input.getType().getShape());
+        Const::details::permuteMemory(inBuf, outBuf, inMemShape, permOrder, getElemTypeSize(input.getStorageElemType()),
+                                      memPerm.getContext());
+        return output;
+    }
+}
 
-                        const auto outMemRawInd = checked_cast<size_t>(outMemInd1D * elemSize.count());
-                        VPUX_THROW_UNLESS(outMemRawInd < outBuf.size(),
-                                          "Out-of-bound access in 'memPermuteTransformation'");
+//
+// applyTransformations
+//
 
-                        std::copy_n(inBuf.data() + inMemRawInd, checked_cast<size_t>(elemSize.count()),
-                                    outBuf.data() + outMemRawInd);
-                    });
+Const::Content Const::details::applyTransformations(Const::Content input,
+                                                    ArrayRef<Const::TransformAttrInterface> transformations) {
+    auto res = std::move(input);
+    while (!transformations.empty()) {
+        const auto fused = Const::details::FusedTransformations::match(res, transformations);
+        if (const auto numFused = fused.getNumTransformations(); numFused != 0) {
+            Const::logger().trace("Applying {0} fused transformations, starting from: {1}", numFused,
+                                  transformations.front());
+            res = fused.apply(res);
+            transformations = transformations.drop_front(numFused);
+            continue;
         }
-        return output;
+
+        const auto attr = transformations.front();
+        const auto storageElemTypeSize = vpux::getElemTypeSize(res.getStorageElemType()).count();
+        VPUX_THROW_WHEN(storageElemTypeSize < CHAR_BIT && !attr.supportsSubByteStorageType(),
+                        "Unsupported storage type of size '{0}' bits.", storageElemTypeSize);
+        Const::logger().trace("Applying transformation: {0}", attr);
+        res = attr.transform(res);
+        transformations = transformations.drop_front();
     }
+    return res;
 }
@@ -752,19 +752,28 @@ void NGraphImporter::parseNode(mlir::OpBuilder& builder, const std::shared_ptr<o
     VPUX_THROW_UNLESS(inputs.empty(), "nGraph Constant node '{0}' has unsupported number of inputs '{1}'",
                       origNode->get_friendly_name(), inputs.size());
 
-    auto tensorType = importConstantTensor(origNode->get_output_partial_shape(0), origNode->get_output_element_type(0));
+    const auto elemType = origNode->get_output_element_type(0);
+    auto tensorType = importConstantTensor(origNode->get_output_partial_shape(0), elemType);
     const auto numElems = tensorType.getNumElements();
     const Byte elemTypeSize = getElemTypeSize(tensorType).to<Byte>();
-    const auto bitWidth = origNode->get_output_element_type(0).bitwidth();
-    const auto bufferSize = numElems * elemTypeSize.count();
+    const auto bitWidth = elemType.bitwidth();
+    const auto isSubByte = vpux::Const::isSubByte(bitWidth);
 
     auto value = [&]() -> mlir::ElementsAttr {
-        if (vpux::Const::isSubByte(bitWidth) || !_sharedConstants) {
+        if (!_sharedConstants) {
+            const auto bufferSize = numElems * elemTypeSize.count();
             auto rawBuffer = vpux::Const::getConstBuffer(origNode->get_data_ptr<char>(), bitWidth, bufferSize);
 
             return mlir::DenseElementsAttr::getFromRawBuffer(tensorType, rawBuffer);
         }
 
+        // Sub-byte constants are shared in the packed form they are stored by OpenVINO, so they are neither copied
+        // nor unpacked during import. The unpacking is done by Const::ContentAttr only when the content is folded
+        const auto storageType =
+                isSubByte ? mlir::RankedTensorType::get(tensorType.getShape(), importPrecision(_ctx, elemType))
+                          : tensorType;
+        const auto bufferSize = isSubByte ? vpux::Const::getPackedSize(bitWidth, numElems)
+                                          : numElems * elemTypeSize.count();
         const auto rawBuffer = ArrayRef(origNode->get_data_ptr<char>(), bufferSize);
 
         constexpr size_t defaultAlignment =
@@ -777,16 +786,18 @@ void NGraphImporter::parseNode(mlir::OpBuilder& builder, const std::shared_ptr<o
         // assumption (as per MLIR documented behavior): inserting a new blob with the same key would internally cause
         // the key to change, so that there are no collisions - thus, the blob is never overwritten here
         return mlir::DenseResourceElementsAttr::get(
-                tensorType, builtinDialectManager.insert("ngraphSharedConstant", std::move(blob)));
+                storageType, builtinDialectManager.insert("ngraphSharedConstant", std::move(blob)));
     }();
 
-    // For sub 8 bit we need to unpack the data
     auto contentAttr = Const::ContentAttr::get(value);
-    if (vpux::Const::isSubByte(bitWidth)) {
-        // First for subbyte datatypes we took importStoragePrecision, because of the MLIR limitation of
-        // storing sub byte datatype, and now we convert the Constant data type to the original datatype.
-        auto dataType = importPrecision(_ctx, origNode->get_output_element_type(0));
-        contentAttr = contentAttr.convertElemType(dataType);
+    if (isSubByte) {
+        // The shared sub-byte constants already have the original datatype
+        auto dataType = importPrecision(_ctx, elemType);
+        if (value.getShapedType().getElementType() != dataType) {
+            // First for subbyte datatypes we took importStoragePrecision, because of the MLIR limitation of
+            // storing sub byte datatype, and now we convert the Constant data type to the original datatype.
+            contentAttr = contentAttr.convertElemType(dataType);
+        }
         tensorType = mlir::RankedTensorType::get(tensorType.getShape(), dataType);
     }
     auto op = builder.create<Const::DeclareOp>(createLocation(origNode), tensorType, contentAttr);
@@ -0,0 +1,70 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/compiler/utils/ELF/blob_sink.hpp"
+
+#include "vpux/utils/core/error.hpp"
+
+#include <algorithm>
+
+using namespace vpux;
+
+//
+// streamToSink
+//
+
+void vpux::ELF::streamToSink(ArrayRef<uint8_t> blob, BlobSink& sink) {
+    const auto chunkSize = sink.getChunkSize();
+    VPUX_THROW_WHEN(chunkSize == 0, "Blob sink chunk size must be positive");
+
+    sink.begin(blob.size());
+    for (size_t offset = 0; offset < blob.size(); offset += chunkSize) {
+        sink.write(blob.slice(offset, std::min(chunkSize, blob.size() - offset)));
+    }
+    sink.finalize();
+}
+
+//
+// VectorBlobSink
+//
+
+vpux::ELF::VectorBlobSink::VectorBlobSink(std::vector<uint8_t>& storage): _storage(storage) {
+}
+
+void vpux::ELF::VectorBlobSink::begin(size_t totalSize) {
+    _storage.reserve(_storage.size() + totalSize);
+}
+
+void vpux::ELF::VectorBlobSink::write(ArrayRef<uint8_t> chunk) {
+    _storage.insert(_storage.end(), chunk.begin(), chunk.end());
+}
+
+//
+// RawOstreamBlobSink
+//
+
+vpux::ELF::RawOstreamBlobSink::RawOstreamBlobSink(llvm::raw_ostream& stream): _stream(stream) {
+}
+
+void vpux::ELF::RawOstreamBlobSink::write(ArrayRef<uint8_t> chunk) {
+    _stream.write(reinterpret_cast<const char*>(chunk.data()), chunk.size());
+}
+
+void vpux::ELF::RawOstreamBlobSink::finalize() {
+    _stream.flush();
+}
+
+//
+// CallbackBlobSink
+//
+
+vpux::ELF::CallbackBlobSink::CallbackBlobSink(Callback callback, size_t chunkSize)
+        : _callback(std::move(callback)), _chunkSize(chunkSize) {
+    VPUX_THROW_UNLESS(_callback, "Blob sink callback is empty");
+}
+
+void vpux::ELF::CallbackBlobSink::write(ArrayRef<uint8_t> chunk) {
+    _callback(chunk);
+}
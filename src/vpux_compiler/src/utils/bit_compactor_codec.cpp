@@ -5,9 +5,12 @@
 
 #include "vpux/compiler/utils/bit_compactor_codec.hpp"
 
+#include <utility>
+
 using namespace vpux;
 
-vpux::BitCompactorCodec::BitCompactorCodec(VPU::ArchKind arch_kind) {
+vpux::BitCompactorCodec::BitCompactorCodec(VPU::ArchKind arch_kind, ParallelFor parallel_for)
+        : parallel_for_(std::move(parallel_for)) {
     switch (arch_kind) {
     case VPU::ArchKind::NPU37XX:
         arch_type_ = vpux::bitc::ArchType::NPU27;
@@ -30,6 +33,7 @@ mlir::FailureOr<std::vector<uint8_t>> vpux::BitCompactorCodec::compress(std::vec
     vpux::bitc::BitCompactorConfig config;
     config.arch_type = arch_type_;
     config.mode_fp16_enable = mode == CompressionMode::FP16;
+    config.parallel_for = parallel_for_;
 
     vpux::bitc::Encoder encoder{};
     std::vector<uint8_t> compressed_data;
@@ -9,14 +9,15 @@
 
 namespace vpux {
 
-std::unique_ptr<ICodec> getBitCompactorCodec(VPU::ArchKind arch) {
-    return std::make_unique<vpux::BitCompactorCodec>(arch);
+std::unique_ptr<ICodec> getBitCompactorCodec(VPU::ArchKind arch, ICodec::ParallelFor parallelFor) {
+    return std::make_unique<vpux::BitCompactorCodec>(arch, std::move(parallelFor));
 }
 
-std::unique_ptr<ICodec> makeCodec(const ICodec::CompressionAlgorithm algo, VPU::ArchKind arch) {
+std::unique_ptr<ICodec> makeCodec(const ICodec::CompressionAlgorithm algo, VPU::ArchKind arch,
+                                  ICodec::ParallelFor parallelFor) {
     switch (algo) {
     case ICodec::CompressionAlgorithm::BITCOMPACTOR_CODEC:
-        return getBitCompactorCodec(arch);
+        return getBitCompactorCodec(arch, std::move(parallelFor));
     default:
         VPUX_THROW("vpux::makeCodec: unsupported compression algorithm");
     }
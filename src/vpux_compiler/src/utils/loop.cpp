@@ -11,6 +11,8 @@
 #include <mlir/IR/Threading.h>
 #include <mlir/IR/Types.h>
 
+#include <algorithm>
+
 using namespace vpux;
 
 namespace {
@@ -226,3 +228,34 @@ void vpux::loop_4d(LoopExecPolicy policy, mlir::MLIRContext* ctx, int64_t dim0,
         });
     }
 }
+
+void vpux::loop_chunked(LoopExecPolicy policy, mlir::MLIRContext* ctx, int64_t size, int64_t minChunkSize,
+                        FuncRef<void(int64_t, int64_t)> func) {
+    if (size <= 0) {
+        return;
+    }
+
+    minChunkSize = std::max<int64_t>(minChunkSize, 1);
+    if (!ctx->isMultithreadingEnabled() || policy == LoopExecPolicy::Sequential || size < 2 * minChunkSize) {
+        func(0, size);
+        return;
+    }
+
+    auto& threadPool = ctx->getThreadPool();
+    const auto availableThreads = static_cast<int64_t>(threadPool.getThreadCount());
+    const auto numChunks = std::min(availableThreads, size / minChunkSize);
+    // Chunk boundaries are spread evenly, so that every chunk holds at least `minChunkSize` elements
+    const auto getChunkBegin = [&](int64_t chunkIdx) {
+        return size / numChunks * chunkIdx + std::min(chunkIdx, size % numChunks);
+    };
+
+    // The last chunk is processed by the calling thread, which would otherwise stay idle until the group is finished
+    llvm::ThreadPoolTaskGroup tasksGroup(threadPool);
+    for (int64_t chunkIdx = 0; chunkIdx < numChunks - 1; ++chunkIdx) {
+        tasksGroup.async([begin = getChunkBegin(chunkIdx), end = getChunkBegin(chunkIdx + 1), func] {
+            func(begin, end);
+        });
+    }
+    func(getChunkBegin(numChunks - 1), size);
+    tasksGroup.wait();
+}
@@ -0,0 +1,288 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/compiler/utils/pass_flight_recorder.hpp"
+
+#include "vpux/compiler/dialect/const/utils/folding_counters.hpp"
+
+#include "vpux/utils/core/memory_usage.hpp"
+
+#include <mlir/Pass/PassInstrumentation.h>
+
+#include <llvm/ADT/DenseMap.h>
+#include <llvm/ADT/StringMap.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/JSON.h>
+#include <llvm/Support/Process.h>
+#include <llvm/Support/Threading.h>
+
+#include <algorithm>
+
+using namespace vpux;
+
+namespace {
+
+std::chrono::nanoseconds getProcessCpuTime() {
+    llvm::sys::TimePoint<> elapsed;
+    std::chrono::nanoseconds userTime;
+    std::chrono::nanoseconds sysTime;
+    llvm::sys::Process::GetTimeUsage(elapsed, userTime, sysTime);
+    return userTime + sysTime;
+}
+
+size_t countOps(mlir::Operation* op) {
+    size_t numOps = 0;
+    op->walk([&](mlir::Operation*) {
+        ++numOps;
+    });
+    return numOps;
+}
+
+//
+// FlightRecorderInstrumentation
+//
+
+class FlightRecorderInstrumentation final : public mlir::PassInstrumentation {
+public:
+    FlightRecorderInstrumentation(PassFlightRecorder& recorder, StringRef pipelineName)
+            : _recorder(recorder), _pipelineName(pipelineName.str()) {
+    }
+
+    void runBeforePass(mlir::Pass* pass, mlir::Operation* op) final {
+        PendingPass pending;
+        pending.numOpsBefore = countOps(op);
+        pending.counters = Const::getFoldingCounters();
+        pending.rssBeforeKB = getResidentMemoryUsage().count();
+        pending.cpuTime = getProcessCpuTime();
+        pending.startTime = std::chrono::steady_clock::now();
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        _pendingPasses[{pass, op}] = pending;
+    }
+
+    void runAfterPass(mlir::Pass* pass, mlir::Operation* op) final {
+        finishPass(pass, op, /*failed=*/false);
+    }
+
+    void runAfterPassFailed(mlir::Pass* pass, mlir::Operation* op) final {
+        finishPass(pass, op, /*failed=*/true);
+    }
+
+private:
+    struct PendingPass {
+        std::chrono::steady_clock::time_point startTime;
+        std::chrono::nanoseconds cpuTime{0};
+        int64_t rssBeforeKB = 0;
+        size_t numOpsBefore = 0;
+        Const::FoldingCounters counters;
+    };
+
+    void finishPass(mlir::Pass* pass, mlir::Operation* op, bool failed) {
+        const auto endTime = std::chrono::steady_clock::now();
+        const auto cpuTime = getProcessCpuTime();
+        const auto counters = Const::getFoldingCounters();
+
+        PendingPass pending;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            const auto it = _pendingPasses.find({pass, op});
+            if (it == _pendingPasses.end()) {
+                return;
+            }
+            pending = it->second;
+            _pendingPasses.erase(it);
+        }
+
+        PassFlightRecorder::Record record;
+        record.pipelineName = _pipelineName;
+        record.passName = pass->getName().str();
+        record.passArgument = pass->getArgument().str();
+        record.anchorName = op->getName().getStringRef().str();
+        record.threadId = llvm::get_threadid();
+        record.failed = failed;
+
+        record.startTime =
+                std::chrono::duration_cast<std::chrono::microseconds>(pending.startTime - _recorder.getStartTime());
+        record.wallTime = std::chrono::duration_cast<std::chrono::microseconds>(endTime - pending.startTime);
+        record.cpuTime = std::chrono::duration_cast<std::chrono::microseconds>(cpuTime - pending.cpuTime);
+
+        record.rssBeforeKB = pending.rssBeforeKB;
+        record.rssAfterKB = getResidentMemoryUsage().count();
+        record.peakRssKB = getPeakResidentMemoryUsage().count();
+
+        record.numOpsBefore = pending.numOpsBefore;
+        // The operation may be gone if the pass failed
+        record.numOpsAfter = failed ? 0 : countOps(op);
+
+        record.numConstFolds = counters.numFolds - pending.counters.numFolds;
+        record.numConstFoldCacheHits = counters.numCacheHits - pending.counters.numCacheHits;
+
+        _recorder.addRecord(std::move(record));
+    }
+
+private:
+    PassFlightRecorder& _recorder;
+    std::string _pipelineName;
+
+    // Passes on different operations may run concurrently
+    std::mutex _mutex;
+    llvm::DenseMap<std::pair<mlir::Pass*, mlir::Operation*>, PendingPass> _pendingPasses;
+};
+
+//
+// PassSummary
+//
+
+struct PassSummary {
+    std::string passName;
+    size_t numRuns = 0;
+    size_t numFailures = 0;
+    std::chrono::microseconds wallTime{0};
+    std::chrono::microseconds cpuTime{0};
+    int64_t maxRssDeltaKB = 0;
+    int64_t peakRssKB = 0;
+    int64_t opsDelta = 0;
+    uint64_t numConstFolds = 0;
+    uint64_t numConstFoldCacheHits = 0;
+};
+
+std::vector<PassSummary> summarize(ArrayRef<PassFlightRecorder::Record> records) {
+    llvm::StringMap<size_t> summaryIndices;
+    std::vector<PassSummary> summaries;
+
+    for (const auto& record : records) {
+        if (record.isNestedPipeline()) {
+            continue;
+        }
+
+        const auto key = record.pipelineName + "/" + record.passArgument;
+        const auto [it, inserted] = summaryIndices.try_emplace(key, summaries.size());
+        if (inserted) {
+            summaries.push_back(PassSummary{});
+            summaries.back().passName = record.passName;
+        }
+
+        auto& summary = summaries[it->second];
+        ++summary.numRuns;
+        summary.numFailures += record.failed ? 1 : 0;
+        summary.wallTime += record.wallTime;
+        summary.cpuTime += record.cpuTime;
+        summary.maxRssDeltaKB = std::max(summary.maxRssDeltaKB, record.rssAfterKB - record.rssBeforeKB);
+        summary.peakRssKB = std::max(summary.peakRssKB, record.peakRssKB);
+        summary.opsDelta += static_cast<int64_t>(record.numOpsAfter) - static_cast<int64_t>(record.numOpsBefore);
+        summary.numConstFolds += record.numConstFolds;
+        summary.numConstFoldCacheHits += record.numConstFoldCacheHits;
+    }
+
+    llvm::stable_sort(summaries, [](const PassSummary& lhs, const PassSummary& rhs) {
+        return lhs.wallTime > rhs.wallTime;
+    });
+    return summaries;
+}
+
+}  // namespace
+
+//
+// PassFlightRecorder
+//
+
+vpux::PassFlightRecorder::PassFlightRecorder(Logger log): _log(log), _startTime(std::chrono::steady_clock::now()) {
+    _log.setName("pass-flight-recorder");
+}
+
+void vpux::PassFlightRecorder::attach(mlir::PassManager& pm, StringRef pipelineName) {
+    pm.addInstrumentation(std::make_unique<FlightRecorderInstrumentation>(*this, pipelineName));
+}
+
+void vpux::PassFlightRecorder::addRecord(Record record) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _records.push_back(std::move(record));
+}
+
+std::vector<PassFlightRecorder::Record> vpux::PassFlightRecorder::getRecords() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _records;
+}
+
+void vpux::PassFlightRecorder::printReport(llvm::raw_ostream& os) const {
+    auto records = getRecords();
+    llvm::stable_sort(records, [](const Record& lhs, const Record& rhs) {
+        return lhs.startTime < rhs.startTime;
+    });
+
+    const auto pid = static_cast<int64_t>(llvm::sys::Process::getProcessId());
+
+    llvm::json::OStream json(os, /*IndentSize=*/1);
+    json.object([&] {
+        json.attribute("displayTimeUnit", "ms");
+
+        json.attributeArray("traceEvents", [&] {
+            for (const auto& record : records) {
+                json.object([&] {
+                    json.attribute("name", record.passName);
+                    json.attribute("cat", record.pipelineName);
+                    json.attribute("ph", "X");
+                    json.attribute("pid", pid);
+                    json.attribute("tid", static_cast<int64_t>(record.threadId));
+                    json.attribute("ts", static_cast<int64_t>(record.startTime.count()));
+                    json.attribute("dur", static_cast<int64_t>(record.wallTime.count()));
+                    json.attributeObject("args", [&] {
+                        json.attribute("pass", record.passArgument);
+                        json.attribute("anchor", record.anchorName);
+                        json.attribute("failed", record.failed);
+                        json.attribute("cpuTimeUs", static_cast<int64_t>(record.cpuTime.count()));
+                        json.attribute("rssBeforeKB", record.rssBeforeKB);
+                        json.attribute("rssAfterKB", record.rssAfterKB);
+                        json.attribute("rssDeltaKB", record.rssAfterKB - record.rssBeforeKB);
+                        json.attribute("peakRssKB", record.peakRssKB);
+                        json.attribute("opsBefore", static_cast<int64_t>(record.numOpsBefore));
+                        json.attribute("opsAfter", static_cast<int64_t>(record.numOpsAfter));
+                        json.attribute("constFolds", static_cast<int64_t>(record.numConstFolds));
+                        json.attribute("constFoldCacheHits", static_cast<int64_t>(record.numConstFoldCacheHits));
+                    });
+                });
+            }
+        });
+
+        json.attributeArray("passSummary", [&] {
+            for (const auto& summary : summarize(records)) {
+                json.object([&] {
+                    json.attribute("name", summary.passName);
+                    json.attribute("runs", static_cast<int64_t>(summary.numRuns));
+                    json.attribute("failures", static_cast<int64_t>(summary.numFailures));
+                    json.attribute("wallTimeUs", static_cast<int64_t>(summary.wallTime.count()));
+                    json.attribute("cpuTimeUs", static_cast<int64_t>(summary.cpuTime.count()));
+                    json.attribute("maxRssDeltaKB", summary.maxRssDeltaKB);
+                    json.attribute("peakRssKB", summary.peakRssKB);
+                    json.attribute("opsDelta", summary.opsDelta);
+                    json.attribute("constFolds", static_cast<int64_t>(summary.numConstFolds));
+                    json.attribute("constFoldCacheHits", static_cast<int64_t>(summary.numConstFoldCacheHits));
+                });
+            }
+        });
+
+        json.attribute("peakRssKB", getPeakResidentMemoryUsage().count());
+    });
+    os << "\n";
+}
+
+void vpux::PassFlightRecorder::writeReport(StringRef filePath) const {
+    std::error_code err;
+    llvm::raw_fd_ostream os(filePath, err, llvm::sys::fs::OF_Text);
+    if (err) {
+        _log.warning("Failed to open pass flight recorder report '{0}': {1}", filePath, err.message());
+        return;
+    }
+
+    printReport(os);
+    os.flush();
+    if (os.has_error()) {
+        _log.warning("Failed to write pass flight recorder report '{0}': {1}", filePath, os.error().message());
+        os.clear_error();
+        return;
+    }
+
+    _log.info("Pass flight recorder report written to '{0}'", filePath);
+}
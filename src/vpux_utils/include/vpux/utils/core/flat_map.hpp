@@ -0,0 +1,139 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#pragma once
+
+#include "vpux/utils/core/small_vector.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <stdexcept>
+#include <utility>
+
+namespace vpux {
+
+//
+// FlatMap
+//
+// Ordered associative container stored as a sorted vector of key-value pairs. It is meant for maps with a handful of
+// keys which are looked up very often, e.g. per executor state, where the node based std::map spends most of the
+// time chasing pointers. Insertion is linear in the number of elements and invalidates iterators and references.
+//
+// The interface follows std::map, iteration is done in increasing key order.
+//
+
+template <typename Key, typename Value, unsigned N = 8, class Compare = std::less<Key>>
+class FlatMap final {
+public:
+    using key_type = Key;
+    using mapped_type = Value;
+    using value_type = std::pair<Key, Value>;
+    using iterator = typename SmallVector<value_type, N>::iterator;
+    using const_iterator = typename SmallVector<value_type, N>::const_iterator;
+
+public:
+    FlatMap() = default;
+
+    FlatMap(std::initializer_list<value_type> values) {
+        for (const auto& val : values) {
+            insert(val);
+        }
+    }
+
+public:
+    Value& operator[](const Key& key) {
+        auto it = lowerBound(key);
+        if (it == _storage.end() || _cmp(key, it->first)) {
+            it = _storage.insert(it, value_type(key, Value()));
+        }
+        return it->second;
+    }
+
+    std::pair<iterator, bool> insert(const value_type& val) {
+        auto it = lowerBound(val.first);
+        if (it != _storage.end() && !_cmp(val.first, it->first)) {
+            return {it, false};
+        }
+        return {_storage.insert(it, val), true};
+    }
+
+    iterator erase(const_iterator pos) {
+        return _storage.erase(pos);
+    }
+
+    size_t erase(const Key& key) {
+        auto it = find(key);
+        if (it == _storage.end()) {
+            return 0;
+        }
+        _storage.erase(it);
+        return 1;
+    }
+
+    void clear() {
+        _storage.clear();
+    }
+
+public:
+    iterator find(const Key& key) {
+        auto it = lowerBound(key);
+        return it != _storage.end() && !_cmp(key, it->first) ? it : _storage.end();
+    }
+    const_iterator find(const Key& key) const {
+        return const_cast<FlatMap*>(this)->find(key);
+    }
+
+    size_t count(const Key& key) const {
+        return find(key) != end() ? 1 : 0;
+    }
+
+    Value& at(const Key& key) {
+        auto it = find(key);
+        if (it == _storage.end()) {
+            throw std::out_of_range("FlatMap::at: key not found");
+        }
+        return it->second;
+    }
+    const Value& at(const Key& key) const {
+        return const_cast<FlatMap*>(this)->at(key);
+    }
+
+    bool empty() const {
+        return _storage.empty();
+    }
+
+    size_t size() const {
+        return _storage.size();
+    }
+
+public:
+    iterator begin() {
+        return _storage.begin();
+    }
+    iterator end() {
+        return _storage.end();
+    }
+
+    const_iterator begin() const {
+        return _storage.begin();
+    }
+    const_iterator end() const {
+        return _storage.end();
+    }
+
+private:
+    iterator lowerBound(const Key& key) {
+        return std::lower_bound(_storage.begin(), _storage.end(), key, [&](const value_type& lhs, const Key& rhs) {
+            return _cmp(lhs.first, rhs);
+        });
+    }
+
+private:
+    SmallVector<value_type, N> _storage;
+    Compare _cmp;
+};
+
+}  // namespace vpux
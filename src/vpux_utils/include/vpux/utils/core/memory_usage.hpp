@@ -9,4 +9,9 @@
 
 namespace vpux {
 vpux::KB getPeakMemoryUsage();
+
+// Resident set size of the process, i.e. the physical memory it currently uses
+vpux::KB getResidentMemoryUsage();
+// Highest resident set size of the process since its start
+vpux::KB getPeakResidentMemoryUsage();
 }
@@ -11,6 +11,8 @@
 
 #include <cstddef>
 #include <ostream>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace vpux::profiling {
@@ -82,6 +84,76 @@ std::vector<LayerInfo> getLayerInfo(const uint8_t* blobData, size_t blobSize, co
  */
 std::vector<LayerInfo> getLayerInfo(const std::vector<TaskInfo>& taskInfo);
 
+/**
+ * @class TaskInfoReader
+ * @brief Incremental access to the per-task info of raw profiling output.
+ *
+ * The tasks of each engine (DMA, DPU, SW, M2I) are converted and ordered by start time separately and kept by the
+ * reader, so its memory grows with the total number of tasks. They are merged on the fly while reading, in the same
+ * order as returned by \b getTaskInfo, which avoids the concatenated copy of all the tasks and its global sort.
+ * @see getTaskInfo
+ */
+class TaskInfoReader {
+public:
+    /**
+     * @brief Parse raw profiling output, the arguments are the same as for \b getTaskInfo.
+     */
+    TaskInfoReader(const uint8_t* blobData, size_t blobSize, const uint8_t* profData, size_t profSize,
+                   VerbosityLevel verbosity, bool fpga = false, bool highFreqPerfClk = false);
+
+    /**
+     * @brief Merge already converted tasks.
+     * @param engineTasks - tasks of each engine, ordered by start time. Equal tasks of different engines are read in
+     * the order of the engines
+     */
+    explicit TaskInfoReader(std::vector<std::vector<TaskInfo>> engineTasks, FreqInfo dpuFreq = {});
+
+    /**
+     * @brief Read the next task in start time order.
+     * @return pointer to the task which stays valid for the lifetime of the reader, nullptr once all the tasks were
+     * read
+     */
+    const TaskInfo* next();
+
+    /// Total number of tasks, including already read ones
+    size_t size() const;
+
+    FreqInfo getDpuFreq() const {
+        return _dpuFreq;
+    }
+
+private:
+    // Position of the next task to read from an engine
+    struct Cursor {
+        size_t engine;
+        size_t index;
+    };
+
+    void initCursors();
+    bool isReadAfter(const Cursor& lhs, const Cursor& rhs) const;
+
+    std::vector<std::vector<TaskInfo>> _engineTasks;
+    std::vector<Cursor> _cursors;
+    FreqInfo _dpuFreq;
+};
+
+/**
+ * @class LayerInfoBuilder
+ * @brief Incremental aggregation of per-task info into per-layer info.
+ * @see getLayerInfo
+ */
+class LayerInfoBuilder {
+public:
+    void addTask(const TaskInfo& task);
+
+    /// Layers ordered by start time
+    std::vector<LayerInfo> getLayerInfo() const;
+
+private:
+    std::vector<LayerInfo> _layers;
+    std::unordered_map<std::string, size_t> _layerIndices;
+};
+
 void writeDebugProfilingInfo(std::ostream& outStream, const uint8_t* blobData, size_t blobSize, const uint8_t* profData,
                              size_t profSize);
 
@@ -6,6 +6,7 @@
 #pragma once
 
 #include "vpux/utils/core/logger.hpp"
+#include "vpux/utils/profiling/parser/api.hpp"
 #include "vpux/utils/profiling/taskinfo.hpp"
 
 #include <ostream>
@@ -15,8 +16,17 @@ namespace vpux::profiling {
 
 void printProfilingAsText(const std::vector<TaskInfo>& tasks, const std::vector<LayerInfo>& layers,
                           std::ostream& output);
+// Prints the tasks while they are read and aggregates the layers on the fly, without copying the tasks out of the
+// reader
+void printProfilingAsText(TaskInfoReader& reader, std::ostream& output);
 void printProfilingAsTraceEvent(const std::vector<TaskInfo>& tasks, const std::vector<LayerInfo>& layers,
                                 FreqInfo dpuFreq, std::ostream& output, Logger& log = Logger::global());
+// Binary report described in reports/columnar.hpp, the output stream must be opened in binary mode
+void printProfilingAsColumnar(const std::vector<TaskInfo>& tasks, const std::vector<LayerInfo>& layers,
+                              FreqInfo dpuFreq, std::ostream& output);
+void printProfilingAsColumnar(TaskInfoReader& reader, std::ostream& output);
+// Reads back the tasks, layers and DPU frequency of a columnar report. Task ids are not stored and keep their defaults
+ProfInfo readProfilingFromColumnar(const uint8_t* data, size_t size);
 
 //
 //  Run profiling post-processing and profilng environemnt hooks
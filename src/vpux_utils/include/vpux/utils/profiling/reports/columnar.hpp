@@ -0,0 +1,130 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+// Layout of the binary columnar profiling report
+
+#pragma once
+
+#include "vpux/utils/core/error.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <vector>
+
+namespace vpux::profiling::columnar {
+
+//
+// The file is meant to be mapped into memory and used without parsing:
+//
+//   FileHeader
+//   ColumnDesc[FileHeader::numColumns]
+//   column data, each column starts at an 8 bytes aligned offset
+//
+// All the values are stored in little-endian byte order. Every column is a plain array of ColumnDesc::count elements
+// of ColumnDesc::elementSize bytes. Readers look columns up by id and must skip the ones they don't know, so new
+// columns can be added without changing the version.
+//
+// Task and layer names are interned: the name columns store ids into the string table. The string i occupies bytes
+// [STRING_OFFSETS[i], STRING_OFFSETS[i + 1] - 1) of STRING_DATA and is followed by a null character.
+//
+
+constexpr char MAGIC[8] = {'N', 'P', 'U', 'P', 'R', 'O', 'F', 'C'};
+constexpr uint32_t VERSION = 1;
+constexpr uint64_t COLUMN_ALIGNMENT = 8;
+
+// Value of TASK_CLUSTER column for tasks not assigned to a cluster
+constexpr int32_t NO_CLUSTER = -1;
+
+enum class ColumnId : uint32_t {
+    TASK_START_NS = 0,       // uint64_t
+    TASK_DURATION_NS = 1,    // uint64_t
+    TASK_NAME_ID = 2,        // uint32_t, full task name
+    TASK_LAYER_NAME_ID = 3,  // uint32_t, name of the layer the task belongs to
+    TASK_LAYER_TYPE_ID = 4,  // uint32_t
+    TASK_ENGINE = 5,         // uint8_t, TaskInfo::ExecType
+    TASK_CLUSTER = 6,        // int32_t, NO_CLUSTER if not clustered
+    TASK_ACTIVE_CYCLES = 7,  // uint32_t
+    TASK_STALL_CYCLES = 8,   // uint32_t
+
+    LAYER_START_NS = 16,     // uint64_t
+    LAYER_DURATION_NS = 17,  // uint64_t
+    LAYER_NAME_ID = 18,      // uint32_t
+    LAYER_TYPE_ID = 19,      // uint32_t
+    LAYER_DPU_NS = 20,       // uint64_t
+    LAYER_SW_NS = 21,        // uint64_t
+    LAYER_DMA_NS = 22,       // uint64_t
+
+    STRING_OFFSETS = 32,  // uint64_t, numStrings + 1 elements
+    STRING_DATA = 33,     // char
+};
+
+struct FileHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t numColumns;
+    uint64_t numTasks;
+    uint64_t numLayers;
+    uint64_t numStrings;
+    double dpuFreqMHz;
+    uint32_t dpuFreqStatus;  // FreqStatus
+    uint32_t reserved;
+};
+
+static_assert(sizeof(FileHeader) == 56);
+
+struct ColumnDesc {
+    uint32_t id;  // ColumnId
+    uint32_t elementSize;
+    uint64_t offset;  // from the beginning of the file
+    uint64_t count;
+};
+
+static_assert(sizeof(ColumnDesc) == 24);
+
+//
+// ReportView
+//
+
+// Read-only access to a report written by printProfilingAsColumnar. The view does not own `data`, it must outlive
+// the view. The file header and the column directory are validated once in the constructor, the data does not need to
+// be aligned
+class ReportView final {
+public:
+    ReportView(const uint8_t* data, size_t size);
+
+public:
+    const FileHeader& getHeader() const {
+        return _header;
+    }
+
+    bool hasColumn(ColumnId id) const;
+
+    // Copies the column out of the report, T must match the element type of the column
+    template <typename T>
+    std::vector<T> getColumn(ColumnId id) const {
+        const auto& desc = getColumnDesc(id);
+        VPUX_THROW_UNLESS(desc.elementSize == sizeof(T), "Column {0} has {1} bytes elements, but {2} were requested",
+                          desc.id, desc.elementSize, sizeof(T));
+        std::vector<T> values(desc.count);
+        if (!values.empty()) {
+            std::memcpy(values.data(), _data + desc.offset, desc.count * sizeof(T));
+        }
+        return values;
+    }
+
+    std::string_view getString(uint32_t id) const;
+
+private:
+    const ColumnDesc& getColumnDesc(ColumnId id) const;
+
+private:
+    const uint8_t* _data;
+    size_t _size;
+    FileHeader _header;
+    std::vector<ColumnDesc> _columns;
+};
+
+}  // namespace vpux::profiling::columnar
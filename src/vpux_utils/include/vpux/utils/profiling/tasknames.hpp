@@ -7,8 +7,11 @@
 
 #pragma once
 
+#include <cstdint>
+#include <deque>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 
 namespace vpux::profiling {
@@ -89,4 +92,28 @@ std::string getVariantFromName(const std::string& name);
  */
 std::string getValueFromStructuredTaskName(const std::string& name, const std::string& key);
 
+/**
+ * @brief Interning table for task and layer names
+ *
+ * Every distinct name is stored once and referred to by a dense id, ids are assigned in the order of the first
+ * occurrence starting from 0. Reports use the ids instead of repeating the names for each task.
+ */
+class TaskNameTable {
+public:
+    uint32_t intern(std::string_view name);
+
+    size_t size() const {
+        return _names.size();
+    }
+    std::string_view getName(uint32_t id) const {
+        return _names.at(id);
+    }
+
+private:
+    // Deque keeps the stored names in place, so the views used as keys stay valid
+    std::deque<std::string> _storage;
+    std::unordered_map<std::string_view, uint32_t> _ids;
+    std::vector<std::string_view> _names;
+};
+
 }  // namespace vpux::profiling
@@ -5,6 +5,10 @@
 
 #include "vpux/utils/core/memory_usage.hpp"
 
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include <cstdio>
 #include <fstream>
 #include <regex>
 
@@ -26,4 +30,31 @@ vpux::KB getPeakMemoryUsage() {
     return vpux::KB(peakMemUsageKB);
 }
 
+vpux::KB getResidentMemoryUsage() {
+    // The second field of statm is the number of resident pages, reading it is much cheaper than parsing status
+    FILE* statmFile = std::fopen("/proc/self/statm", "r");
+    if (statmFile == nullptr) {
+        return vpux::KB(0);
+    }
+
+    long long totalPages = 0;
+    long long residentPages = 0;
+    const auto numFields = std::fscanf(statmFile, "%lld %lld", &totalPages, &residentPages);
+    std::fclose(statmFile);
+    if (numFields != 2) {
+        return vpux::KB(0);
+    }
+
+    return vpux::KB(residentPages * sysconf(_SC_PAGESIZE) / 1024);
+}
+
+vpux::KB getPeakResidentMemoryUsage() {
+    struct rusage usage = {};
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return vpux::KB(0);
+    }
+    // ru_maxrss is reported in kilobytes
+    return vpux::KB(usage.ru_maxrss);
+}
+
 }  // namespace vpux
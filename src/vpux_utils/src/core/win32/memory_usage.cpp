@@ -17,4 +17,14 @@ vpux::KB getPeakMemoryUsage() {
     return vpux::KB(vpux::Byte(memCounters.PeakWorkingSetSize));
 }
 
+vpux::KB getResidentMemoryUsage() {
+    PROCESS_MEMORY_COUNTERS memCounters;
+    GetProcessMemoryInfo(GetCurrentProcess(), &memCounters, sizeof(memCounters));
+    return vpux::KB(vpux::Byte(memCounters.WorkingSetSize));
+}
+
+vpux::KB getPeakResidentMemoryUsage() {
+    return getPeakMemoryUsage();
+}
+
 }  // namespace vpux
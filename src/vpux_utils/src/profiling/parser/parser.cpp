@@ -14,7 +14,9 @@
 
 #include "schema/profiling_generated.h"
 
+#include <algorithm>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace vpux::profiling {
@@ -437,10 +439,11 @@ RawProfilingRecords makeFakeDpuInvariants(const RawProfilingRecords& variants) {
 }
 
 // At parse time we don't know frequency for some platforms, so data is collected in cycles format. We need
-// to determine frequency to convert from cycles to nanoseconds
-std::vector<TaskInfo> convertRawTasksToTaskInfo(const RawProfilingData& rawTasks,
-                                                const FrequenciesSetup& frequenciesSetup, VerbosityLevel verbosity,
-                                                vpux::Logger& log) {
+// to determine frequency to convert from cycles to nanoseconds. Tasks are returned per engine, each engine ordered by
+// start time
+std::vector<std::vector<TaskInfo>> convertRawTasksToEngineTaskInfo(const RawProfilingData& rawTasks,
+                                                                   const FrequenciesSetup& frequenciesSetup,
+                                                                   VerbosityLevel verbosity, vpux::Logger& log) {
     for (const auto& taskList : {rawTasks.dmaTasks, rawTasks.dpuTasks, rawTasks.swTasks, rawTasks.m2iTasks}) {
         for (const auto& task : taskList) {
             task->sanitize(log, frequenciesSetup);
@@ -495,8 +498,6 @@ std::vector<TaskInfo> convertRawTasksToTaskInfo(const RawProfilingData& rawTasks
             dma2dpuOffset = earliestDmaNs.has_value() ? 0 : -static_cast<int64_t>(earliestTaskNs);
         }
         adjustZeroPoint(dpuTaskInfo, dma2dpuOffset, earliestDmaNs);
-        // Order DPU tasks by time to make tests more stable
-        std::sort(dpuTaskInfo.begin(), dpuTaskInfo.end(), profilingTaskStartTimeComparator<TaskInfo>);
     }
 
     if (!swTaskInfo.empty()) {
@@ -522,16 +523,24 @@ std::vector<TaskInfo> convertRawTasksToTaskInfo(const RawProfilingData& rawTasks
 
     adjustZeroPoint(m2iTaskInfo, 0, earliestDmaNs);
 
-    std::vector<TaskInfo> allTaskInfo;
-    allTaskInfo.reserve(dpuTaskInfo.size() + dmaTaskInfo.size() + swTaskInfo.size() + m2iTaskInfo.size());
-    allTaskInfo.insert(allTaskInfo.end(), dpuTaskInfo.begin(), dpuTaskInfo.end());
-    allTaskInfo.insert(allTaskInfo.end(), dmaTaskInfo.begin(), dmaTaskInfo.end());
-    allTaskInfo.insert(allTaskInfo.end(), swTaskInfo.begin(), swTaskInfo.end());
-    allTaskInfo.insert(allTaskInfo.end(), m2iTaskInfo.begin(), m2iTaskInfo.end());
-
-    std::sort(allTaskInfo.begin(), allTaskInfo.end(), profilingTaskStartTimeComparator<TaskInfo>);
+    std::vector<std::vector<TaskInfo>> engineTaskInfo;
+    for (auto* taskInfo : {&dpuTaskInfo, &dmaTaskInfo, &swTaskInfo, &m2iTaskInfo}) {
+        if (taskInfo->empty()) {
+            continue;
+        }
+        std::sort(taskInfo->begin(), taskInfo->end(), profilingTaskStartTimeComparator<TaskInfo>);
+        engineTaskInfo.push_back(std::move(*taskInfo));
+    }
+    return engineTaskInfo;
+}
 
-    return allTaskInfo;
+std::vector<TaskInfo> readAllTasks(TaskInfoReader& reader) {
+    std::vector<TaskInfo> tasks;
+    tasks.reserve(reader.size());
+    while (const auto* task = reader.next()) {
+        tasks.push_back(*task);
+    }
+    return tasks;
 }
 
 }  // namespace
@@ -557,33 +566,93 @@ RawData getRawProfilingTasks(const uint8_t* blobData, size_t blobSize, const uin
     return {sections, std::move(rawProfData), device};
 }
 
-ProfInfo getProfInfo(const uint8_t* blobData, size_t blobSize, const uint8_t* profData, size_t profSize,
-                     VerbosityLevel verbosity, bool fpga, bool highFreqPerfClk) try {
+TaskInfoReader::TaskInfoReader(const uint8_t* blobData, size_t blobSize, const uint8_t* profData, size_t profSize,
+                               VerbosityLevel verbosity, bool fpga, bool highFreqPerfClk) try {
     const auto rawData = getRawProfilingTasks(blobData, blobSize, profData, profSize);
 
     auto log = vpux::Logger::global();
     FrequenciesSetup frequenciesSetup =
             getFrequencySetup(rawData.device, rawData.rawRecords.workpoints, highFreqPerfClk, fpga, log);
+    _engineTasks = convertRawTasksToEngineTaskInfo(rawData.rawRecords, frequenciesSetup, verbosity, log);
+    _dpuFreq.freqMHz = frequenciesSetup.dpuClk;
+    _dpuFreq.freqStatus = frequenciesSetup.clockStatus;
+    initCursors();
+} catch (const std::exception& ex) {
+    VPUX_THROW("Profiling post-processing failed. {0}", ex.what());
+}
+
+TaskInfoReader::TaskInfoReader(std::vector<std::vector<TaskInfo>> engineTasks, FreqInfo dpuFreq)
+        : _engineTasks(std::move(engineTasks)), _dpuFreq(dpuFreq) {
+    initCursors();
+}
+
+void TaskInfoReader::initCursors() {
+    // Min-heap of the engine heads, the engine order breaks the ties to keep the output deterministic
+    for (size_t engine = 0; engine < _engineTasks.size(); ++engine) {
+        if (!_engineTasks[engine].empty()) {
+            _cursors.push_back({engine, 0});
+        }
+    }
+    std::make_heap(_cursors.begin(), _cursors.end(), [this](const Cursor& lhs, const Cursor& rhs) {
+        return isReadAfter(lhs, rhs);
+    });
+}
+
+bool TaskInfoReader::isReadAfter(const Cursor& lhs, const Cursor& rhs) const {
+    const auto& lhsTask = _engineTasks[lhs.engine][lhs.index];
+    const auto& rhsTask = _engineTasks[rhs.engine][rhs.index];
+    if (profilingTaskStartTimeComparator(rhsTask, lhsTask)) {
+        return true;
+    }
+    if (profilingTaskStartTimeComparator(lhsTask, rhsTask)) {
+        return false;
+    }
+    return lhs.engine > rhs.engine;
+}
+
+const TaskInfo* TaskInfoReader::next() {
+    if (_cursors.empty()) {
+        return nullptr;
+    }
+
+    const auto cmp = [this](const Cursor& lhs, const Cursor& rhs) {
+        return isReadAfter(lhs, rhs);
+    };
+    std::pop_heap(_cursors.begin(), _cursors.end(), cmp);
+    auto& cursor = _cursors.back();
+    const auto* task = &_engineTasks[cursor.engine][cursor.index];
+
+    if (++cursor.index < _engineTasks[cursor.engine].size()) {
+        std::push_heap(_cursors.begin(), _cursors.end(), cmp);
+    } else {
+        _cursors.pop_back();
+    }
+    return task;
+}
+
+size_t TaskInfoReader::size() const {
+    size_t numTasks = 0;
+    for (const auto& tasks : _engineTasks) {
+        numTasks += tasks.size();
+    }
+    return numTasks;
+}
+
+ProfInfo getProfInfo(const uint8_t* blobData, size_t blobSize, const uint8_t* profData, size_t profSize,
+                     VerbosityLevel verbosity, bool fpga, bool highFreqPerfClk) {
+    TaskInfoReader reader(blobData, blobSize, profData, profSize, verbosity, fpga, highFreqPerfClk);
+
     ProfInfo profInfo;
-    profInfo.tasks = convertRawTasksToTaskInfo(rawData.rawRecords, frequenciesSetup, verbosity, log);
+    profInfo.tasks = readAllTasks(reader);
     profInfo.layers = getLayerInfo(profInfo.tasks);
-    profInfo.dpuFreq.freqMHz = frequenciesSetup.dpuClk;
-    profInfo.dpuFreq.freqStatus = frequenciesSetup.clockStatus;
+    profInfo.dpuFreq = reader.getDpuFreq();
     return profInfo;
-} catch (const std::exception& ex) {
-    VPUX_THROW("Profiling post-processing failed. {0}", ex.what());
 }
 
 std::vector<TaskInfo> getTaskInfo(const uint8_t* blobData, size_t blobSize, const uint8_t* profData, size_t profSize,
-                                  VerbosityLevel verbosity, bool fpga, bool highFreqPerfClk) try {
-    const auto rawData = getRawProfilingTasks(blobData, blobSize, profData, profSize);
-
-    auto log = vpux::Logger::global();
-    FrequenciesSetup frequenciesSetup =
-            getFrequencySetup(rawData.device, rawData.rawRecords.workpoints, highFreqPerfClk, fpga, log);
-    return convertRawTasksToTaskInfo(rawData.rawRecords, frequenciesSetup, verbosity, log);
-} catch (const std::exception& ex) {
-    VPUX_THROW("Profiling post-processing failed. {0}", ex.what());
+                                  VerbosityLevel verbosity, bool fpga, bool highFreqPerfClk) {
+    TaskInfoReader reader(blobData, blobSize, profData, profSize, verbosity, fpga, highFreqPerfClk);
+    return readAllTasks(reader);
 }
 
 std::vector<LayerInfo> getLayerInfo(const uint8_t* blobData, size_t blobSize, const uint8_t* profData, size_t profSize,
@@ -594,51 +663,56 @@ std::vector<LayerInfo> getLayerInfo(const uint8_t* blobData, size_t blobSize, co
 }
 
 std::vector<LayerInfo> getLayerInfo(const std::vector<TaskInfo>& taskInfo) {
-    std::vector<LayerInfo> layerInfo;
+    LayerInfoBuilder builder;
     for (const auto& task : taskInfo) {
-        LayerInfo* layer;
-        if (!getVariantFromName(task.name).empty()) {
-            // Skipping high verbose tasks with variant info
-            continue;
-        }
+        builder.addTask(task);
+    }
+    return builder.getLayerInfo();
+}
 
-        std::string layerName = getLayerName(task.name);
-        auto result = std::find_if(begin(layerInfo), end(layerInfo), [&](const LayerInfo& item) {
-            return layerName == item.name;
-        });
-        if (result == end(layerInfo)) {
-            layer = &layerInfo.emplace_back();
-            layer->status = LayerInfo::layer_status_t::EXECUTED;
-            layer->start_time_ns = task.start_time_ns;
-            layer->duration_ns = 0;
-
-            const auto nameLen = layerName.copy(layer->name, sizeof(layer->name) - 1);
-            layer->name[nameLen] = 0;
-
-            const std::string layerTypeStr(task.layer_type);
-            const auto typeLen = layerTypeStr.copy(layer->layer_type, sizeof(layer->layer_type) - 1);
-            layer->layer_type[typeLen] = 0;
-        } else {
-            layer = &(*result);
-        }
-        if (task.start_time_ns < layer->start_time_ns) {
-            layer->duration_ns += layer->start_time_ns - task.start_time_ns;
-            layer->start_time_ns = task.start_time_ns;
-        }
-        auto duration = (int64_t)task.start_time_ns + task.duration_ns - layer->start_time_ns;
-        if (duration > layer->duration_ns) {
-            layer->duration_ns = duration;
-        }
+void LayerInfoBuilder::addTask(const TaskInfo& task) {
+    if (!getVariantFromName(task.name).empty()) {
+        // Skipping high verbose tasks with variant info
+        return;
+    }
 
-        if (task.exec_type == TaskInfo::ExecType::DPU) {
-            layer->dpu_ns += task.duration_ns;
-        } else if (task.exec_type == TaskInfo::ExecType::SW || task.exec_type == TaskInfo::ExecType::UPA) {
-            layer->sw_ns += task.duration_ns;
-        } else if (task.exec_type == TaskInfo::ExecType::DMA) {
-            layer->dma_ns += task.duration_ns;
-        }
+    std::string layerName = getLayerName(task.name);
+    const auto [indexIt, inserted] = _layerIndices.emplace(layerName, _layers.size());
+    if (inserted) {
+        auto& newLayer = _layers.emplace_back();
+        newLayer.status = LayerInfo::layer_status_t::EXECUTED;
+        newLayer.start_time_ns = task.start_time_ns;
+        newLayer.duration_ns = 0;
+
+        const auto nameLen = layerName.copy(newLayer.name, sizeof(newLayer.name) - 1);
+        newLayer.name[nameLen] = 0;
+
+        const std::string layerTypeStr(task.layer_type);
+        const auto typeLen = layerTypeStr.copy(newLayer.layer_type, sizeof(newLayer.layer_type) - 1);
+        newLayer.layer_type[typeLen] = 0;
+    }
+
+    auto& layer = _layers[indexIt->second];
+    if (task.start_time_ns < layer.start_time_ns) {
+        layer.duration_ns += layer.start_time_ns - task.start_time_ns;
+        layer.start_time_ns = task.start_time_ns;
+    }
+    auto duration = (int64_t)task.start_time_ns + task.duration_ns - layer.start_time_ns;
+    if (duration > layer.duration_ns) {
+        layer.duration_ns = duration;
     }
 
+    if (task.exec_type == TaskInfo::ExecType::DPU) {
+        layer.dpu_ns += task.duration_ns;
+    } else if (task.exec_type == TaskInfo::ExecType::SW || task.exec_type == TaskInfo::ExecType::UPA) {
+        layer.sw_ns += task.duration_ns;
+    } else if (task.exec_type == TaskInfo::ExecType::DMA) {
+        layer.dma_ns += task.duration_ns;
+    }
+}
+
+std::vector<LayerInfo> LayerInfoBuilder::getLayerInfo() const {
+    auto layerInfo = _layers;
     std::sort(layerInfo.begin(), layerInfo.end(), profilingTaskStartTimeComparator<LayerInfo>);
     return layerInfo;
 }
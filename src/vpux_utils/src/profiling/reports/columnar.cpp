@@ -0,0 +1,328 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/utils/profiling/reports/columnar.hpp"
+#include "vpux/utils/profiling/reports/api.hpp"
+
+#include "vpux/utils/core/error.hpp"
+#include "vpux/utils/profiling/taskinfo.hpp"
+#include "vpux/utils/profiling/tasknames.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace vpux::profiling {
+
+namespace {
+
+using columnar::ColumnId;
+
+bool isLittleEndianHost() {
+    const uint16_t value = 1;
+    uint8_t firstByte = 0;
+    std::memcpy(&firstByte, &value, sizeof(firstByte));
+    return firstByte == 1;
+}
+
+template <size_t N>
+std::string_view toStringView(const char (&str)[N]) {
+    return std::string_view(str, strnlen(str, N));
+}
+
+int32_t getClusterId(const TaskInfo& task) {
+    const auto clusterStr = getClusterFromName(task.name);
+    int32_t clusterId = columnar::NO_CLUSTER;
+    const auto strEnd = clusterStr.data() + clusterStr.size();
+    const auto [parseEnd, errc] = std::from_chars(clusterStr.data(), strEnd, clusterId);
+    if (errc != std::errc() || parseEnd != strEnd) {
+        return columnar::NO_CLUSTER;
+    }
+    return clusterId;
+}
+
+struct Column {
+    ColumnId id;
+    uint32_t elementSize;
+    const void* data;
+    uint64_t count;
+};
+
+template <typename T>
+Column makeColumn(ColumnId id, const std::vector<T>& values) {
+    return {id, static_cast<uint32_t>(sizeof(T)), values.data(), values.size()};
+}
+
+uint64_t alignOffset(uint64_t offset) {
+    return (offset + columnar::COLUMN_ALIGNMENT - 1) / columnar::COLUMN_ALIGNMENT * columnar::COLUMN_ALIGNMENT;
+}
+
+//
+// ColumnarReportBuilder
+//
+
+// Collects the tasks into columns while they are read, the names are interned as they come
+class ColumnarReportBuilder {
+public:
+    void addTask(const TaskInfo& task);
+    void write(const std::vector<LayerInfo>& layers, FreqInfo dpuFreq, std::ostream& output);
+
+private:
+    TaskNameTable _names;
+
+    std::vector<uint64_t> _taskStart;
+    std::vector<uint64_t> _taskDuration;
+    std::vector<uint32_t> _taskNameId;
+    std::vector<uint32_t> _taskLayerNameId;
+    std::vector<uint32_t> _taskLayerTypeId;
+    std::vector<uint8_t> _taskEngine;
+    std::vector<int32_t> _taskCluster;
+    std::vector<uint32_t> _taskActiveCycles;
+    std::vector<uint32_t> _taskStallCycles;
+};
+
+void ColumnarReportBuilder::addTask(const TaskInfo& task) {
+    const std::string taskName(toStringView(task.name));
+
+    _taskStart.push_back(task.start_time_ns);
+    _taskDuration.push_back(task.duration_ns);
+    _taskNameId.push_back(_names.intern(taskName));
+    // Same parsing as LayerInfoBuilder, so that the ids match the layer columns
+    _taskLayerNameId.push_back(_names.intern(getLayerName(taskName)));
+    _taskLayerTypeId.push_back(_names.intern(toStringView(task.layer_type)));
+    _taskEngine.push_back(static_cast<uint8_t>(task.exec_type));
+    _taskCluster.push_back(getClusterId(task));
+    _taskActiveCycles.push_back(task.active_cycles);
+    _taskStallCycles.push_back(task.stall_cycles);
+}
+
+void ColumnarReportBuilder::write(const std::vector<LayerInfo>& layers, FreqInfo dpuFreq, std::ostream& output) {
+    VPUX_THROW_UNLESS(isLittleEndianHost(), "Columnar profiling report is supported on little-endian hosts only");
+
+    std::vector<uint64_t> layerStart;
+    std::vector<uint64_t> layerDuration;
+    std::vector<uint32_t> layerNameId;
+    std::vector<uint32_t> layerTypeId;
+    std::vector<uint64_t> layerDpu;
+    std::vector<uint64_t> layerSw;
+    std::vector<uint64_t> layerDma;
+    for (const auto& layer : layers) {
+        layerStart.push_back(layer.start_time_ns);
+        layerDuration.push_back(layer.duration_ns);
+        layerNameId.push_back(_names.intern(toStringView(layer.name)));
+        layerTypeId.push_back(_names.intern(toStringView(layer.layer_type)));
+        layerDpu.push_back(layer.dpu_ns);
+        layerSw.push_back(layer.sw_ns);
+        layerDma.push_back(layer.dma_ns);
+    }
+
+    std::vector<uint64_t> stringOffsets;
+    std::vector<char> stringData;
+    stringOffsets.reserve(_names.size() + 1);
+    for (uint32_t id = 0; id < _names.size(); ++id) {
+        const auto name = _names.getName(id);
+        stringOffsets.push_back(stringData.size());
+        stringData.insert(stringData.end(), name.begin(), name.end());
+        stringData.push_back('\0');
+    }
+    stringOffsets.push_back(stringData.size());
+
+    const std::vector<Column> columns = {
+            makeColumn(ColumnId::TASK_START_NS, _taskStart),
+            makeColumn(ColumnId::TASK_DURATION_NS, _taskDuration),
+            makeColumn(ColumnId::TASK_NAME_ID, _taskNameId),
+            makeColumn(ColumnId::TASK_LAYER_NAME_ID, _taskLayerNameId),
+            makeColumn(ColumnId::TASK_LAYER_TYPE_ID, _taskLayerTypeId),
+            makeColumn(ColumnId::TASK_ENGINE, _taskEngine),
+            makeColumn(ColumnId::TASK_CLUSTER, _taskCluster),
+            makeColumn(ColumnId::TASK_ACTIVE_CYCLES, _taskActiveCycles),
+            makeColumn(ColumnId::TASK_STALL_CYCLES, _taskStallCycles),
+            makeColumn(ColumnId::LAYER_START_NS, layerStart),
+            makeColumn(ColumnId::LAYER_DURATION_NS, layerDuration),
+            makeColumn(ColumnId::LAYER_NAME_ID, layerNameId),
+            makeColumn(ColumnId::LAYER_TYPE_ID, layerTypeId),
+            makeColumn(ColumnId::LAYER_DPU_NS, layerDpu),
+            makeColumn(ColumnId::LAYER_SW_NS, layerSw),
+            makeColumn(ColumnId::LAYER_DMA_NS, layerDma),
+            makeColumn(ColumnId::STRING_OFFSETS, stringOffsets),
+            makeColumn(ColumnId::STRING_DATA, stringData),
+    };
+
+    columnar::FileHeader header = {};
+    std::memcpy(header.magic, columnar::MAGIC, sizeof(header.magic));
+    header.version = columnar::VERSION;
+    header.numColumns = static_cast<uint32_t>(columns.size());
+    header.numTasks = _taskStart.size();
+    header.numLayers = layers.size();
+    header.numStrings = _names.size();
+    header.dpuFreqMHz = dpuFreq.freqMHz;
+    header.dpuFreqStatus = static_cast<uint32_t>(dpuFreq.freqStatus);
+
+    std::vector<columnar::ColumnDesc> descs;
+    uint64_t offset = sizeof(columnar::FileHeader) + columns.size() * sizeof(columnar::ColumnDesc);
+    for (const auto& column : columns) {
+        offset = alignOffset(offset);
+        descs.push_back({static_cast<uint32_t>(column.id), column.elementSize, offset, column.count});
+        offset += column.elementSize * column.count;
+    }
+
+    output.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    output.write(reinterpret_cast<const char*>(descs.data()),
+                 static_cast<std::streamsize>(descs.size() * sizeof(columnar::ColumnDesc)));
+
+    uint64_t written = sizeof(columnar::FileHeader) + descs.size() * sizeof(columnar::ColumnDesc);
+    const char padding[columnar::COLUMN_ALIGNMENT] = {};
+    for (size_t i = 0; i < columns.size(); ++i) {
+        output.write(padding, static_cast<std::streamsize>(descs[i].offset - written));
+        const auto columnSize = columns[i].elementSize * columns[i].count;
+        output.write(static_cast<const char*>(columns[i].data), static_cast<std::streamsize>(columnSize));
+        written = descs[i].offset + columnSize;
+    }
+    output.flush();
+}
+
+template <size_t N>
+void copyName(std::string_view name, char (&dst)[N]) {
+    const auto nameLen = name.copy(dst, N - 1);
+    dst[nameLen] = 0;
+}
+
+}  // namespace
+
+//
+// ReportView
+//
+
+columnar::ReportView::ReportView(const uint8_t* data, size_t size): _data(data), _size(size), _header() {
+    VPUX_THROW_UNLESS(isLittleEndianHost(), "Columnar profiling report is supported on little-endian hosts only");
+    VPUX_THROW_UNLESS(_size >= sizeof(_header), "Columnar profiling report is truncated");
+    std::memcpy(&_header, _data, sizeof(_header));
+    VPUX_THROW_UNLESS(std::memcmp(_header.magic, MAGIC, sizeof(_header.magic)) == 0,
+                      "Data is not a columnar profiling report");
+    VPUX_THROW_UNLESS(_header.version == VERSION,
+                      "Columnar profiling report has version {0}, but only {1} is supported", _header.version, VERSION);
+
+    const uint64_t directorySize = sizeof(_header) + uint64_t{_header.numColumns} * sizeof(ColumnDesc);
+    VPUX_THROW_UNLESS(_size >= directorySize, "Columnar profiling report is truncated");
+    _columns.resize(_header.numColumns);
+    std::memcpy(_columns.data(), _data + sizeof(_header), _columns.size() * sizeof(ColumnDesc));
+
+    for (const auto& column : _columns) {
+        const auto fits = column.offset <= _size && column.elementSize != 0 &&
+                          column.count <= (_size - column.offset) / column.elementSize;
+        VPUX_THROW_UNLESS(fits, "Column {0} of columnar profiling report is out of bounds", column.id);
+    }
+}
+
+bool columnar::ReportView::hasColumn(ColumnId id) const {
+    return std::any_of(_columns.begin(), _columns.end(), [&](const ColumnDesc& column) {
+        return column.id == static_cast<uint32_t>(id);
+    });
+}
+
+const columnar::ColumnDesc& columnar::ReportView::getColumnDesc(ColumnId id) const {
+    const auto column = std::find_if(_columns.begin(), _columns.end(), [&](const ColumnDesc& desc) {
+        return desc.id == static_cast<uint32_t>(id);
+    });
+    VPUX_THROW_WHEN(column == _columns.end(), "Columnar profiling report has no column {0}", static_cast<uint32_t>(id));
+    return *column;
+}
+
+std::string_view columnar::ReportView::getString(uint32_t id) const {
+    const auto& offsets = getColumnDesc(ColumnId::STRING_OFFSETS);
+    const auto& data = getColumnDesc(ColumnId::STRING_DATA);
+    VPUX_THROW_UNLESS(offsets.elementSize == sizeof(uint64_t) && id + uint64_t{1} < offsets.count,
+                      "String {0} is out of the string table", id);
+
+    uint64_t bounds[2] = {};
+    std::memcpy(bounds, _data + offsets.offset + id * sizeof(uint64_t), sizeof(bounds));
+    VPUX_THROW_UNLESS(bounds[0] < bounds[1] && bounds[1] <= data.count, "String {0} is out of the string table", id);
+    return std::string_view(reinterpret_cast<const char*>(_data + data.offset + bounds[0]), bounds[1] - bounds[0] - 1);
+}
+
+void printProfilingAsColumnar(const std::vector<TaskInfo>& tasks, const std::vector<LayerInfo>& layers,
+                              FreqInfo dpuFreq, std::ostream& output) {
+    ColumnarReportBuilder builder;
+    for (const auto& task : tasks) {
+        builder.addTask(task);
+    }
+    builder.write(layers, dpuFreq, output);
+}
+
+void printProfilingAsColumnar(TaskInfoReader& reader, std::ostream& output) {
+    ColumnarReportBuilder builder;
+    LayerInfoBuilder layers;
+    while (const auto* task = reader.next()) {
+        builder.addTask(*task);
+        layers.addTask(*task);
+    }
+    builder.write(layers.getLayerInfo(), reader.getDpuFreq(), output);
+}
+
+ProfInfo readProfilingFromColumnar(const uint8_t* data, size_t size) {
+    const columnar::ReportView report(data, size);
+    const auto& header = report.getHeader();
+
+    ProfInfo profInfo;
+    profInfo.dpuFreq.freqMHz = header.dpuFreqMHz;
+    profInfo.dpuFreq.freqStatus = static_cast<FreqStatus>(header.dpuFreqStatus);
+
+    const auto taskStart = report.getColumn<uint64_t>(ColumnId::TASK_START_NS);
+    const auto taskDuration = report.getColumn<uint64_t>(ColumnId::TASK_DURATION_NS);
+    const auto taskNameId = report.getColumn<uint32_t>(ColumnId::TASK_NAME_ID);
+    const auto taskLayerTypeId = report.getColumn<uint32_t>(ColumnId::TASK_LAYER_TYPE_ID);
+    const auto taskEngine = report.getColumn<uint8_t>(ColumnId::TASK_ENGINE);
+    const auto taskActiveCycles = report.getColumn<uint32_t>(ColumnId::TASK_ACTIVE_CYCLES);
+    const auto taskStallCycles = report.getColumn<uint32_t>(ColumnId::TASK_STALL_CYCLES);
+    for (const auto count : {taskStart.size(), taskDuration.size(), taskNameId.size(), taskLayerTypeId.size(),
+                             taskEngine.size(), taskActiveCycles.size(), taskStallCycles.size()}) {
+        VPUX_THROW_UNLESS(count == header.numTasks, "Task column has {0} elements instead of {1}", count,
+                          header.numTasks);
+    }
+
+    profInfo.tasks.resize(header.numTasks);
+    for (size_t i = 0; i < profInfo.tasks.size(); ++i) {
+        auto& task = profInfo.tasks[i];
+        copyName(report.getString(taskNameId[i]), task.name);
+        copyName(report.getString(taskLayerTypeId[i]), task.layer_type);
+        task.exec_type = static_cast<TaskInfo::ExecType>(taskEngine[i]);
+        task.start_time_ns = taskStart[i];
+        task.duration_ns = taskDuration[i];
+        task.active_cycles = taskActiveCycles[i];
+        task.stall_cycles = taskStallCycles[i];
+    }
+
+    const auto layerStart = report.getColumn<uint64_t>(ColumnId::LAYER_START_NS);
+    const auto layerDuration = report.getColumn<uint64_t>(ColumnId::LAYER_DURATION_NS);
+    const auto layerNameId = report.getColumn<uint32_t>(ColumnId::LAYER_NAME_ID);
+    const auto layerTypeId = report.getColumn<uint32_t>(ColumnId::LAYER_TYPE_ID);
+    const auto layerDpu = report.getColumn<uint64_t>(ColumnId::LAYER_DPU_NS);
+    const auto layerSw = report.getColumn<uint64_t>(ColumnId::LAYER_SW_NS);
+    const auto layerDma = report.getColumn<uint64_t>(ColumnId::LAYER_DMA_NS);
+    for (const auto count : {layerStart.size(), layerDuration.size(), layerNameId.size(), layerTypeId.size(),
+                             layerDpu.size(), layerSw.size(), layerDma.size()}) {
+        VPUX_THROW_UNLESS(count == header.numLayers, "Layer column has {0} elements instead of {1}", count,
+                          header.numLayers);
+    }
+
+    profInfo.layers.resize(header.numLayers);
+    for (size_t i = 0; i < profInfo.layers.size(); ++i) {
+        auto& layer = profInfo.layers[i];
+        copyName(report.getString(layerNameId[i]), layer.name);
+        copyName(report.getString(layerTypeId[i]), layer.layer_type);
+        layer.status = LayerInfo::layer_status_t::EXECUTED;
+        layer.start_time_ns = layerStart[i];
+        layer.duration_ns = layerDuration[i];
+        layer.dpu_ns = layerDpu[i];
+        layer.sw_ns = layerSw[i];
+        layer.dma_ns = layerDma[i];
+    }
+    return profInfo;
+}
+
+}  // namespace vpux::profiling
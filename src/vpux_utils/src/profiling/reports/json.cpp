@@ -13,8 +13,11 @@
 #include "vpux/utils/profiling/taskinfo.hpp"
 #include "vpux/utils/profiling/tasknames.hpp"
 
+#include <algorithm>
 #include <exception>
 #include <iomanip>
+#include <map>
+#include <optional>
 #include <ostream>
 #include <vector>
 
@@ -72,6 +75,12 @@ public:
      */
     void flushAsTraceEvents();
 
+    /**
+     * @brief schedule tasks and layers for output
+     *
+     * Only references are kept until \b flushAsTraceEvents, the trace events are created while flushing, so the
+     * tasks and layers must outlive the flush.
+     */
     void processTasks(const std::vector<TaskInfo>& tasks);
     void processLayers(const std::vector<LayerInfo>& layers);
 
@@ -90,7 +99,8 @@ private:
      * The function schedules tasks for output to out stream and generates meta type header trace events.
      * It internally manages trace events' thread IDs and names.
      */
-    void processTraceEvents(const TaskList& tasks, const std::string& processName, bool createNewProcess = true);
+    void processTraceEvents(std::vector<const TaskInfo*> tasks, const std::string& processName,
+                            bool createNewProcess = true);
 
     /**
      * @brief set tracing event process name for given process id.
@@ -132,7 +142,17 @@ private:
      */
     void validateTaskNameAndDuration(const TaskInfo& task) const;
 
-    std::vector<TraceEventDesc> _events;
+    // Placement of a task or a layer in the trace, exactly one of the pointers is set
+    struct ScheduledEvent {
+        const TaskInfo* task = nullptr;
+        const LayerInfo* layer = nullptr;
+        int pid = 0;
+        int tid = 0;
+    };
+
+    TraceEventDesc createTraceEvent(const ScheduledEvent& event) const;
+
+    std::vector<ScheduledEvent> _events;
     std::ostream& _outStream;
     Logger _log;
     int _processId = -1;
@@ -198,44 +218,91 @@ std::string formatDuration(uint64_t timeNs) {
     return timeString;
 }
 
+// Cluster the task is assigned to, std::nullopt if it can't be extracted from the task name
+std::optional<unsigned> getClusterId(const TaskInfo& task, Logger& log) {
+    std::string idStr = getClusterFromName(task.name);
+    try {
+        size_t idx;
+        const auto id = std::stoi(idStr, &idx);
+        if (idx < idStr.size()) {  // Not all characters converted, ignoring
+            log.warning("Not all characters converted while extracting cluster id from task ({0}). Task will not be "
+                        "reported.",
+                        task.name);
+            return std::nullopt;
+        }
+        return static_cast<unsigned>(id);
+    } catch (...) {  // Could not extract cluster id
+        log.warning("Could not extract cluster id for task ({0}). Task will not be reported.", task.name);
+        return std::nullopt;
+    }
+}
+
 void TraceEventExporter::processTasks(const std::vector<TaskInfo>& tasks) {
     for (auto& task : tasks) {
         validateTaskNameAndDuration(task);
     }
 
+    // Split the tasks into the trace event processes in a single pass, the tasks are referenced and not copied
+    std::vector<const TaskInfo*> dmaTasks;
+    std::vector<const TaskInfo*> upaTasks;
+    std::vector<const TaskInfo*> m2iTasks;
+    std::map<unsigned, std::vector<const TaskInfo*>> clusterDpuTasks;
+    std::map<unsigned, std::vector<const TaskInfo*>> clusterSwTasks;
+    bool hasSwTasks = false;
+    for (const auto& task : tasks) {
+        switch (task.exec_type) {
+        case TaskInfo::ExecType::DMA:
+            dmaTasks.push_back(&task);
+            break;
+        case TaskInfo::ExecType::UPA:
+            upaTasks.push_back(&task);
+            break;
+        case TaskInfo::ExecType::M2I:
+            m2iTasks.push_back(&task);
+            break;
+        case TaskInfo::ExecType::DPU:
+        case TaskInfo::ExecType::SW: {
+            hasSwTasks |= task.exec_type == TaskInfo::ExecType::SW;
+            const auto clusterId = getClusterId(task, _log);
+            if (clusterId.has_value()) {
+                auto& clusterTasks = task.exec_type == TaskInfo::ExecType::DPU ? clusterDpuTasks : clusterSwTasks;
+                clusterTasks[clusterId.value()].push_back(&task);
+            }
+            break;
+        }
+        default:
+            break;
+        }
+    }
+
     //
     // Export DMA tasks
     //
-    auto dmaTasks = TaskList(tasks).selectDMAtasks();
-    processTraceEvents(dmaTasks, DMA_PROCESS_NAME, /* createNewProcess= */ true);
+    processTraceEvents(std::move(dmaTasks), DMA_PROCESS_NAME, /* createNewProcess= */ true);
 
     //
     // Export cluster tasks (DPU and SW)
     //
     unsigned clusterCount = TaskList(tasks).getClusterCount();
 
-    TaskList dpuTasks = TaskList(tasks).selectDPUtasks();
-    TaskList swTasks = TaskList(tasks).selectSWtasks();
-
     for (unsigned clusterId = 0; clusterId < clusterCount; clusterId++) {
         std::string processName = std::string(CLUSTER_PROCESS_NAME) + " (" + std::to_string(clusterId) + ")";
-        auto clusterDpuTasks = dpuTasks.selectTasksFromCluster(clusterId);
-        processTraceEvents(clusterDpuTasks, processName, /* createNewProcess= */ true);
-        auto clusterSwTasks = swTasks.selectTasksFromCluster(clusterId);
-        processTraceEvents(clusterSwTasks, processName, /* createNewProcess= */ clusterDpuTasks.empty());
+        auto dpuTasks = std::move(clusterDpuTasks[clusterId]);
+        const auto hasDpuTasks = !dpuTasks.empty();
+        processTraceEvents(std::move(dpuTasks), processName, /* createNewProcess= */ true);
+        processTraceEvents(std::move(clusterSwTasks[clusterId]), processName, /* createNewProcess= */ !hasDpuTasks);
     }
 
     //
     // Export non-clustered SW tasks into separate UPA process
     //
-    TaskList upaTasks = TaskList(tasks).selectUPAtasks();
-    processTraceEvents(upaTasks, UPA_PROCESS_NAME, /* createNewProcess= */ true);
+    const auto hasUpaTasks = !upaTasks.empty();
+    processTraceEvents(std::move(upaTasks), UPA_PROCESS_NAME, /* createNewProcess= */ true);
 
-    VPUX_THROW_WHEN(!upaTasks.empty() && !swTasks.empty(),
+    VPUX_THROW_WHEN(hasUpaTasks && hasSwTasks,
                     "UPA and Shave tasks should be mutually exclusive but are found to coexist");
 
-    TaskList m2iTasks = TaskList(tasks).selectM2Itasks();
-    processTraceEvents(m2iTasks, M2I_PROCESS_NAME, /* createNewProcess= */ true);
+    processTraceEvents(std::move(m2iTasks), M2I_PROCESS_NAME, /* createNewProcess= */ true);
 }
 
 void TraceEventExporter::processLayers(const std::vector<LayerInfo>& layers) {
@@ -248,27 +315,11 @@ void TraceEventExporter::processLayers(const std::vector<LayerInfo>& layers) {
 
     TraceEventTimeOrderedDistribution layersDistr;
     for (auto& layer : layers) {
-        TraceEventDesc ted;
-        ted.name = layer.name;
-        ted.category = "Layer";
-        ted.pid = _processId;
-        ted.tid = layersDistr.getThreadId(layer.start_time_ns, layer.duration_ns);
-        // use ns-resolution integers to avoid round-off errors during fixed precision output to JSON
-        ted.timestamp = layer.start_time_ns / 1000.;
-        ted.duration = layer.duration_ns / 1000.;
-        ted.customArgs.push_back({"Layer type", layer.layer_type});
-
-        if (layer.dpu_ns != 0) {
-            ted.customArgs.push_back({"DPU time:", formatDuration(layer.dpu_ns)});
-        }
-        if (layer.sw_ns != 0) {
-            ted.customArgs.push_back({"Shave time:", formatDuration(layer.sw_ns)});
-        }
-        if (layer.dma_ns != 0) {
-            ted.customArgs.push_back({"DMA time:", formatDuration(layer.dma_ns)});
-        }
-
-        _events.push_back(ted);
+        ScheduledEvent event;
+        event.layer = &layer;
+        event.pid = _processId;
+        event.tid = layersDistr.getThreadId(layer.start_time_ns, layer.duration_ns);
+        _events.push_back(event);
     }
 
     setTraceEventProcessName(LAYER_PROCESS_NAME, _processId);
@@ -291,7 +342,7 @@ void TraceEventExporter::validateTaskNameAndDuration(const TaskInfo& task) const
     }
 }
 
-void TraceEventExporter::processTraceEvents(const TaskList& tasks, const std::string& processName,
+void TraceEventExporter::processTraceEvents(std::vector<const TaskInfo*> tasks, const std::string& processName,
                                             bool createNewProcess) {
     if (tasks.empty()) {  // don't need to output process details if there are no tasks to export
         return;
@@ -309,34 +360,71 @@ void TraceEventExporter::processTraceEvents(const TaskList& tasks, const std::st
 
     TraceEventTimeOrderedDistribution threadDistr;
 
-    auto sortedTasks = tasks.getSortedByStartTime();
-    for (const auto& task : sortedTasks) {
-        auto thId = _threadId + threadDistr.getThreadId(task.start_time_ns, task.duration_ns);
+    // Tasks coming from the parser are already ordered, sort only if needed
+    const auto startTimeComparator = [](const TaskInfo* lhs, const TaskInfo* rhs) {
+        return profilingTaskStartTimeComparator(*lhs, *rhs);
+    };
+    if (!std::is_sorted(tasks.begin(), tasks.end(), startTimeComparator)) {
+        std::sort(tasks.begin(), tasks.end(), startTimeComparator);
+    }
+
+    for (const auto* task : tasks) {
+        auto thId = _threadId + threadDistr.getThreadId(task->start_time_ns, task->duration_ns);
         if (thId > lastThreadId) {
-            setTraceEventThreadName(getTraceEventThreadName(task), thId, _processId);
+            setTraceEventThreadName(getTraceEventThreadName(*task), thId, _processId);
             lastThreadId = thId;
         }
 
-        TraceEventDesc ted;
-        ted.name = task.name;
-        ted.category = enumToStr.at(task.exec_type);
-        ted.pid = _processId;
-        ted.tid = thId;
+        ScheduledEvent event;
+        event.task = task;
+        event.pid = _processId;
+        event.tid = thId;
+        _events.push_back(event);
+    }
+
+    _threadId = lastThreadId;
+}
+
+TraceEventDesc TraceEventExporter::createTraceEvent(const ScheduledEvent& event) const {
+    TraceEventDesc ted;
+    ted.pid = event.pid;
+    ted.tid = event.tid;
+
+    if (event.layer != nullptr) {
+        const auto& layer = *event.layer;
+        ted.name = layer.name;
+        ted.category = "Layer";
         // use ns-resolution integers to avoid round-off errors during fixed precision output to JSON
-        ted.timestamp = task.start_time_ns / 1000.;
-        ted.duration = task.duration_ns / 1000.;
+        ted.timestamp = layer.start_time_ns / 1000.;
+        ted.duration = layer.duration_ns / 1000.;
+        ted.customArgs.push_back({"Layer type", layer.layer_type});
 
-        if (task.active_cycles != 0) {
-            ted.customArgs.push_back({"Active cycles:", std::to_string(task.active_cycles)});
+        if (layer.dpu_ns != 0) {
+            ted.customArgs.push_back({"DPU time:", formatDuration(layer.dpu_ns)});
         }
-        if (task.stall_cycles != 0) {
-            ted.customArgs.push_back({"Stall cycles:", std::to_string(task.stall_cycles)});
+        if (layer.sw_ns != 0) {
+            ted.customArgs.push_back({"Shave time:", formatDuration(layer.sw_ns)});
         }
-
-        _events.push_back(ted);
+        if (layer.dma_ns != 0) {
+            ted.customArgs.push_back({"DMA time:", formatDuration(layer.dma_ns)});
+        }
+        return ted;
     }
 
-    _threadId = lastThreadId;
+    const auto& task = *event.task;
+    ted.name = task.name;
+    ted.category = enumToStr.at(task.exec_type);
+    // use ns-resolution integers to avoid round-off errors during fixed precision output to JSON
+    ted.timestamp = task.start_time_ns / 1000.;
+    ted.duration = task.duration_ns / 1000.;
+
+    if (task.active_cycles != 0) {
+        ted.customArgs.push_back({"Active cycles:", std::to_string(task.active_cycles)});
+    }
+    if (task.stall_cycles != 0) {
+        ted.customArgs.push_back({"Stall cycles:", std::to_string(task.stall_cycles)});
+    }
+    return ted;
 }
 
 TraceEventExporter::TraceEventExporter(std::ostream& outStream, Logger& log): _outStream(outStream), _log(log) {
@@ -358,10 +446,10 @@ TraceEventExporter::~TraceEventExporter() noexcept(false) {
 
 void TraceEventExporter::flushAsTraceEvents() {
     if (!_events.empty()) {
-        for (auto tedIt = _events.begin(); tedIt != std::prev(_events.end()); ++tedIt) {
-            _outStream << *tedIt << ",\n";
+        for (auto eventIt = _events.begin(); eventIt != std::prev(_events.end()); ++eventIt) {
+            _outStream << createTraceEvent(*eventIt) << ",\n";
         }
-        _outStream << _events.back() << std::endl;
+        _outStream << createTraceEvent(_events.back()) << std::endl;
         _events.clear();
     }
     // close traceEvents block
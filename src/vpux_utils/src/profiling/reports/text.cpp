@@ -7,62 +7,62 @@
 
 #include "vpux/utils/profiling/taskinfo.hpp"
 
+#include <algorithm>
 #include <iomanip>
 #include <ostream>
 #include <string>
 
-void vpux::profiling::printProfilingAsText(const std::vector<TaskInfo>& tasks, const std::vector<LayerInfo>& layers,
-                                           std::ostream& output) {
-    uint64_t last_time_ns = 0;
-    std::ios::fmtflags origFlags(output.flags());
-    output << std::left << std::setprecision(2) << std::fixed;
-    for (auto& task : tasks) {
-        std::string exec_type_str;
-        std::string taskName(task.name);
-
-        switch (task.exec_type) {
-        case TaskInfo::ExecType::DMA:
-            exec_type_str = "DMA";
-            output << "Task(" << exec_type_str << "): " << std::setw(60) << taskName << "\tTime(us): " << std::setw(8)
-                   << (float)task.duration_ns / 1000 << "\tStart(us): " << std::setw(8)
-                   << (float)task.start_time_ns / 1000 << std::endl;
-            break;
-        case TaskInfo::ExecType::DPU:
-            exec_type_str = "DPU";
-            output << "Task(" << exec_type_str << "): " << std::setw(60) << taskName << "\tTime(us): " << std::setw(8)
-                   << (float)task.duration_ns / 1000 << "\tStart(us): " << std::setw(8)
-                   << (float)task.start_time_ns / 1000 << std::endl;
-            break;
-        case TaskInfo::ExecType::SW:
-            exec_type_str = "SW";
-            output << "Task(" << exec_type_str << "): " << std::setw(60) << taskName << "\tTime(us): " << std::setw(8)
-                   << (float)task.duration_ns / 1000 << "\tCycles:" << task.active_cycles << "(" << task.stall_cycles
-                   << ")"
-                   << "\tStart(us): " << std::setw(8) << (float)task.start_time_ns / 1000 << std::endl;
-            break;
-        case TaskInfo::ExecType::UPA:
-            exec_type_str = "UPA";
-            output << "Task(" << exec_type_str << "): " << std::setw(60) << taskName << "\tTime(us): " << std::setw(8)
-                   << (float)task.duration_ns / 1000 << "\tCycles:" << task.active_cycles << "(" << task.stall_cycles
-                   << ")"
-                   << "\tStart(us): " << std::setw(8) << (float)task.start_time_ns / 1000 << std::endl;
-            break;
-        case TaskInfo::ExecType::M2I:
-            exec_type_str = "M2I";
-            output << "Task(" << exec_type_str << "): " << std::setw(60) << taskName << "\tTime(us): " << std::setw(8)
-                   << (float)task.duration_ns / 1000 << "\tStart(us): " << std::setw(8)
-                   << (float)task.start_time_ns / 1000 << std::endl;
-            break;
-        default:
-            break;
-        }
-
-        uint64_t task_end_time_ns = task.start_time_ns + task.duration_ns;
-        if (last_time_ns < task_end_time_ns) {
-            last_time_ns = task_end_time_ns;
-        }
+namespace vpux::profiling {
+
+namespace {
+
+void printTaskAsText(const TaskInfo& task, std::ostream& output) {
+    std::string exec_type_str;
+    std::string taskName(task.name);
+
+    switch (task.exec_type) {
+    case TaskInfo::ExecType::DMA:
+        exec_type_str = "DMA";
+        output << "Task(" << exec_type_str << "): " << std::setw(60) << taskName << "\tTime(us): " << std::setw(8)
+               << (float)task.duration_ns / 1000 << "\tStart(us): " << std::setw(8)
+               << (float)task.start_time_ns / 1000 << std::endl;
+        break;
+    case TaskInfo::ExecType::DPU:
+        exec_type_str = "DPU";
+        output << "Task(" << exec_type_str << "): " << std::setw(60) << taskName << "\tTime(us): " << std::setw(8)
+               << (float)task.duration_ns / 1000 << "\tStart(us): " << std::setw(8)
+               << (float)task.start_time_ns / 1000 << std::endl;
+        break;
+    case TaskInfo::ExecType::SW:
+        exec_type_str = "SW";
+        output << "Task(" << exec_type_str << "): " << std::setw(60) << taskName << "\tTime(us): " << std::setw(8)
+               << (float)task.duration_ns / 1000 << "\tCycles:" << task.active_cycles << "(" << task.stall_cycles
+               << ")"
+               << "\tStart(us): " << std::setw(8) << (float)task.start_time_ns / 1000 << std::endl;
+        break;
+    case TaskInfo::ExecType::UPA:
+        exec_type_str = "UPA";
+        output << "Task(" << exec_type_str << "): " << std::setw(60) << taskName << "\tTime(us): " << std::setw(8)
+               << (float)task.duration_ns / 1000 << "\tCycles:" << task.active_cycles << "(" << task.stall_cycles
+               << ")"
+               << "\tStart(us): " << std::setw(8) << (float)task.start_time_ns / 1000 << std::endl;
+        break;
+    case TaskInfo::ExecType::M2I:
+        exec_type_str = "M2I";
+        output << "Task(" << exec_type_str << "): " << std::setw(60) << taskName << "\tTime(us): " << std::setw(8)
+               << (float)task.duration_ns / 1000 << "\tStart(us): " << std::setw(8)
+               << (float)task.start_time_ns / 1000 << std::endl;
+        break;
+    default:
+        break;
     }
+}
+
+uint64_t getTaskEndTime(const TaskInfo& task) {
+    return task.start_time_ns + task.duration_ns;
+}
 
+void printLayersAsText(const std::vector<LayerInfo>& layers, uint64_t last_time_ns, std::ostream& output) {
     uint64_t total_time = 0;
     for (auto& layer : layers) {
         output << "Layer: " << std::setw(40) << layer.name << " Type: " << std::setw(20) << layer.layer_type
@@ -74,5 +74,37 @@ void vpux::profiling::printProfilingAsText(const std::vector<TaskInfo>& tasks, c
 
     output << "Total time: " << (float)total_time / 1000 << "us, Real: " << (float)last_time_ns / 1000 << "us"
            << std::endl;
+}
+
+}  // namespace
+
+void printProfilingAsText(const std::vector<TaskInfo>& tasks, const std::vector<LayerInfo>& layers,
+                          std::ostream& output) {
+    uint64_t last_time_ns = 0;
+    std::ios::fmtflags origFlags(output.flags());
+    output << std::left << std::setprecision(2) << std::fixed;
+    for (auto& task : tasks) {
+        printTaskAsText(task, output);
+        last_time_ns = std::max(last_time_ns, getTaskEndTime(task));
+    }
+
+    printLayersAsText(layers, last_time_ns, output);
+    output.flags(origFlags);
+}
+
+void printProfilingAsText(TaskInfoReader& reader, std::ostream& output) {
+    uint64_t last_time_ns = 0;
+    LayerInfoBuilder layers;
+    std::ios::fmtflags origFlags(output.flags());
+    output << std::left << std::setprecision(2) << std::fixed;
+    while (const auto* task = reader.next()) {
+        printTaskAsText(*task, output);
+        last_time_ns = std::max(last_time_ns, getTaskEndTime(*task));
+        layers.addTask(*task);
+    }
+
+    printLayersAsText(layers.getLayerInfo(), last_time_ns, output);
     output.flags(origFlags);
 }
+
+}  // namespace vpux::profiling
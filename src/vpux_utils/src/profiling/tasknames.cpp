@@ -94,4 +94,17 @@ std::string getValueFromStructuredTaskName(const std::string& name, const std::s
     return "";
 }
 
+uint32_t TaskNameTable::intern(std::string_view name) {
+    const auto it = _ids.find(name);
+    if (it != _ids.end()) {
+        return it->second;
+    }
+
+    const auto id = static_cast<uint32_t>(_names.size());
+    const std::string_view storedName = _storage.emplace_back(name);
+    _ids.emplace(storedName, id);
+    _names.push_back(storedName);
+    return id;
+}
+
 }  // namespace vpux::profiling
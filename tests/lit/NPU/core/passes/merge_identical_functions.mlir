@@ -0,0 +1,95 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+// RUN: vpux-opt --split-input-file --init-compiler="vpu-arch=%arch%" --merge-identical-functions %s | FileCheck %s
+// REQUIRES: arch-NPU37XX || arch-NPU40XX
+
+module @IdenticalFunctions {
+
+    IE.CNNNetwork entryPoint : @main
+    inputsInfo : {
+        DataInfo "input" : tensor<1x48x60x60xf32>
+    } outputsInfo : {
+        DataInfo "output" : tensor<1x48x60x60xf32>
+    }
+
+    func.func private @main_part1(%arg0: tensor<1x48x60x60xf32>) -> tensor<1x48x60x60xf32> {
+        %0 = IE.SoftMax(%arg0) {axisInd = 1} : tensor<1x48x60x60xf32> -> tensor<1x48x60x60xf32>
+        %1 = IE.Add(%0, %0) { auto_broadcast = #IE.auto_broadcast_type<NUMPY> } : tensor<1x48x60x60xf32>, tensor<1x48x60x60xf32> -> tensor<1x48x60x60xf32>
+        return %1 : tensor<1x48x60x60xf32>
+    }
+
+    func.func private @main_part2(%arg0: tensor<1x48x60x60xf32>) -> tensor<1x48x60x60xf32> {
+        %0 = IE.SoftMax(%arg0) {axisInd = 1} : tensor<1x48x60x60xf32> -> tensor<1x48x60x60xf32> loc("part2_softmax")
+        %1 = IE.Add(%0, %0) { auto_broadcast = #IE.auto_broadcast_type<NUMPY> } : tensor<1x48x60x60xf32>, tensor<1x48x60x60xf32> -> tensor<1x48x60x60xf32> loc("part2_add")
+        return %1 : tensor<1x48x60x60xf32>
+    }
+
+    func.func @main(%arg0: tensor<1x48x60x60xf32>) -> tensor<1x48x60x60xf32> {
+        %0 = call @main_part1(%arg0) : (tensor<1x48x60x60xf32>) -> tensor<1x48x60x60xf32>
+        %1 = call @main_part2(%0) : (tensor<1x48x60x60xf32>) -> tensor<1x48x60x60xf32>
+        return %1 : tensor<1x48x60x60xf32>
+    }
+}
+
+// CHECK-LABEL: @IdenticalFunctions
+
+// CHECK:     func.func private @main_part1([[ARG0:%.+]]: tensor<1x48x60x60xf32>) -> tensor<1x48x60x60xf32> {
+// CHECK:       [[SOFT:%.+]] = IE.SoftMax([[ARG0]])
+// CHECK:       [[ADD:%.+]] = IE.Add([[SOFT]], [[SOFT]])
+// CHECK:       return [[ADD]]
+// CHECK:     }
+// CHECK-NOT: func.func private @main_part2
+
+// CHECK:     func.func @main([[ARG0:%.+]]: tensor<1x48x60x60xf32>) -> tensor<1x48x60x60xf32> {
+// CHECK:       [[CALL1:%.+]] = call @main_part1([[ARG0]])
+// CHECK:       [[CALL2:%.+]] = call @main_part1([[CALL1]])
+// CHECK:       return [[CALL2]]
+// CHECK:     }
+
+//
+// -----
+//
+
+module @DifferentFunctions {
+
+    IE.CNNNetwork entryPoint : @main
+    inputsInfo : {
+        DataInfo "input" : tensor<1x48x60x60xf32>
+    } outputsInfo : {
+        DataInfo "output" : tensor<1x48x60x60xf32>
+    }
+
+    func.func private @main_part1(%arg0: tensor<1x48x60x60xf32>) -> tensor<1x48x60x60xf32> {
+        %0 = IE.SoftMax(%arg0) {axisInd = 1} : tensor<1x48x60x60xf32> -> tensor<1x48x60x60xf32>
+        return %0 : tensor<1x48x60x60xf32>
+    }
+
+    func.func private @main_part2(%arg0: tensor<1x48x60x60xf32>) -> tensor<1x48x60x60xf32> {
+        %0 = IE.SoftMax(%arg0) {axisInd = 2} : tensor<1x48x60x60xf32> -> tensor<1x48x60x60xf32>
+        return %0 : tensor<1x48x60x60xf32>
+    }
+
+    func.func @main(%arg0: tensor<1x48x60x60xf32>) -> tensor<1x48x60x60xf32> {
+        %0 = call @main_part1(%arg0) : (tensor<1x48x60x60xf32>) -> tensor<1x48x60x60xf32>
+        %1 = call @main_part2(%0) : (tensor<1x48x60x60xf32>) -> tensor<1x48x60x60xf32>
+        return %1 : tensor<1x48x60x60xf32>
+    }
+}
+
+// CHECK-LABEL: @DifferentFunctions
+
+// CHECK:     func.func private @main_part1
+// CHECK:       IE.SoftMax
+// CHECK-SAME:    axisInd = 1
+// CHECK:     func.func private @main_part2
+// CHECK:       IE.SoftMax
+// CHECK-SAME:    axisInd = 2
+
+// CHECK:     func.func @main([[ARG0:%.+]]: tensor<1x48x60x60xf32>) -> tensor<1x48x60x60xf32> {
+// CHECK:       [[CALL1:%.+]] = call @main_part1([[ARG0]])
+// CHECK:       [[CALL2:%.+]] = call @main_part2([[CALL1]])
+// CHECK:       return [[CALL2]]
+// CHECK:     }
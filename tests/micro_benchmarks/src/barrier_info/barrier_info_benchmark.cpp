@@ -0,0 +1,225 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+/*
+ * This benchmark tracks how the BarrierInfo based barrier passes scale with the number of tasks.
+ * It works on synthetic schedules, so no IR is needed: tasks are grouped into layers and each layer is linked to the
+ * next one with a barrier. Some barriers skip a layer, which gives optimizeBarriers redundant dependencies to remove.
+ * As in the real compilation flow, the control graph is split into blocks with a sync task at the end of each block.
+ *
+ * Usage: npu_barrier_info_benchmark [num_tasks...]
+ */
+
+#include "vpux/compiler/core/barrier_info.hpp"
+
+#include <llvm/ADT/SetOperations.h>
+#include <llvm/ADT/SmallSet.h>
+#include <llvm/Support/Format.h>
+#include <llvm/Support/raw_ostream.h>
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <string>
+
+using namespace vpux;
+
+namespace {
+
+constexpr size_t LAYER_WIDTH = 4;
+constexpr size_t CONTROL_GRAPH_BLOCK_SIZE = 5000;
+constexpr size_t NUM_INSERTED_BARRIERS = 64;
+constexpr size_t NUM_SET_OPERATIONS = 10000;
+
+template <typename Func>
+double measureMs(Func&& func) {
+    const auto start = std::chrono::steady_clock::now();
+    func();
+    const auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(stop - start).count();
+}
+
+void report(StringRef name, size_t numTasks, double timeMs) {
+    llvm::outs() << llvm::format("%-40s %10zu tasks %12.3f ms\n", name.str().c_str(), numTasks, timeMs);
+}
+
+BarrierInfoTest::BarrierMaps createSchedule(size_t numTasks, size_t numSpareBarriers) {
+    BarrierInfoTest::BarrierMaps maps;
+    maps.Ntasks = numTasks;
+    maps.taskUpdateBarriers.resize(numTasks);
+    maps.taskWaitBarriers.resize(numTasks);
+    maps.controlGraphBlockSize = numTasks > CONTROL_GRAPH_BLOCK_SIZE ? CONTROL_GRAPH_BLOCK_SIZE : 0;
+
+    const auto isSyncTask = [&](size_t taskInd) {
+        return maps.controlGraphBlockSize != 0 && (taskInd + 1) % maps.controlGraphBlockSize == 0 &&
+               taskInd != numTasks - 1;
+    };
+
+    // Sync tasks are kept in their own layer
+    SmallVector<std::pair<size_t, size_t>> layers;
+    for (size_t taskInd = 0; taskInd < numTasks;) {
+        auto layerEnd = taskInd;
+        while (layerEnd < numTasks && layerEnd - taskInd < LAYER_WIDTH && !isSyncTask(layerEnd)) {
+            ++layerEnd;
+        }
+        if (layerEnd == taskInd) {
+            maps.syncTasksIds.push_back(taskInd);
+            ++layerEnd;
+        }
+        layers.push_back({taskInd, layerEnd});
+        taskInd = layerEnd;
+    }
+
+    const auto isSyncLayer = [&](size_t layerInd) {
+        return isSyncTask(layers[layerInd].first);
+    };
+
+    const auto addBarrier = [&](size_t producerLayer, size_t consumerLayer) {
+        const auto barrierInd = maps.barrierProducerMap.size();
+        maps.barrierProducerMap.emplace_back();
+        maps.barrierConsumerMap.emplace_back();
+        for (auto taskInd = layers[producerLayer].first; taskInd < layers[producerLayer].second; ++taskInd) {
+            maps.barrierProducerMap.back().push_back(taskInd);
+            maps.taskUpdateBarriers[taskInd].push_back(barrierInd);
+        }
+        for (auto taskInd = layers[consumerLayer].first; taskInd < layers[consumerLayer].second; ++taskInd) {
+            maps.barrierConsumerMap.back().push_back(taskInd);
+            maps.taskWaitBarriers[taskInd].push_back(barrierInd);
+        }
+    };
+
+    for (size_t layerInd = 0; layerInd + 1 < layers.size(); ++layerInd) {
+        addBarrier(layerInd, layerInd + 1);
+        // Redundant dependency, already implied by the two barriers above, which must not cross a sync task
+        if (layerInd % 3 == 0 && layerInd + 2 < layers.size() && !isSyncLayer(layerInd) &&
+            !isSyncLayer(layerInd + 1)) {
+            addBarrier(layerInd, layerInd + 2);
+        }
+    }
+
+    // Barriers without users, to be linked by the benchmark itself
+    maps.barrierProducerMap.resize(maps.barrierProducerMap.size() + numSpareBarriers);
+    maps.barrierConsumerMap.resize(maps.barrierConsumerMap.size() + numSpareBarriers);
+    maps.Nbarriers = maps.barrierProducerMap.size();
+    return maps;
+}
+
+void benchmarkOptimizeBarriers(size_t numTasks) {
+    auto maps = createSchedule(numTasks, 0);
+    BarrierInfoTest barrierInfo(maps);
+    barrierInfo.setMaxVariantCountPerBarrier(64);
+
+    report("optimizeBarriers", numTasks, measureMs([&] {
+               barrierInfo.optimizeBarriers();
+           }));
+}
+
+// Simulates barrier insertion interleaved with control path queries, as done when linearizing tasks
+void benchmarkControlMap(size_t numTasks) {
+    auto maps = createSchedule(numTasks, NUM_INSERTED_BARRIERS);
+    const auto firstSpareBarrier = maps.Nbarriers - NUM_INSERTED_BARRIERS;
+    const auto blockSize = maps.syncTasksIds.empty() ? numTasks : maps.syncTasksIds.front() + 1;
+
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<size_t> dist(0, blockSize - 3);
+    SmallVector<std::pair<size_t, size_t>> newDependencies;
+    for (size_t ind = 0; ind < NUM_INSERTED_BARRIERS; ++ind) {
+        const auto producer = dist(gen);
+        const auto consumer = std::uniform_int_distribution<size_t>(producer + 1, blockSize - 2)(gen);
+        newDependencies.push_back({producer, consumer});
+    }
+    const auto fifoDependency = false;
+
+    size_t numPathsRebuilt = 0;
+    BarrierInfoTest rebuildBarrierInfo(maps);
+    report("buildTaskControlMap after each barrier", numTasks, measureMs([&] {
+               for (size_t barrierOffset = 0; barrierOffset < newDependencies.size(); ++barrierOffset) {
+                   const auto& dependency = newDependencies[barrierOffset];
+                   auto [taskControlMap, offset] = rebuildBarrierInfo.buildTaskControlMap(0, fifoDependency);
+                   numPathsRebuilt += rebuildBarrierInfo.controlPathExistsBetweenTasksInSameBlock(
+                           taskControlMap, dependency.first - offset, dependency.second - offset);
+                   rebuildBarrierInfo.addProducer(firstSpareBarrier + barrierOffset, dependency.first);
+                   rebuildBarrierInfo.addConsumer(firstSpareBarrier + barrierOffset, dependency.second);
+               }
+           }));
+
+    size_t numPathsCached = 0;
+    BarrierInfoTest cachedBarrierInfo(maps);
+    report("getTaskControlMap (incremental)", numTasks, measureMs([&] {
+               for (size_t barrierOffset = 0; barrierOffset < newDependencies.size(); ++barrierOffset) {
+                   const auto& dependency = newDependencies[barrierOffset];
+                   auto [taskControlMap, offset] = cachedBarrierInfo.getTaskControlMap(0, fifoDependency);
+                   numPathsCached += cachedBarrierInfo.controlPathExistsBetweenTasksInSameBlock(
+                           taskControlMap, dependency.first - offset, dependency.second - offset);
+                   cachedBarrierInfo.addProducer(firstSpareBarrier + barrierOffset, dependency.first);
+                   cachedBarrierInfo.addConsumer(firstSpareBarrier + barrierOffset, dependency.second);
+               }
+           }));
+
+    if (numPathsRebuilt != numPathsCached) {
+        llvm::errs() << "Control path mismatch: " << numPathsRebuilt << " vs " << numPathsCached << "\n";
+    }
+}
+
+template <typename SetT, typename UnionFunc>
+double measureUnions(ArrayRef<SetT> sets, UnionFunc&& unionFunc) {
+    size_t checksum = 0;
+    const auto timeMs = measureMs([&] {
+        for (size_t ind = 0; ind < NUM_SET_OPERATIONS; ++ind) {
+            auto result = sets[ind % sets.size()];
+            unionFunc(result, sets[(ind + 1) % sets.size()]);
+            checksum += result.size();
+        }
+    });
+    if (checksum == 0) {
+        llvm::errs() << "Unexpected empty unions\n";
+    }
+    return timeMs;
+}
+
+// Wide barriers, e.g. around sync tasks, have many producers or consumers with close indexes
+void benchmarkTaskSetUnion(size_t numTasks) {
+    constexpr size_t NUM_SETS = 16;
+    const auto setSize = std::min<size_t>(numTasks / 8, 1024);
+
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<size_t> dist(0, 4 * setSize);
+    SmallVector<TaskSet> taskSets(NUM_SETS);
+    SmallVector<llvm::SmallSet<size_t, 16>> smallSets(NUM_SETS);
+    for (size_t setInd = 0; setInd < NUM_SETS; ++setInd) {
+        for (size_t ind = 0; ind < setSize; ++ind) {
+            const auto value = dist(gen);
+            taskSets[setInd].insert(value);
+            smallSets[setInd].insert(value);
+        }
+    }
+
+    report("llvm::SmallSet union", numTasks,
+           measureUnions<llvm::SmallSet<size_t, 16>>(smallSets, [](auto& lhs, const auto& rhs) {
+               llvm::set_union(lhs, rhs);
+           }));
+    report("TaskSet::setUnion", numTasks, measureUnions<TaskSet>(taskSets, [](auto& lhs, const auto& rhs) {
+               lhs.setUnion(rhs);
+           }));
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    SmallVector<size_t> taskCounts = {1000, 10000, 100000};
+    if (argc > 1) {
+        taskCounts.clear();
+        for (int argInd = 1; argInd < argc; ++argInd) {
+            taskCounts.push_back(std::stoul(argv[argInd]));
+        }
+    }
+
+    for (auto numTasks : taskCounts) {
+        benchmarkOptimizeBarriers(numTasks);
+        benchmarkControlMap(numTasks);
+        benchmarkTaskSetUnion(numTasks);
+    }
+    return 0;
+}
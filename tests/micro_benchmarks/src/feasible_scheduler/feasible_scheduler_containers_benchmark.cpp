@@ -0,0 +1,398 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+/*
+ * This benchmark tracks the cost of the containers used by the scheduling loop of FeasibleMemoryScheduler: the ready
+ * lists, the per queue compute op order and the executor pipelines. The cycle begin/end heaps stay std::set in both
+ * runs, see E106645 in the scheduler.
+ * It replays a schedule without any IR: operations are described by their queue, cycle cost and dependencies, and
+ * the loop below performs the same container operations as the scheduler (move from cycle begin to cycle end heap,
+ * unschedule completing ops, schedule ready compute ops in IR order per queue and ready DMAs in index order).
+ * The loop is run once with the node based std::set/std::map containers and once with the flat containers used by
+ * the scheduler, and both runs must produce the same schedule.
+ *
+ * Inputs are either generated, for the given operation counts, or read from a file with one operation per line:
+ *     <queue kind> <queue id> <cycle cost> [<dependency index>...]
+ * where queue kind 0 stands for DMA and any other value for a compute executor, and dependencies refer to
+ * previous lines (0-based).
+ *
+ * Usage: npu_feasible_scheduler_containers_benchmark [num_ops... | -f <input file>]
+ */
+
+#include "vpux/compiler/core/task_set.hpp"
+
+#include "vpux/utils/core/flat_map.hpp"
+#include "vpux/utils/core/small_vector.hpp"
+
+#include <llvm/ADT/STLExtras.h>
+#include <llvm/Support/Format.h>
+#include <llvm/Support/raw_ostream.h>
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <random>
+#include <set>
+#include <sstream>
+#include <string>
+
+using namespace vpux;
+
+namespace {
+
+constexpr size_t LAYER_WIDTH = 8;
+constexpr size_t NUM_DMA_QUEUES = 2;
+constexpr size_t NUM_COMPUTE_QUEUES = 3;
+constexpr size_t NUM_REPETITIONS = 5;
+
+struct QueueType {
+    size_t kind = 0;
+    size_t id = 0;
+
+    bool isCompute() const {
+        return kind != 0;
+    }
+    bool operator<(const QueueType& other) const {
+        return kind != other.kind ? kind < other.kind : id < other.id;
+    }
+    bool operator==(const QueueType& other) const {
+        return kind == other.kind && id == other.id;
+    }
+};
+
+struct ScheduleInput {
+    SmallVector<QueueType> queues;
+    SmallVector<size_t> costs;
+    SmallVector<SmallVector<size_t>> deps;
+};
+
+struct HeapElement {
+    size_t op;
+    QueueType queue;
+    size_t cycleBegin;
+    size_t cycleEnd;
+};
+
+struct CycleBeginOrdering {
+    bool operator()(const HeapElement& a, const HeapElement& b) const {
+        return a.cycleBegin != b.cycleBegin ? a.cycleBegin < b.cycleBegin : a.op < b.op;
+    }
+};
+
+struct CycleEndOrdering {
+    bool operator()(const HeapElement& a, const HeapElement& b) const {
+        return a.cycleEnd != b.cycleEnd ? a.cycleEnd < b.cycleEnd : a.op < b.op;
+    }
+};
+
+//
+// Container flavours
+//
+
+struct StdContainers {
+    template <typename Compare>
+    using Heap = std::set<HeapElement, Compare>;
+    using ReadyList = std::set<size_t>;
+    template <typename Value>
+    using QueueMap = std::map<QueueType, Value>;
+
+    template <typename Compare>
+    static void push(Heap<Compare>& heap, const HeapElement& elem) {
+        heap.insert(elem);
+    }
+    template <typename Compare>
+    static const HeapElement& top(const Heap<Compare>& heap) {
+        return *heap.begin();
+    }
+    template <typename Compare>
+    static HeapElement popTop(Heap<Compare>& heap) {
+        auto elem = *heap.begin();
+        heap.erase(heap.begin());
+        return elem;
+    }
+    static bool contains(const ReadyList& list, size_t op) {
+        return list.find(op) != list.end();
+    }
+};
+
+struct FlatContainers : StdContainers {
+    using ReadyList = TaskSet;
+    template <typename Value>
+    using QueueMap = FlatMap<QueueType, Value>;
+
+    static bool contains(const ReadyList& list, size_t op) {
+        return list.contains(op);
+    }
+};
+
+//
+// Scheduling loop replay
+//
+
+template <class Containers>
+class ScheduleReplay final {
+public:
+    explicit ScheduleReplay(const ScheduleInput& input): _input(input) {
+    }
+
+    // Returns the order in which operations were moved to the cycle end heap
+    SmallVector<size_t> run() {
+        const auto numOps = _input.costs.size();
+        _inDegree.assign(numOps, 0);
+        _consumers.assign(numOps, {});
+        _endCycles.assign(numOps, 0);
+        for (size_t op = 0; op < numOps; ++op) {
+            _inDegree[op] = _input.deps[op].size();
+            for (auto dep : _input.deps[op]) {
+                _consumers[dep].push_back(op);
+            }
+            if (_input.queues[op].isCompute()) {
+                _computeOpOrder[_input.queues[op]].push_back(op);
+            }
+            _executorPipelines[_input.queues[op]] = 1;
+        }
+        for (size_t op = 0; op < numOps; ++op) {
+            if (_inDegree[op] == 0) {
+                makeReady(op);
+            }
+        }
+
+        SmallVector<size_t> order;
+        while (order.size() < numOps) {
+            if (!_cycleBeginHeap.empty()) {
+                while (!_cycleBeginHeap.empty()) {
+                    auto elem = Containers::popTop(_cycleBeginHeap);
+                    order.push_back(elem.op);
+                    Containers::push(_cycleEndHeap, elem);
+                }
+                continue;
+            }
+
+            unscheduleCompletingOps();
+            scheduleReadyOps();
+            if (_cycleBeginHeap.empty() && _cycleEndHeap.empty()) {
+                llvm::errs() << "Replay failed, no operation can be scheduled\n";
+                break;
+            }
+        }
+        return order;
+    }
+
+private:
+    void makeReady(size_t op) {
+        if (_input.queues[op].isCompute()) {
+            _readyComputeOps.insert(op);
+        } else {
+            _readyDMAOps.insert(op);
+        }
+    }
+
+    void unscheduleCompletingOps() {
+        auto minQueueCycle = std::numeric_limits<size_t>::max();
+        for (const auto& elem : _cycleEndHeap) {
+            minQueueCycle = std::min(minQueueCycle, _executorPipelines[elem.queue]);
+        }
+
+        while (!_cycleEndHeap.empty() && Containers::top(_cycleEndHeap).cycleEnd <= minQueueCycle) {
+            const auto elem = Containers::popTop(_cycleEndHeap);
+            for (auto consumer : _consumers[elem.op]) {
+                if (--_inDegree[consumer] == 0) {
+                    makeReady(consumer);
+                }
+            }
+        }
+    }
+
+    bool queueBusy(const QueueType& queue) const {
+        for (const auto& elem : _cycleEndHeap) {
+            if (elem.queue == queue) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void scheduleOp(size_t op) {
+        const auto& queue = _input.queues[op];
+        auto cycleBegin = _executorPipelines[queue];
+        for (auto dep : _input.deps[op]) {
+            cycleBegin = std::max(cycleBegin, _endCycles[dep]);
+        }
+        const auto cycleEnd = cycleBegin + _input.costs[op];
+        _executorPipelines[queue] = cycleEnd;
+        _endCycles[op] = cycleEnd;
+        Containers::push(_cycleBeginHeap, HeapElement{op, queue, cycleBegin, cycleEnd});
+    }
+
+    void scheduleReadyOps() {
+        for (auto& queue : _computeOpOrder) {
+            auto& nextOpInd = _nextComputeOpInd[queue.first];
+            if (nextOpInd >= queue.second.size()) {
+                continue;
+            }
+            const auto op = queue.second[nextOpInd];
+            if (!Containers::contains(_readyComputeOps, op) || queueBusy(queue.first)) {
+                continue;
+            }
+            scheduleOp(op);
+            _readyComputeOps.erase(op);
+            ++nextOpInd;
+        }
+
+        SmallVector<size_t> dmaOps(_readyDMAOps.begin(), _readyDMAOps.end());
+        for (auto op : dmaOps) {
+            scheduleOp(op);
+            _readyDMAOps.erase(op);
+        }
+    }
+
+private:
+    const ScheduleInput& _input;
+    SmallVector<size_t> _inDegree;
+    SmallVector<SmallVector<size_t>> _consumers;
+    SmallVector<size_t> _endCycles;
+
+    typename Containers::template Heap<CycleBeginOrdering> _cycleBeginHeap;
+    typename Containers::template Heap<CycleEndOrdering> _cycleEndHeap;
+    typename Containers::ReadyList _readyComputeOps;
+    typename Containers::ReadyList _readyDMAOps;
+    typename Containers::template QueueMap<SmallVector<size_t>> _computeOpOrder;
+    typename Containers::template QueueMap<size_t> _nextComputeOpInd;
+    typename Containers::template QueueMap<size_t> _executorPipelines;
+};
+
+//
+// Inputs
+//
+
+// Layers of operations alternating between DMA and compute queues, each operation depends on a few operations of the
+// previous layer, similar to weights prefetching followed by compute
+ScheduleInput generateInput(size_t numOps) {
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<size_t> costDist(1, 1000);
+    std::uniform_int_distribution<size_t> depDist(0, LAYER_WIDTH - 1);
+
+    ScheduleInput input;
+    for (size_t op = 0; op < numOps; ++op) {
+        const auto layer = op / LAYER_WIDTH;
+        QueueType queue;
+        if (layer % 2 == 0) {
+            queue.id = op % NUM_DMA_QUEUES;
+        } else {
+            queue.kind = 1 + op % NUM_COMPUTE_QUEUES;
+        }
+        input.queues.push_back(queue);
+        input.costs.push_back(costDist(gen));
+
+        SmallVector<size_t> deps;
+        if (layer > 0) {
+            const auto prevLayerBegin = (layer - 1) * LAYER_WIDTH;
+            for (size_t depInd = 0; depInd < 2; ++depInd) {
+                const auto dep = prevLayerBegin + depDist(gen);
+                if (llvm::find(deps, dep) == deps.end()) {
+                    deps.push_back(dep);
+                }
+            }
+        }
+        input.deps.push_back(std::move(deps));
+    }
+    return input;
+}
+
+bool readInput(const std::string& fileName, ScheduleInput& input) {
+    std::ifstream file(fileName);
+    if (!file) {
+        llvm::errs() << "Failed to open '" << fileName << "'\n";
+        return false;
+    }
+
+    std::string line;
+    while (std::getline(file, line)) {
+        std::istringstream stream(line);
+        QueueType queue;
+        size_t cost = 0;
+        if (!(stream >> queue.kind >> queue.id >> cost)) {
+            continue;
+        }
+
+        SmallVector<size_t> deps;
+        for (size_t dep = 0; stream >> dep;) {
+            if (dep >= input.costs.size()) {
+                llvm::errs() << "Invalid dependency " << dep << " of operation " << input.costs.size() << "\n";
+                return false;
+            }
+            deps.push_back(dep);
+        }
+
+        input.queues.push_back(queue);
+        input.costs.push_back(cost);
+        input.deps.push_back(std::move(deps));
+    }
+    return true;
+}
+
+//
+// Measurements
+//
+
+template <class Containers>
+double measureReplay(const ScheduleInput& input, SmallVector<size_t>& order) {
+    auto bestMs = std::numeric_limits<double>::max();
+    for (size_t rep = 0; rep < NUM_REPETITIONS; ++rep) {
+        ScheduleReplay<Containers> replay(input);
+        const auto start = std::chrono::steady_clock::now();
+        order = replay.run();
+        const auto stop = std::chrono::steady_clock::now();
+        bestMs = std::min(bestMs, std::chrono::duration<double, std::milli>(stop - start).count());
+    }
+    return bestMs;
+}
+
+void report(const char* name, size_t numOps, double timeMs) {
+    llvm::outs() << llvm::format("%-40s %10zu ops %12.3f ms\n", name, numOps, timeMs);
+}
+
+bool benchmarkReplay(const ScheduleInput& input) {
+    const auto numOps = input.costs.size();
+
+    SmallVector<size_t> stdOrder;
+    report("std::set/std::map containers", numOps, measureReplay<StdContainers>(input, stdOrder));
+    SmallVector<size_t> flatOrder;
+    report("flat containers", numOps, measureReplay<FlatContainers>(input, flatOrder));
+
+    if (stdOrder != flatOrder) {
+        llvm::errs() << "Schedule mismatch between container flavours\n";
+        return false;
+    }
+    return true;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    if (argc == 3 && std::string(argv[1]) == "-f") {
+        ScheduleInput input;
+        if (!readInput(argv[2], input)) {
+            return 1;
+        }
+        return benchmarkReplay(input) ? 0 : 1;
+    }
+
+    SmallVector<size_t> opCounts = {1000, 10000, 100000};
+    if (argc > 1) {
+        opCounts.clear();
+        for (int argInd = 1; argInd < argc; ++argInd) {
+            opCounts.push_back(std::stoul(argv[argInd]));
+        }
+    }
+
+    bool success = true;
+    for (auto numOps : opCounts) {
+        success &= benchmarkReplay(generateInput(numOps));
+    }
+    return success ? 0 : 1;
+}
@@ -0,0 +1,99 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "vpux/compiler/act_kernels/shave_binary_bundle.h"
+
+#include <numeric>
+
+using namespace vpux;
+
+namespace {
+
+std::vector<ShaveBinary> createBinaries() {
+    std::vector<uint8_t> compressible(4096);
+    std::iota(compressible.begin(), compressible.end(), 0);
+    // Too small to get any gain from the compression
+    const std::vector<uint8_t> tiny = {0x7f, 'E', 'L', 'F'};
+    return {{"sk_softmax_3720xx_text", compressible}, {"softmax_3720xx_elf", tiny}, {"mvn_4000_elf", compressible}};
+}
+
+std::vector<uint8_t> packBinaries(std::optional<llvm::compression::Format> format) {
+    auto bundle = packShaveBinaryBundle(createBinaries(), format);
+    if (!bundle) {
+        ADD_FAILURE() << llvm::toString(bundle.takeError());
+        return {};
+    }
+    return std::move(*bundle);
+}
+
+void checkBundle(const ShaveBinaryBundle& bundle) {
+    const auto binaries = createBinaries();
+    ASSERT_EQ(bundle.size(), binaries.size());
+    for (const auto& binary : binaries) {
+        const auto data = bundle.find(binary.name);
+        ASSERT_TRUE(data.has_value()) << binary.name;
+        EXPECT_EQ(data->vec(), binary.data) << binary.name;
+        // The decompressed entries are cached
+        EXPECT_EQ(bundle.find(binary.name)->data(), data->data()) << binary.name;
+    }
+    EXPECT_FALSE(bundle.find("sk_softmax_3720xx_data").has_value());
+    EXPECT_FALSE(bundle.find("").has_value());
+    EXPECT_FALSE(bundle.find("zzz").has_value());
+}
+
+}  // namespace
+
+TEST(MLIR_ShaveBinaryBundle, BinaryName) {
+    EXPECT_EQ(getShaveBinaryName("sk.single_shave_softmax.3720xx.text"), "sk_single_shave_softmax_3720xx_text");
+    EXPECT_EQ(getShaveBinaryName("mvn-4000 elf"), "mvn_4000_elf");
+}
+
+TEST(MLIR_ShaveBinaryBundle, Uncompressed) {
+    const auto data = packBinaries(std::nullopt);
+    const ShaveBinaryBundle bundle(data, "test");
+    checkBundle(bundle);
+
+    // The entries are sorted by name and the stored ones are not copied
+    EXPECT_EQ(bundle.getName(0), "mvn_4000_elf");
+    const auto binary = bundle.find("softmax_3720xx_elf");
+    ASSERT_TRUE(binary.has_value());
+    EXPECT_GE(binary->data(), data.data());
+    EXPECT_LT(binary->data(), data.data() + data.size());
+}
+
+TEST(MLIR_ShaveBinaryBundle, Compressed) {
+    for (const auto format : {llvm::compression::Format::Zlib, llvm::compression::Format::Zstd}) {
+        if (llvm::compression::getReasonIfUnsupported(format) != nullptr) {
+            continue;
+        }
+
+        const auto data = packBinaries(format);
+        EXPECT_LT(data.size(), packBinaries(std::nullopt).size());
+        checkBundle(ShaveBinaryBundle(data, "test"));
+    }
+}
+
+TEST(MLIR_ShaveBinaryBundle, DuplicateNames) {
+    auto binaries = createBinaries();
+    binaries.push_back(binaries.front());
+    auto bundle = packShaveBinaryBundle(std::move(binaries), std::nullopt);
+    ASSERT_FALSE(static_cast<bool>(bundle));
+    llvm::consumeError(bundle.takeError());
+}
+
+TEST(MLIR_ShaveBinaryBundle, Corrupted) {
+    const auto data = packBinaries(std::nullopt);
+
+    auto badMagic = data;
+    badMagic[0] = 'X';
+    EXPECT_ANY_THROW(ShaveBinaryBundle(badMagic, "test"));
+
+    const auto truncated = llvm::ArrayRef<uint8_t>(data).drop_back(8);
+    EXPECT_ANY_THROW(ShaveBinaryBundle(truncated, "test"));
+
+    EXPECT_ANY_THROW(ShaveBinaryBundle::load("nonexistent.bundle"));
+}
@@ -814,3 +814,126 @@ TEST_F(BarrierInfoTests, optimizeParallelBlocksWithTooFewVariantsPerBarrier) {
     optimizedResult = barrierInfoTest.optimizeBarriers(/* checkValidSlotCount */ false);
     checkBarrierMaps(expectedResult, optimizedResult);
 }
+
+/**
+ * Test BarrierInfo::getTaskControlMap
+ *
+ *    0      2                0      2
+ *    |      |                |      |
+ *   b0     b1               b0     b1
+ *    |      |                |      |
+ *    1      3       =>       1--b3--3
+ *           |                       |
+ *          b2                      b2
+ *           |                       |
+ *           4                       4
+ *
+ * Barrier b3 is linked after the control map is built. The cached map must be updated to match a map built from
+ * scratch, and modifications which remove dependencies must drop it.
+ */
+TEST_F(BarrierInfoTests, incrementalTaskControlMap) {
+    BarrierInfoTest::BarrierMaps barrierConfig;
+    barrierConfig.taskWaitBarriers = {
+            {},   // task 0
+            {0},  // task 1
+            {},   // task 2
+            {1},  // task 3
+            {2},  // task 4
+    };
+    barrierConfig.taskUpdateBarriers = {
+            {0},  // task 0
+            {},   // task 1
+            {1},  // task 2
+            {2},  // task 3
+            {},   // task 4
+    };
+    barrierConfig.Ntasks = 5;
+    barrierConfig.Nbarriers = 4;
+    fillProducersAndConsumers(barrierConfig);
+    barrierConfig.barrierProducerMap.resize(barrierConfig.Nbarriers);
+    barrierConfig.barrierConsumerMap.resize(barrierConfig.Nbarriers);
+
+    BarrierInfoTest barrierInfoTest(barrierConfig);
+    const auto fifoDependency = false;
+
+    auto [taskControlMap, offset] = barrierInfoTest.getTaskControlMap(/* blockIdx */ 0, fifoDependency);
+    ASSERT_EQ(offset, 0u);
+    EXPECT_FALSE(barrierInfoTest.controlPathExistsBetweenTasksInSameBlock(taskControlMap, 0, 3));
+    EXPECT_TRUE(barrierInfoTest.controlPathExistsBetweenTasksInSameBlock(taskControlMap, 2, 4));
+
+    barrierInfoTest.addProducer(/* barrierInd */ 3, /* taskInd */ 1);
+    barrierInfoTest.addConsumer(/* barrierInd */ 3, /* taskInd */ 3);
+
+    std::tie(taskControlMap, offset) = barrierInfoTest.getTaskControlMap(/* blockIdx */ 0, fifoDependency);
+    EXPECT_TRUE(barrierInfoTest.controlPathExistsBetweenTasksInSameBlock(taskControlMap, 0, 3, false));
+    EXPECT_TRUE(barrierInfoTest.controlPathExistsBetweenTasksInSameBlock(taskControlMap, 0, 4, false));
+    EXPECT_FALSE(barrierInfoTest.controlPathExistsBetweenTasksInSameBlock(taskControlMap, 4, 0, false));
+    EXPECT_TRUE(llvm::equal(taskControlMap, barrierInfoTest.buildTaskControlMap(0, fifoDependency).first));
+
+    barrierInfoTest.removeConsumer(/* barrierInd */ 3, /* taskInd */ 3);
+
+    std::tie(taskControlMap, offset) = barrierInfoTest.getTaskControlMap(/* blockIdx */ 0, fifoDependency);
+    EXPECT_FALSE(barrierInfoTest.controlPathExistsBetweenTasksInSameBlock(taskControlMap, 0, 3));
+    EXPECT_TRUE(llvm::equal(taskControlMap, barrierInfoTest.buildTaskControlMap(0, fifoDependency).first));
+}
+
+/**
+ * Test BarrierInfo::getTaskControlMap with FIFO dependencies
+ *
+ *    0                       0
+ *    |                       |
+ *   b0                      b0
+ *    |                       |
+ *    1 -FIFO- 2              1 -FIFO- 2
+ *             |                       |\
+ *            b1        =>            b1 b3
+ *             |                       |  |
+ *             3                       3  |
+ *             |                       |  |
+ *            b2                      b2  |
+ *             |                       | /
+ *             4                       4
+ *
+ * Tasks 1 and 2 are on the same FIFO. Task 1 controls task 2, but the dependency is not propagated to the successors
+ * of task 2. The cached map must keep these semantics when barrier b3 is linked after it is built.
+ */
+TEST_F(BarrierInfoTests, incrementalTaskControlMapWithFifoDependency) {
+    BarrierInfoTest::BarrierMaps barrierConfig;
+    barrierConfig.taskWaitBarriers = {
+            {},   // task 0
+            {0},  // task 1
+            {},   // task 2
+            {1},  // task 3
+            {2},  // task 4
+    };
+    barrierConfig.taskUpdateBarriers = {
+            {0},  // task 0
+            {},   // task 1
+            {1},  // task 2
+            {2},  // task 3
+            {},   // task 4
+    };
+    barrierConfig.Ntasks = 5;
+    barrierConfig.Nbarriers = 4;
+    barrierConfig.taskQueues = {{1, 2}};
+    fillProducersAndConsumers(barrierConfig);
+    barrierConfig.barrierProducerMap.resize(barrierConfig.Nbarriers);
+    barrierConfig.barrierConsumerMap.resize(barrierConfig.Nbarriers);
+
+    BarrierInfoTest barrierInfoTest(barrierConfig);
+    const auto fifoDependency = true;
+
+    auto [taskControlMap, offset] = barrierInfoTest.getTaskControlMap(/* blockIdx */ 0, fifoDependency);
+    ASSERT_EQ(offset, 0u);
+    EXPECT_TRUE(barrierInfoTest.controlPathExistsBetweenTasksInSameBlock(taskControlMap, 1, 2, false));
+    EXPECT_TRUE(barrierInfoTest.controlPathExistsBetweenTasksInSameBlock(taskControlMap, 0, 2, false));
+    EXPECT_FALSE(barrierInfoTest.controlPathExistsBetweenTasksInSameBlock(taskControlMap, 1, 3, false));
+
+    barrierInfoTest.addProducer(/* barrierInd */ 3, /* taskInd */ 2);
+    barrierInfoTest.addConsumer(/* barrierInd */ 3, /* taskInd */ 4);
+
+    std::tie(taskControlMap, offset) = barrierInfoTest.getTaskControlMap(/* blockIdx */ 0, fifoDependency);
+    EXPECT_TRUE(barrierInfoTest.controlPathExistsBetweenTasksInSameBlock(taskControlMap, 2, 4, false));
+    EXPECT_FALSE(barrierInfoTest.controlPathExistsBetweenTasksInSameBlock(taskControlMap, 1, 4, false));
+    EXPECT_TRUE(llvm::equal(taskControlMap, barrierInfoTest.buildTaskControlMap(0, fifoDependency).first));
+}
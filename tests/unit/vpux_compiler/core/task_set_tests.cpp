@@ -0,0 +1,96 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/compiler/core/task_set.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <set>
+
+using namespace vpux;
+
+namespace {
+
+std::set<size_t> toStdSet(const TaskSet& taskSet) {
+    return std::set<size_t>(taskSet.begin(), taskSet.end());
+}
+
+TaskSet generateTaskSet(std::mt19937& gen, size_t numElems, size_t maxValue) {
+    std::uniform_int_distribution<size_t> dist(0, maxValue);
+    TaskSet taskSet;
+    for (size_t ind = 0; ind < numElems; ++ind) {
+        taskSet.insert(dist(gen));
+    }
+    return taskSet;
+}
+
+}  // namespace
+
+TEST(TaskSetTests, InsertEraseAcrossRepresentations) {
+    TaskSet taskSet{7, 3, 5};
+    EXPECT_TRUE(taskSet.isSmall());
+    EXPECT_EQ(toStdSet(taskSet), std::set<size_t>({3, 5, 7}));
+    EXPECT_FALSE(taskSet.insert(5).second);
+
+    std::set<size_t> reference(taskSet.begin(), taskSet.end());
+    for (size_t value = 0; value < 1000; value += 10) {
+        EXPECT_EQ(taskSet.insert(value).second, reference.insert(value).second);
+    }
+    EXPECT_FALSE(taskSet.isSmall());
+    EXPECT_EQ(taskSet.size(), reference.size());
+    EXPECT_EQ(toStdSet(taskSet), reference);
+    EXPECT_EQ(taskSet.front(), *reference.begin());
+    EXPECT_EQ(taskSet.back(), *reference.rbegin());
+    EXPECT_TRUE(taskSet.contains(990));
+    EXPECT_FALSE(taskSet.contains(991));
+
+    for (size_t value = 0; value < 1000; ++value) {
+        EXPECT_EQ(taskSet.erase(value), reference.erase(value) == 1);
+    }
+    EXPECT_TRUE(taskSet.isSmall());
+    EXPECT_EQ(toStdSet(taskSet), reference);
+    EXPECT_EQ(taskSet, TaskSet(reference.begin(), reference.end()));
+}
+
+TEST(TaskSetTests, BulkOperations) {
+    std::mt19937 gen(42);
+    for (size_t iter = 0; iter < 200; ++iter) {
+        const size_t maxValue = iter % 2 == 0 ? 64 : 4096;
+        const auto lhs = generateTaskSet(gen, iter % 40, maxValue);
+        const auto rhs = generateTaskSet(gen, (iter / 2) % 40, maxValue);
+        const auto lhsRef = toStdSet(lhs);
+        const auto rhsRef = toStdSet(rhs);
+
+        std::set<size_t> unionRef;
+        std::set_union(lhsRef.begin(), lhsRef.end(), rhsRef.begin(), rhsRef.end(),
+                       std::inserter(unionRef, unionRef.end()));
+        std::set<size_t> intersectRef;
+        std::set_intersection(lhsRef.begin(), lhsRef.end(), rhsRef.begin(), rhsRef.end(),
+                              std::inserter(intersectRef, intersectRef.end()));
+        std::set<size_t> subtractRef;
+        std::set_difference(lhsRef.begin(), lhsRef.end(), rhsRef.begin(), rhsRef.end(),
+                            std::inserter(subtractRef, subtractRef.end()));
+
+        auto unionSet = lhs;
+        EXPECT_EQ(unionSet.setUnion(rhs), unionRef.size() != lhsRef.size());
+        EXPECT_EQ(toStdSet(unionSet), unionRef);
+        EXPECT_EQ(unionSet, TaskSet(unionRef.begin(), unionRef.end()));
+
+        auto intersectSet = lhs;
+        intersectSet.setIntersect(rhs);
+        EXPECT_EQ(toStdSet(intersectSet), intersectRef);
+
+        auto subtractSet = lhs;
+        subtractSet.setSubtract(rhs);
+        EXPECT_EQ(toStdSet(subtractSet), subtractRef);
+
+        EXPECT_EQ(lhs.intersects(rhs), !intersectRef.empty());
+        EXPECT_EQ(lhs.isSubsetOf(rhs), std::includes(rhsRef.begin(), rhsRef.end(), lhsRef.begin(), lhsRef.end()));
+        EXPECT_EQ(lhs == rhs, lhsRef == rhsRef);
+    }
+}
@@ -0,0 +1,90 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/compiler/NPU40XX/dialect/ELF/export.hpp"
+
+#include "common/utils.hpp"
+
+#include <mlir/IR/MLIRContext.h>
+#include <mlir/Parser/Parser.h>
+
+#include <gtest/gtest.h>
+
+using namespace vpux;
+
+namespace {
+
+constexpr llvm::StringLiteral inputIR = R"(
+    module @Test attributes {VPU.arch = #VPU.arch_kind<NPU40XX>} {
+      IE.CNNNetwork entryPoint : @main inputsInfo : {
+        DataInfo "input" : tensor<1x1024xui8>
+      } outputsInfo : {
+        DataInfo "output" : tensor<1x1024xui8>
+      }
+      func.func @main() {
+        ELF.Main @ELFMain {
+          ELF.CreateLogicalSection @io.NetworkInput0 aligned(1) secType(SHT_NOBITS) secFlags(VPU_SHF_USERINPUT) {
+            VPUASM.DeclareBuffer @DeclareBuffer0 !VPUASM.Buffer< "NetworkInput"[0] <0> : memref<1x1024xui8, @DDR> :  swizzling(0)>
+          }
+          ELF.CreateSection @program.barrier aligned(64) secType(SHT_PROGBITS) secFlags(SHF_ALLOC) {
+            VPUASM.ConfigureBarrier @ConfigureBarrier0 idx(!VPURegMapped.Index<0:0:0>) (0) => (-1) counts(1 : 1)
+          }
+          ELF.CreateSection @buffer.Constant.0.constant aligned(64) secType(SHT_PROGBITS) secFlags(SHF_ALLOC) {
+            VPUASM.ConstBuffer @Declare0 !VPUASM.Buffer< "Constant"[0] <0> : memref<100x1x1x1xui8, [@DDR, 0]> :  swizzling(0)> = dense<1> : tensor<100x1x1x1xui8>
+            ELF.Pad size(28)
+            VPUASM.ConstBuffer @Declare1 !VPUASM.Buffer< "Constant"[0] <128> : memref<4096x1x1x1xui8, [@DDR, 0]> :  swizzling(0)> = dense<2> : tensor<4096x1x1x1xui8>
+            VPUASM.ConstBuffer @Declare2 !VPUASM.Buffer< "Constant"[0] <4224> : memref<64x1x1x1xui8, [@DDR, 0]> :  swizzling(0)> = dense<3> : tensor<64x1x1x1xui8>
+          }
+          ELF.CreateSection @buffer.Constant.1.constant aligned(128) secType(SHT_PROGBITS) secFlags(SHF_ALLOC) {
+            VPUASM.ConstBuffer @Declare3 !VPUASM.Buffer< "Constant"[0] <0> : memref<1000x1x1x1xui8, [@DDR, 0]> :  swizzling(0)> = dense<4> : tensor<1000x1x1x1xui8>
+          }
+        }
+        return
+      }
+    }
+)";
+
+std::vector<uint8_t> exportModule(mlir::MLIRContext& ctx, ELF::BlobSink* sink = nullptr) {
+    auto module = mlir::parseSourceString<mlir::ModuleOp>(inputIR, &ctx);
+    EXPECT_TRUE(module.get() != nullptr);
+
+    if (sink != nullptr) {
+        ELF::exportToELF(module.get(), *sink);
+        return {};
+    }
+    return ELF::exportToELF(module.get());
+}
+
+}  // namespace
+
+using MLIR_ELFExport = MLIR_UnitBase;
+
+TEST_F(MLIR_ELFExport, SerialAndParallelOutputsAreIdentical) {
+    mlir::MLIRContext parallelCtx(registry);
+    mlir::MLIRContext serialCtx(registry);
+    serialCtx.disableMultithreading();
+
+    const auto parallelBlob = exportModule(parallelCtx);
+    const auto serialBlob = exportModule(serialCtx);
+
+    ASSERT_FALSE(parallelBlob.empty());
+    EXPECT_EQ(parallelBlob, serialBlob);
+}
+
+TEST_F(MLIR_ELFExport, StreamedOutputMatchesBlob) {
+    mlir::MLIRContext ctx(registry);
+    const auto blob = exportModule(ctx);
+
+    std::vector<uint8_t> streamed;
+    ELF::CallbackBlobSink sink(
+            [&](ArrayRef<uint8_t> chunk) {
+                EXPECT_LE(chunk.size(), size_t{256});
+                streamed.insert(streamed.end(), chunk.begin(), chunk.end());
+            },
+            /*chunkSize=*/256);
+    exportModule(ctx, &sink);
+
+    EXPECT_EQ(streamed, blob);
+}
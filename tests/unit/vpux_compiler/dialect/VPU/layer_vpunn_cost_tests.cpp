@@ -293,3 +293,81 @@ TEST_F(MLIR_VPU_LayerVPUNNCost, DMA_Cost) {
                   spillRefCost);
     });
 }
+
+TEST_F(MLIR_VPU_LayerVPUNNCost, CostCache) {
+    constexpr llvm::StringLiteral inputIR = R"(
+#NHWC = affine_map<(d0, d1, d2, d3) -> (d0, d2, d3, d1)>
+
+#loc0 = loc(unknown)
+    module @main {
+        func.func @main(%arg0: tensor<1x16x16x16xf16, {order = #NHWC}>, %wt: tensor<16x1x1x4xsi32>, %weights: tensor<16x16x1x1xf16, {order = #NHWC}>) -> tensor<1x16x16x16xf16, {order = #NHWC}> {
+        %1 = VPU.NCE.Convolution(%arg0, %weights, %wt) {
+                pad = #VPU.Padding<left = 0 : i64, right = 0 : i64, top = 0 : i64, bottom = 0 : i64>,
+                rawFilterShape = [16, 16, 1, 1],
+                strides = [1, 1]
+            } -> tensor<1x16x16x16xf16, {order = #NHWC}> loc(fused["Conv_100", "t_Convolution"])
+        %2 = VPU.NCE.Convolution(%1, %weights, %wt) {
+                pad = #VPU.Padding<left = 0 : i64, right = 0 : i64, top = 0 : i64, bottom = 0 : i64>,
+                rawFilterShape = [16, 16, 1, 1],
+                strides = [1, 1]
+            } -> tensor<1x16x16x16xf16, {order = #NHWC}> loc(fused["Conv_101", "t_Convolution"])
+
+        return %2 : tensor<1x16x16x16xf16, {order = #NHWC}>
+    }
+    }
+    )";
+    auto module = mlir::parseSourceString<mlir::ModuleOp>(inputIR, &ctx);
+    ASSERT_TRUE(module.get() != nullptr);
+
+    auto func = module.get().lookupSymbol<mlir::func::FuncOp>("main");
+    ASSERT_TRUE(func != nullptr);
+
+    mlir::PassManager pm(module.get()->getName(), mlir::OpPassManager::Nesting::Implicit);
+    auto initCompilerOptions = VPU::InitCompilerOptions(ArchKind::NPU37XX, VPU::CompilationMode::DefaultHW);
+
+    VPU::buildInitCompilerPipeline(pm, initCompilerOptions, vpux::Logger::global());
+
+    ASSERT_TRUE(mlir::succeeded(pm.run(module.get())));
+
+    const auto sharedCache = std::make_shared<VPU::VPUNNCostCache>();
+    VPU::LayerVPUNNCost layerCost(func, vpux::Logger::global(), sharedCache);
+
+    SmallVector<VPU::NCEConvolutionOp> convOps;
+    func->walk([&](VPU::NCEConvolutionOp convOp) {
+        convOps.push_back(convOp);
+    });
+    ASSERT_EQ(convOps.size(), 2);
+
+    // Both convolutions describe the same workload, so the second query is served from the cache
+    const auto firstCost = layerCost.getStrategyCost(convOps[0], VPU::MultiClusterStrategy::SplitOverHeight);
+    const auto secondCost = layerCost.getStrategyCost(convOps[1], VPU::MultiClusterStrategy::SplitOverHeight);
+    EXPECT_EQ(firstCost, secondCost);
+
+    auto stats = layerCost.getCacheStatistics();
+    EXPECT_EQ(stats.numMisses, 1);
+    EXPECT_EQ(stats.numHits, 1);
+    EXPECT_EQ(stats.numEntries, 1);
+
+    {
+        // The strategy currently assigned to the operation is not part of the workload
+        VPU::MultiClusterStrategySetter mcSetter(convOps[0], VPU::MultiClusterStrategy::Clustering);
+        EXPECT_EQ(layerCost.getStrategyCost(convOps[0], VPU::MultiClusterStrategy::SplitOverHeight), firstCost);
+        EXPECT_EQ(layerCost.getCacheStatistics().numHits, 2);
+    }
+
+    // A different strategy is a different workload
+    const auto clusteringCost = layerCost.getStrategyCost(convOps[0], VPU::MultiClusterStrategy::Clustering);
+    stats = layerCost.getCacheStatistics();
+    EXPECT_EQ(stats.numMisses, 2);
+    EXPECT_EQ(stats.numEntries, 2);
+
+    // The cached costs match the ones computed without any sharing
+    VPU::LayerVPUNNCost uncachedLayerCost(func);
+    EXPECT_EQ(uncachedLayerCost.getStrategyCost(convOps[1], VPU::MultiClusterStrategy::SplitOverHeight), secondCost);
+    EXPECT_EQ(uncachedLayerCost.getStrategyCost(convOps[1], VPU::MultiClusterStrategy::Clustering), clusteringCost);
+
+    // Another user of the shared cache reuses the entries
+    VPU::LayerVPUNNCost otherLayerCost(func, vpux::Logger::global(), sharedCache);
+    EXPECT_EQ(otherLayerCost.getStrategyCost(convOps[1], VPU::MultiClusterStrategy::Clustering), clusteringCost);
+    EXPECT_EQ(otherLayerCost.getCacheStatistics().numHits, 3);
+}
@@ -169,3 +169,41 @@ TEST_F(MLIRThreadPool, ParallelFor_4d) {
         }
     }
 }
+
+TEST_F(MLIRThreadPool, ParallelFor_chunked) {
+    mlir::MLIRContext ctx(registry);
+    SmallVector<int64_t> testNumElements = {1, 7, 64, 100, 1000, 4099};
+    SmallVector<int64_t> testMinChunkSizes = {1, 16, 256};
+    int64_t bias = 1;
+
+    for (auto numElements : testNumElements) {
+        for (auto minChunkSize : testMinChunkSizes) {
+            // Prepare data
+            SmallVector<int64_t> values(numElements, 0);
+            SmallVector<int64_t> expected(numElements, bias);
+
+            const auto runMLIRLoopChunked = [&](const int64_t numThreads, LoopExecPolicy policy) {
+                llvm::ThreadPool threadPool(llvm::optimal_concurrency(numThreads));
+                ctx.disableMultithreading();
+                ctx.setThreadPool(threadPool);
+                SmallVector<int64_t> result(numElements, 0);
+
+                loop_chunked(policy, &ctx, values.size(), minChunkSize, [&](int64_t begin, int64_t end) {
+                    EXPECT_TRUE(end - begin >= minChunkSize || (begin == 0 && end == numElements));
+                    for (auto i = begin; i < end; ++i) {
+                        result[i] += values[i] + bias;
+                    }
+                });
+
+                EXPECT_EQ(result, expected);
+            };
+
+            SmallVector<LoopExecPolicy> policy = {LoopExecPolicy::Sequential, LoopExecPolicy::Parallel};
+            for (size_t numThreads = 1; numThreads <= MAX_TEST_THREADS; numThreads *= 2) {
+                for (auto it : policy) {
+                    runMLIRLoopChunked(numThreads, it);
+                }
+            }
+        }
+    }
+}
@@ -66,10 +66,11 @@ void compile(mlir::MLIRContext* ctx, size_t numFoldingThreads, std::chrono::mill
     const auto collectStatistics = true;
     const auto memoryUsageLimit = 3 * 1024;
     const auto cacheCleanThreshold = 0.8;
+    const auto evictionPolicy = Const::CacheEvictionPolicy::RefCount;
     Logger log = Logger::global();
 
     auto foldingListener = std::make_unique<Const::BackgroundConstantFolding>(
-            ctx, numFoldingThreads, collectStatistics, memoryUsageLimit, cacheCleanThreshold, log);
+            ctx, numFoldingThreads, collectStatistics, memoryUsageLimit, cacheCleanThreshold, evictionPolicy, log);
 
     const auto [contentAttr, expectedValues] = contentAttrFn(ctx);
 
@@ -169,10 +170,11 @@ TEST_F(ConstantFoldingInBackgroundUnit, EquivalenceRequest) {
     const auto collectStatistics = true;
     const auto memoryUsageLimit = 3 * 1024;
     const auto cacheCleanThreshold = 0.8;
+    const auto evictionPolicy = Const::CacheEvictionPolicy::RefCount;
     Logger log = Logger::global();
 
     auto foldingListener = Const::BackgroundConstantFolding(&ctx, numFoldingThreads, collectStatistics,
-                                                            memoryUsageLimit, cacheCleanThreshold, log);
+                                                            memoryUsageLimit, cacheCleanThreshold, evictionPolicy, log);
 
     const size_t numElements = 100;
     const float baseValue = 1.0f;
@@ -200,4 +202,166 @@ TEST_F(ConstantFoldingInBackgroundUnit, EquivalenceRequest) {
     EXPECT_TRUE(cache.hasContent(contentAttr2));
 }
 
+namespace {
+
+Const::ContentAttr createSplatContentAttr(mlir::MLIRContext* ctx, int64_t numElements, float value) {
+    const auto baseType = mlir::RankedTensorType::get({numElements}, mlir::Float32Type::get(ctx));
+    const auto baseAttr = mlir::DenseElementsAttr::get(baseType, value);
+    return Const::ContentAttr::get(baseAttr).add(1.0);
+}
+
+}  // namespace
+
+class ConstantFoldingCacheEviction : public MLIR_UnitBase {
+public:
+    ConstantFoldingCacheEviction() {
+        ctx.appendDialectRegistry(registry);
+        ctx.loadDialect<Const::ConstDialect>();
+    }
+
+    void addToCache(Const::ConstantFoldingCache& cache, Const::ContentAttr attr, std::chrono::microseconds cost) {
+        cache.addContent(attr, attr.fold(/*bypassCache=*/true).copyUnownedBuffer(), cost);
+    }
+
+protected:
+    mlir::MLIRContext ctx;
+};
+
+TEST_F(ConstantFoldingCacheEviction, LRU) {
+    Const::ConstantFoldingCache cache;
+    cache.setEvictionPolicy(Const::CacheEvictionPolicy::LRU);
+    // Each entry takes 4000 bytes, so the third one exceeds the limit
+    cache.setMemoryUsageLimit(vpux::Byte(10000));
+    cache.setCacheCleanThreshold(0.8);
+
+    const auto attr1 = createSplatContentAttr(&ctx, 1000, 1.0f);
+    const auto attr2 = createSplatContentAttr(&ctx, 1000, 2.0f);
+    const auto attr3 = createSplatContentAttr(&ctx, 1000, 3.0f);
+    addToCache(cache, attr1, 1ms);
+    addToCache(cache, attr2, 1ms);
+    ASSERT_TRUE(cache.getContent(attr1).has_value());
+    addToCache(cache, attr3, 1ms);
+
+    EXPECT_TRUE(cache.hasContent(attr1));
+    EXPECT_FALSE(cache.hasContent(attr2));
+    EXPECT_TRUE(cache.hasContent(attr3));
+}
+
+TEST_F(ConstantFoldingCacheEviction, GDSF) {
+    Const::ConstantFoldingCache cache;
+    cache.enableStatisticsCollection();
+    cache.setEvictionPolicy(Const::CacheEvictionPolicy::GDSF);
+    cache.setMemoryUsageLimit(vpux::Byte(50000));
+    cache.setCacheCleanThreshold(0.8);
+
+    // The large entry is cheap to recompute compared to its size, so it is evicted before the small one even though
+    // it is the most recently used
+    const auto smallAttr = createSplatContentAttr(&ctx, 100, 1.0f);
+    const auto largeAttr = createSplatContentAttr(&ctx, 10000, 2.0f);
+    addToCache(cache, smallAttr, 10ms);
+    addToCache(cache, largeAttr, 10ms);
+    ASSERT_TRUE(cache.getContent(largeAttr).has_value());
+    addToCache(cache, createSplatContentAttr(&ctx, 3000, 3.0f), 10ms);
+
+    EXPECT_TRUE(cache.hasContent(smallAttr));
+    EXPECT_FALSE(cache.hasContent(largeAttr));
+
+    auto& statistics = cache.getStatistics();
+    EXPECT_EQ(statistics.numEvictions.load(), 1u);
+    EXPECT_EQ(statistics.numBytesEvicted.load(), 40000u);
+    EXPECT_EQ(statistics.numBytesSaved.load(), 40000u);
+    EXPECT_EQ(statistics.foldingTimeSaved.load(), 10000u);
+}
+
+TEST_F(ConstantFoldingCacheEviction, RequestOrder) {
+    Const::details::RequestQueue queue;
+    const auto attr1 = createSplatContentAttr(&ctx, 10, 1.0f);
+    const auto attr2 = createSplatContentAttr(&ctx, 10, 2.0f);
+    const auto attr3 = createSplatContentAttr(&ctx, 10, 3.0f);
+    const auto attr4 = createSplatContentAttr(&ctx, 10, 4.0f);
+    queue.push(Const::FoldingRequest{attr1, nullptr});
+    queue.push(Const::FoldingRequest{attr2, nullptr});
+    queue.push(Const::FoldingRequest{attr3, nullptr});
+    queue.push(Const::FoldingRequest{attr4, nullptr});
+
+    // Claiming a request from the middle of the queue keeps the order of the others
+    EXPECT_EQ(queue.claimOrWait(attr2), Const::details::RequestQueue::ClaimResult::Claimed);
+    queue.markCompleted(attr2);
+
+    EXPECT_EQ(queue.pop().attr, attr1);
+    EXPECT_EQ(queue.pop().attr, attr3);
+    EXPECT_EQ(queue.pop().attr, attr4);
+    EXPECT_EQ(queue.size(), 0u);
+}
+
+TEST_F(ConstantFoldingCacheEviction, ClaimRequest) {
+    using ClaimResult = Const::details::RequestQueue::ClaimResult;
+
+    Const::details::RequestQueue queue;
+    const auto attr1 = createSplatContentAttr(&ctx, 10, 1.0f);
+    const auto attr2 = createSplatContentAttr(&ctx, 10, 2.0f);
+    queue.push(Const::FoldingRequest{attr1, nullptr});
+    queue.push(Const::FoldingRequest{attr1, nullptr});
+
+    // Queued requests, including duplicates, are removed from the queue when claimed. The claimed request is in
+    // progress until the claimer completes it
+    EXPECT_EQ(queue.claimOrWait(attr1), ClaimResult::Claimed);
+    EXPECT_EQ(queue.size(), 0u);
+    std::thread claimer([&]() {
+        std::this_thread::sleep_for(10ms);
+        queue.markCompleted(attr1);
+    });
+    EXPECT_EQ(queue.claimOrWait(attr1), ClaimResult::Completed);
+    claimer.join();
+    EXPECT_EQ(queue.claimOrWait(attr1), ClaimResult::NotFound);
+
+    // Requests in progress are awaited
+    queue.markInProgress(attr2);
+    std::thread worker([&]() {
+        std::this_thread::sleep_for(10ms);
+        queue.markCompleted(attr2);
+    });
+    EXPECT_EQ(queue.claimOrWait(attr2), ClaimResult::Completed);
+    worker.join();
+}
+
+TEST_F(ConstantFoldingCacheEviction, RefCountIsDefault) {
+    Const::ConstantFoldingCache cache;
+    EXPECT_EQ(cache.getEvictionPolicy(), Const::CacheEvictionPolicy::RefCount);
+}
+
+TEST_F(ConstantFoldingCacheEviction, CleanUpDuringInsertions) {
+    Const::ConstantFoldingCache cache;
+    cache.setMemoryUsageLimit(vpux::Byte(20000));
+    cache.setCacheCleanThreshold(0.5);
+
+    // Every insertion above the limit triggers a clean up, which must not race with the insertions of other threads
+    std::vector<Const::ContentAttr> attrs;
+    for (size_t i = 0; i < 64; ++i) {
+        attrs.push_back(createSplatContentAttr(&ctx, 1000, static_cast<float>(i)));
+    }
+    std::vector<std::thread> workers;
+    for (size_t worker = 0; worker < 4; ++worker) {
+        workers.emplace_back([&, worker]() {
+            for (size_t i = worker; i < attrs.size(); i += 4) {
+                addToCache(cache, attrs[i], 1ms);
+                cache.removeContent(attrs[(i + 7) % attrs.size()]);
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    // Each thread may have added one entry after the last clean up it observed
+    EXPECT_LE(cache.getMemoryUsedCache(), 20000u + 4 * 4000u);
+}
+
+TEST_F(ConstantFoldingCacheEviction, PolicyNames) {
+    for (auto policy :
+         {Const::CacheEvictionPolicy::RefCount, Const::CacheEvictionPolicy::LRU, Const::CacheEvictionPolicy::GDSF}) {
+        EXPECT_EQ(Const::symbolizeCacheEvictionPolicy(Const::stringifyCacheEvictionPolicy(policy)), policy);
+    }
+    EXPECT_FALSE(Const::symbolizeCacheEvictionPolicy("fifo").has_value());
+}
+
 #endif
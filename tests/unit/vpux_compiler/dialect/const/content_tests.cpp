@@ -6,6 +6,7 @@
 #include "vpux/compiler/dialect/IE/IR/ops.hpp"
 #include "vpux/compiler/dialect/const/attributes/content.hpp"
 #include "vpux/compiler/dialect/const/ops.hpp"
+#include "vpux/compiler/dialect/const/utils/fused_transformations.hpp"
 #include "vpux/compiler/utils/swizzling_utils.hpp"
 #include "vpux/compiler/utils/types.hpp"
 #include "vpux/utils/core/small_vector.hpp"
@@ -15,6 +16,7 @@
 
 #include "common/utils.hpp"
 
+#include <mlir/AsmParser/AsmParser.h>
 #include <mlir/Dialect/Quant/QuantOps.h>
 #include <mlir/Dialect/Quant/QuantTypes.h>
 #include <mlir/IR/AsmState.h>
@@ -26,6 +28,8 @@
 #include <vpux/compiler/utils/quantization.hpp>
 
 #include <cassert>
+#include <cmath>
+#include <limits>
 #include <memory>
 #include <numeric>
 
@@ -328,6 +332,58 @@ TEST_F(MLIR_ConstContentAttrTest, FromEqualElementsSplatDenseResourceElementsAtt
     }
 }
 
+TEST_F(MLIR_ConstContentAttrTest, FromPackedSubByteDenseResourceElementsAttr) {
+    const auto baseType = mlir::RankedTensorType::get({2, 4}, getUInt4Type(&ctx));
+    const std::vector<char> packedVals = {0x10, 0x32, 0x54, 0x76};
+    constexpr auto noop = [](char*, size_t, size_t) {};
+    constexpr bool isMutable = false;
+    mlir::AsmResourceBlob blob(mlir::ArrayRef<char>(packedVals), noop, isMutable);
+
+    auto& manager = mlir::DenseResourceElementsHandle::getManagerInterface(&ctx);
+    const auto baseAttr = mlir::DenseResourceElementsAttr::get(
+            baseType, manager.insert("FromPackedSubByteDenseResourceElementsAttr", std::move(blob)));
+
+    const auto contentAttr = Const::ContentAttr::get(baseAttr);
+    ASSERT_NE(contentAttr, nullptr);
+    EXPECT_EQ(contentAttr.getType(), baseType);
+    EXPECT_FALSE(contentAttr.isSplat());
+
+    // The packed data is unpacked into one element per byte only when folded
+    const auto content = contentAttr.fold();
+    EXPECT_EQ(content.getType(), baseType);
+    EXPECT_FALSE(content.isSplat());
+
+    const auto contentVals = content.getValues<uint8_t>();
+    EXPECT_EQ(contentVals.size(), baseType.getNumElements());
+    for (size_t i = 0; i < contentVals.size(); ++i) {
+        EXPECT_EQ(contentVals[i], i);
+    }
+
+    std::vector<char> repackedVals(packedVals.size());
+    content.copyTo(repackedVals);
+    EXPECT_EQ(repackedVals, packedVals);
+}
+
+TEST_F(MLIR_ConstContentAttrTest, FromSplatPackedSubByteDenseResourceElementsAttr) {
+    const auto baseType = mlir::RankedTensorType::get({5}, getSInt4Type(&ctx));
+    const std::vector<char> packedVals = {0x77, 0x77, 0x07};
+    constexpr auto noop = [](char*, size_t, size_t) {};
+    constexpr bool isMutable = false;
+    mlir::AsmResourceBlob blob(mlir::ArrayRef<char>(packedVals), noop, isMutable);
+
+    auto& manager = mlir::DenseResourceElementsHandle::getManagerInterface(&ctx);
+    const auto baseAttr = mlir::DenseResourceElementsAttr::get(
+            baseType, manager.insert("FromSplatPackedSubByteDenseResourceElementsAttr", std::move(blob)));
+
+    const auto contentAttr = Const::ContentAttr::get(baseAttr);
+    ASSERT_NE(contentAttr, nullptr);
+    EXPECT_TRUE(contentAttr.isSplat());
+
+    const auto content = contentAttr.fold();
+    EXPECT_TRUE(content.isSplat());
+    EXPECT_EQ(content.getSplatValue<int8_t>(), 7);
+}
+
 TEST_F(MLIR_ConstContentAttrTest, ExpositionOnlyDenseResourceDuplicate) {
     const auto baseType = mlir::RankedTensorType::get({1, 2, 3, 4}, mlir::Float32Type::get(&ctx));
     const auto vals = generateValues<float>(baseType.getNumElements());
@@ -403,6 +459,76 @@ TEST_F(MLIR_ConstContentAttrTest, CopyTo_FP32) {
     }
 }
 
+TEST_F(MLIR_ConstContentAttrTest, CopyTo_FP32_To_FP16) {
+    const auto baseType = mlir::RankedTensorType::get({1037}, mlir::Float32Type::get(&ctx));
+
+    std::vector<float> vals(baseType.getNumElements());
+    for (size_t i = 0; i < vals.size(); ++i) {
+        vals[i] = std::ldexp(static_cast<float>(i % 113) - 56.3f, static_cast<int>(i % 47) - 30);
+    }
+    // Values which are out of the FP16 range or which become FP16 subnormals
+    vals[3] = 1e6f;
+    vals[100] = -7e4f;
+    vals[501] = 65520.0f;
+    vals[700] = 3e-8f;
+    vals[1000] = -6.1e-5f;
+
+    const auto baseAttr = mlir::DenseElementsAttr::get(baseType, ArrayRef(vals));
+    const auto contentAttr = Const::ContentAttr::get(baseAttr).convertElemType(mlir::Float16Type::get(&ctx));
+    ASSERT_NE(contentAttr, nullptr);
+
+    const auto content = contentAttr.fold();
+    const auto bufSizeBytes = checked_cast<size_t>(content.getType().getTotalAllocSize().count());
+    std::vector<vpux::type::float16> tempBuf(bufSizeBytes / sizeof(vpux::type::float16));
+    content.copyTo(MutableArrayRef(reinterpret_cast<char*>(tempBuf.data()), bufSizeBytes));
+
+    // The bulk conversion used by `copyTo` must match the element-wise one
+    const auto contentVals = content.getValues<vpux::type::float16>();
+    ASSERT_EQ(contentVals.size(), tempBuf.size());
+    for (size_t i = 0; i < tempBuf.size(); ++i) {
+        EXPECT_EQ(contentVals[i].to_bits(), tempBuf[i].to_bits()) << i;
+    }
+    EXPECT_EQ(static_cast<float>(tempBuf[3]), static_cast<float>(std::numeric_limits<vpux::type::float16>::max()));
+    EXPECT_EQ(static_cast<float>(tempBuf[100]),
+              static_cast<float>(std::numeric_limits<vpux::type::float16>::lowest()));
+}
+
+TEST_F(MLIR_ConstContentAttrTest, GetValues_FP32_To_FP16_ReportsClampingOnce) {
+    const auto baseType = mlir::RankedTensorType::get({16}, mlir::Float32Type::get(&ctx));
+
+    std::vector<float> vals(baseType.getNumElements(), 1e6f);
+    vals[0] = -7e4f;
+    vals[1] = 1.0f;
+
+    const auto baseAttr = mlir::DenseElementsAttr::get(baseType, ArrayRef(vals));
+    const auto content = Const::ContentAttr::get(baseAttr).fold();
+
+    auto& logger = Logger::global();
+    const auto origLevel = logger.level();
+    logger.setLevel(LogLevel::Warning);
+
+    testing::internal::CaptureStdout();
+    Const::details::FP16ClampStats clampStats;
+    const auto contentVals = content.getValues<vpux::type::float16>(&clampStats);
+    std::vector<vpux::type::float16> convertedVals(contentVals.begin(), contentVals.end());
+    EXPECT_EQ(static_cast<float>(convertedVals[0]),
+              static_cast<float>(std::numeric_limits<vpux::type::float16>::lowest()));
+    EXPECT_EQ(static_cast<float>(convertedVals[1]), 1.0f);
+    EXPECT_EQ(static_cast<float>(convertedVals[2]),
+              static_cast<float>(std::numeric_limits<vpux::type::float16>::max()));
+    EXPECT_EQ(clampStats.numClamped, 15);
+    EXPECT_EQ(clampStats.minClamped, -7e4f);
+    EXPECT_EQ(clampStats.maxClamped, 1e6f);
+    Const::details::reportFP16Clamping(clampStats);
+    Logger::getBaseStream().flush();
+    const auto output = testing::internal::GetCapturedStdout();
+    logger.setLevel(origLevel);
+
+    // The 15 clamped values are reported with a single warning
+    EXPECT_NE(output.find("15 values in range"), std::string::npos) << output;
+    EXPECT_EQ(StringRef(output).count("out of range for FP16"), 1u) << output;
+}
+
 TEST_F(MLIR_ConstContentAttrTest, CopyTo_U8) {
     const auto baseType = mlir::RankedTensorType::get({8}, mlir::IntegerType::get(&ctx, 8));
 
@@ -1474,6 +1600,116 @@ TEST_F(MLIR_ConstContentAttrTest, MemPermute) {
     }
 }
 
+TEST_F(MLIR_ConstContentAttrTest, FusedTransformations) {
+    ctx.loadDialect<mlir::quant::QuantizationDialect>();
+
+    const int64_t N = 3;
+    const int64_t C = 5;
+    const int64_t H = 4;
+    const int64_t W = 7;
+    const auto baseType = mlir::RankedTensorType::get({N, C, H, W}, mlir::Float32Type::get(&ctx));
+
+    std::vector<float> vals(baseType.getNumElements());
+    for (size_t i = 0; i < vals.size(); ++i) {
+        vals[i] = static_cast<float>(static_cast<int64_t>(i % 97) - 48) * 0.37f;
+    }
+    const auto baseAttr = mlir::DenseElementsAttr::get(baseType, ArrayRef(vals));
+    const auto baseContentAttr = Const::ContentAttr::get(baseAttr);
+
+    const auto quantType = mlir::quant::UniformQuantizedType::get(0, getUInt8Type(&ctx), mlir::Float32Type::get(&ctx),
+                                                                  0.1, 128, 0, 255);
+    const auto contentAttr = baseContentAttr.add(1.5)
+                                     .reorder(DimsOrder::NHWC)
+                                     .rescale(0.75)
+                                     .convertElemType(mlir::Float16Type::get(&ctx))
+                                     .quantize(quantType)
+                                     .dequantize()
+                                     .memPermute(DimsOrder::NCHW, DimsOrder::NWHC);
+    ASSERT_NE(contentAttr, nullptr);
+
+    const auto transformations = contentAttr.getTransformations();
+    auto stagedContent = Const::Content::fromRawBuffer(baseType.cast<vpux::NDTypeInterface>(), baseAttr.getRawData(),
+                                                       baseType.getElementType(), false);
+    const auto fused = Const::details::FusedTransformations::match(stagedContent, transformations);
+    EXPECT_EQ(fused.getNumTransformations(), transformations.size());
+
+    for (const auto& attr : transformations) {
+        stagedContent = attr.transform(stagedContent);
+    }
+
+    const auto content = contentAttr.fold();
+    EXPECT_EQ(content.getType(), contentAttr.getType());
+    EXPECT_EQ(content.getType(), stagedContent.getType());
+    EXPECT_EQ(content.getStorageElemType(), stagedContent.getStorageElemType());
+    EXPECT_FALSE(content.isSplat());
+
+    const auto contentVals = content.getValues<float>();
+    const auto stagedVals = stagedContent.getValues<float>();
+    ASSERT_EQ(contentVals.size(), stagedVals.size());
+    for (size_t i = 0; i < contentVals.size(); ++i) {
+        EXPECT_EQ(contentVals[i], stagedVals[i]) << i;
+    }
+}
+
+TEST_F(MLIR_ConstContentAttrTest, FusedTransformationsSignlessQuantStorage) {
+    ctx.loadDialect<mlir::quant::QuantizationDialect>();
+
+    const auto baseType = mlir::RankedTensorType::get({2, 3, 4, 5}, mlir::Float32Type::get(&ctx));
+    std::vector<float> vals(baseType.getNumElements());
+    for (size_t i = 0; i < vals.size(); ++i) {
+        vals[i] = static_cast<float>(static_cast<int64_t>(i % 41) - 20) * 0.23f;
+    }
+    const auto baseAttr = mlir::DenseElementsAttr::get(baseType, ArrayRef(vals));
+    const auto baseContentAttr = Const::ContentAttr::get(baseAttr);
+
+    // The signless storage types are the ones the parser produces, the references use the explicitly signed storage
+    // with the same range, which the staged Quantize supports
+    const auto f32Type = mlir::Float32Type::get(&ctx);
+    const std::pair<StringRef, mlir::quant::QuantizedType> cases[] = {
+            {"!quant.uniform<i8:f32, 0.1:3>",
+             mlir::quant::UniformQuantizedType::get(mlir::quant::QuantizationFlags::Signed, getSInt8Type(&ctx), f32Type,
+                                                    0.1, 3, -128, 127)},
+            {"!quant.uniform<i4:f32, 0.5:1>",
+             mlir::quant::UniformQuantizedType::get(mlir::quant::QuantizationFlags::Signed, getSInt8Type(&ctx), f32Type,
+                                                    0.5, 1, -8, 7)},
+    };
+
+    for (const auto& [typeStr, refQuantType] : cases) {
+        SCOPED_TRACE(typeStr.str());
+
+        const auto quantType = mlir::dyn_cast_or_null<mlir::quant::QuantizedType>(mlir::parseType(typeStr, &ctx));
+        ASSERT_NE(quantType, nullptr);
+        ASSERT_TRUE(quantType.getStorageType().isSignlessInteger());
+
+        const auto contentAttr = baseContentAttr.add(1.5).reorder(DimsOrder::NHWC).rescale(0.75).quantize(quantType);
+        ASSERT_NE(contentAttr, nullptr);
+
+        auto baseContent = Const::Content::fromRawBuffer(baseType.cast<vpux::NDTypeInterface>(),
+                                                         baseAttr.getRawData(), baseType.getElementType(), false);
+        const auto fused = Const::details::FusedTransformations::match(baseContent, contentAttr.getTransformations());
+        EXPECT_EQ(fused.getNumTransformations(), contentAttr.getTransformations().size());
+
+        const auto refContentAttr =
+                baseContentAttr.add(1.5).reorder(DimsOrder::NHWC).rescale(0.75).quantize(refQuantType);
+        auto stagedContent = Const::Content::fromRawBuffer(baseType.cast<vpux::NDTypeInterface>(),
+                                                           baseAttr.getRawData(), baseType.getElementType(), false);
+        for (const auto& attr : refContentAttr.getTransformations()) {
+            stagedContent = attr.transform(stagedContent);
+        }
+
+        const auto content = contentAttr.fold();
+        EXPECT_EQ(content.getType(), contentAttr.getType());
+        EXPECT_EQ(content.getStorageElemType(), getSInt8Type(&ctx));
+
+        const auto contentVals = content.getValues<float>();
+        const auto stagedVals = stagedContent.getValues<float>();
+        ASSERT_EQ(contentVals.size(), stagedVals.size());
+        for (size_t i = 0; i < contentVals.size(); ++i) {
+            EXPECT_EQ(contentVals[i], stagedVals[i]) << i;
+        }
+    }
+}
+
 TEST_F(MLIR_ConstContentAttrTest, BitPackIsLast) {
     ctx.loadDialect<mlir::quant::QuantizationDialect>();
     const int64_t IN = 1;
@@ -0,0 +1,116 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/compiler/dialect/const/utils/mem_permute_optimized.hpp"
+
+#include <mlir/IR/AffineMap.h>
+#include <mlir/IR/MLIRContext.h>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <climits>
+#include <numeric>
+#include <random>
+
+using namespace vpux;
+
+namespace {
+
+struct MemPermuteParams {
+    SmallVector<int64_t> inMemShape;
+    SmallVector<unsigned> memPerm;
+    int64_t elemBits;
+};
+
+// Straightforward element by element permutation, with packed sub-byte elements stored from the least significant bits
+std::vector<char> permuteReference(ArrayRef<char> inBuf, ArrayRef<int64_t> inMemShape, ArrayRef<unsigned> memPerm,
+                                   int64_t elemBits) {
+    const auto rank = inMemShape.size();
+    SmallVector<int64_t> outMemShape(rank);
+    for (size_t ind = 0; ind < rank; ++ind) {
+        outMemShape[ind] = inMemShape[memPerm[ind]];
+    }
+    const auto numElems = std::accumulate(inMemShape.begin(), inMemShape.end(), int64_t(1), std::multiplies<>());
+
+    std::vector<char> outBuf(inBuf.size(), 0);
+    SmallVector<int64_t> inIndex(rank);
+    for (int64_t inInd1D = 0; inInd1D < numElems; ++inInd1D) {
+        auto rem = inInd1D;
+        for (size_t dim = rank; dim-- > 0;) {
+            inIndex[dim] = rem % inMemShape[dim];
+            rem /= inMemShape[dim];
+        }
+        int64_t outInd1D = 0;
+        for (size_t dim = 0; dim < rank; ++dim) {
+            outInd1D = outInd1D * outMemShape[dim] + inIndex[memPerm[dim]];
+        }
+
+        if (elemBits < CHAR_BIT) {
+            const auto inBitPos = inInd1D * elemBits;
+            const auto outBitPos = outInd1D * elemBits;
+            const auto value = (static_cast<uint8_t>(inBuf[inBitPos / CHAR_BIT]) >> (inBitPos % CHAR_BIT)) &
+                               ((1 << elemBits) - 1);
+            outBuf[outBitPos / CHAR_BIT] |= static_cast<char>(value << (outBitPos % CHAR_BIT));
+        } else {
+            const auto elemBytes = elemBits / CHAR_BIT;
+            std::copy_n(inBuf.data() + inInd1D * elemBytes, elemBytes, outBuf.data() + outInd1D * elemBytes);
+        }
+    }
+    return outBuf;
+}
+
+}  // namespace
+
+class MemPermuteOptimizedTests : public testing::TestWithParam<MemPermuteParams> {};
+
+TEST_P(MemPermuteOptimizedTests, permuteMemory) {
+    const auto params = GetParam();
+    mlir::MLIRContext ctx;
+
+    const auto numElems = std::accumulate(params.inMemShape.begin(), params.inMemShape.end(), int64_t(1),
+                                          std::multiplies<>());
+    const auto numBytes = (numElems * params.elemBits + CHAR_BIT - 1) / CHAR_BIT;
+
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> dist(0, UCHAR_MAX);
+    std::vector<char> inBuf(numBytes);
+    for (auto& byte : inBuf) {
+        byte = static_cast<char>(dist(gen));
+    }
+    if (const auto tailBits = (numElems * params.elemBits) % CHAR_BIT; tailBits != 0) {
+        inBuf.back() = static_cast<char>(inBuf.back() & ((1 << tailBits) - 1));
+    }
+
+    std::vector<char> outBuf(numBytes);
+    const auto permOrder = DimsOrder::fromAffineMap(mlir::AffineMap::getPermutationMap(params.memPerm, &ctx));
+    Const::details::permuteMemory(inBuf, outBuf, MemShapeRef(ArrayRef(params.inMemShape)), permOrder,
+                                  Bit(params.elemBits), &ctx);
+
+    EXPECT_EQ(outBuf, permuteReference(inBuf, params.inMemShape, params.memPerm, params.elemBits));
+}
+
+// clang-format off
+std::vector<MemPermuteParams> memPermuteParams = {
+        // NCHW <-> NHWC
+        {/*inMemShape*/ {2, 35, 13, 9}, /*memPerm*/ {0, 2, 3, 1}, /*elemBits*/ 32},
+        {/*inMemShape*/ {2, 13, 9, 35}, /*memPerm*/ {0, 3, 1, 2}, /*elemBits*/ 16},
+        {/*inMemShape*/ {1, 67, 5, 7}, /*memPerm*/ {0, 2, 3, 1}, /*elemBits*/ 8},
+        // OIYX -> OYXI
+        {/*inMemShape*/ {19, 41, 3, 3}, /*memPerm*/ {0, 2, 3, 1}, /*elemBits*/ 16},
+        // NCDHW <-> NDHWC
+        {/*inMemShape*/ {1, 17, 3, 5, 6}, /*memPerm*/ {0, 2, 3, 4, 1}, /*elemBits*/ 32},
+        // 8-byte, odd-sized and sub-byte elements
+        {/*inMemShape*/ {7, 33, 2}, /*memPerm*/ {2, 0, 1}, /*elemBits*/ 64},
+        {/*inMemShape*/ {5, 4, 3}, /*memPerm*/ {1, 2, 0}, /*elemBits*/ 24},
+        {/*inMemShape*/ {3, 11, 7, 2}, /*memPerm*/ {3, 1, 0, 2}, /*elemBits*/ 4},
+        {/*inMemShape*/ {5, 9, 3}, /*memPerm*/ {2, 0, 1}, /*elemBits*/ 2},
+        {/*inMemShape*/ {13, 21}, /*memPerm*/ {1, 0}, /*elemBits*/ 1},
+        // Higher ranks and dimensions of size 1
+        {/*inMemShape*/ {2, 1, 3, 4, 1, 5, 2}, /*memPerm*/ {6, 3, 1, 0, 5, 2, 4}, /*elemBits*/ 16},
+};
+// clang-format on
+
+INSTANTIATE_TEST_CASE_P(Unit, MemPermuteOptimizedTests, testing::ValuesIn(memPermuteParams));
@@ -0,0 +1,145 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/compiler/dialect/const/attributes/content.hpp"
+#include "vpux/compiler/dialect/const/ops.hpp"
+#include "vpux/compiler/dialect/const/utils/persistent_folding_cache.hpp"
+
+#include "common/utils.hpp"
+
+#include <mlir/AsmParser/AsmParser.h>
+#include <mlir/IR/MLIRContext.h>
+
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/Path.h>
+#include <llvm/Support/raw_ostream.h>
+
+#include <gtest/gtest.h>
+
+#include <numeric>
+
+using namespace vpux;
+
+namespace {
+
+constexpr int64_t NUM_ELEMENTS = 1024;
+
+Const::ContentAttr createContentAttr(mlir::MLIRContext* ctx) {
+    const auto baseType = mlir::RankedTensorType::get({NUM_ELEMENTS}, mlir::Float32Type::get(ctx));
+    std::vector<float> vals(NUM_ELEMENTS);
+    std::iota(vals.begin(), vals.end(), 0.0f);
+    const auto baseAttr = mlir::DenseElementsAttr::get(baseType, ArrayRef(vals));
+    return Const::ContentAttr::get(baseAttr).add(1.0).rescale(2.0);
+}
+
+void checkContent(const Const::Content& content) {
+    const auto values = content.getValues<float>();
+    ASSERT_EQ(values.size(), static_cast<size_t>(NUM_ELEMENTS));
+    for (int64_t i = 0; i < NUM_ELEMENTS; ++i) {
+        EXPECT_EQ(values[i], (static_cast<float>(i) + 1.0f) * 2.0f);
+    }
+}
+
+}  // namespace
+
+class MLIR_PersistentFoldingCacheTest : public MLIR_UnitBase {
+public:
+    MLIR_PersistentFoldingCacheTest(): MLIR_UnitBase() {
+        std::ignore = llvm::sys::fs::createUniqueDirectory("npu-folding-cache", cacheDir);
+    }
+
+    ~MLIR_PersistentFoldingCacheTest() override {
+        std::ignore = llvm::sys::fs::remove_directories(cacheDir);
+    }
+
+    std::unique_ptr<mlir::MLIRContext> createContext() {
+        auto ctx = std::make_unique<mlir::MLIRContext>(registry);
+        ctx->loadDialect<Const::ConstDialect>();
+        return ctx;
+    }
+
+protected:
+    llvm::SmallString<128> cacheDir;
+};
+
+TEST_F(MLIR_PersistentFoldingCacheTest, SharedAcrossContexts) {
+    {
+        auto ctx = createContext();
+        Const::PersistentFoldingCache cache(cacheDir, vpux::Byte(1));
+        const auto contentAttr = createContentAttr(ctx.get());
+        ASSERT_TRUE(cache.isCacheable(contentAttr));
+        EXPECT_FALSE(cache.load(contentAttr).has_value());
+
+        cache.store(contentAttr, contentAttr.fold());
+        EXPECT_EQ(cache.getNumStores(), 1u);
+    }
+
+    auto ctx = createContext();
+    Const::PersistentFoldingCache cache(cacheDir, vpux::Byte(1));
+    const auto contentAttr = createContentAttr(ctx.get());
+    const auto content = cache.load(contentAttr);
+    ASSERT_TRUE(content.has_value());
+    EXPECT_EQ(cache.getNumHits(), 1u);
+    EXPECT_EQ(content->getType(), contentAttr.getType());
+    checkContent(content.value());
+}
+
+TEST_F(MLIR_PersistentFoldingCacheTest, FoldThroughManager) {
+    auto ctx = createContext();
+    auto& manager = Const::PersistentFoldingCacheManager::getInstance();
+    ASSERT_TRUE(manager.addCache(ctx.get(), cacheDir, vpux::Byte(1)));
+
+    const auto contentAttr = createContentAttr(ctx.get());
+    checkContent(contentAttr.fold());
+    checkContent(contentAttr.fold());
+
+    auto* cache = manager.find(ctx.get());
+    ASSERT_NE(cache, nullptr);
+    EXPECT_EQ(cache->getNumStores(), 1u);
+    EXPECT_EQ(cache->getNumHits(), 1u);
+    EXPECT_TRUE(manager.removeCache(ctx.get()));
+    EXPECT_EQ(manager.find(ctx.get()), nullptr);
+}
+
+TEST_F(MLIR_PersistentFoldingCacheTest, SmallContentIsNotCached) {
+    auto ctx = createContext();
+    Const::PersistentFoldingCache cache(cacheDir, vpux::MB(1).to<vpux::Byte>());
+    const auto contentAttr = createContentAttr(ctx.get());
+    EXPECT_FALSE(cache.isCacheable(contentAttr));
+
+    cache.store(contentAttr, contentAttr.fold());
+    EXPECT_EQ(cache.getNumStores(), 0u);
+}
+
+TEST_F(MLIR_PersistentFoldingCacheTest, CorruptedEntryIsIgnored) {
+    auto ctx = createContext();
+    Const::PersistentFoldingCache cache(cacheDir, vpux::Byte(1));
+    const auto contentAttr = createContentAttr(ctx.get());
+
+    llvm::SmallString<128> entryPath(cacheDir);
+    llvm::sys::path::append(entryPath, cache.getKey(contentAttr) + ".npucf");
+    {
+        std::error_code ec;
+        llvm::raw_fd_ostream os(entryPath, ec);
+        ASSERT_FALSE(ec);
+        os << "not a cache entry";
+    }
+
+    EXPECT_FALSE(cache.load(contentAttr).has_value());
+    EXPECT_EQ(cache.getNumMisses(), 1u);
+}
+
+TEST_F(MLIR_PersistentFoldingCacheTest, ResourceWithoutBlobIsNotCached) {
+    auto ctx = createContext();
+    Const::PersistentFoldingCache cache(cacheDir, vpux::Byte(1));
+
+    // All the resources without data would share the same key otherwise
+    const auto baseAttr = mlir::parseAttribute("dense_resource<missing_blob> : tensor<1024xf32>", ctx.get());
+    ASSERT_TRUE(mlir::isa_and_nonnull<mlir::DenseResourceElementsAttr>(baseAttr));
+    const auto contentAttr = Const::ContentAttr::get(mlir::cast<mlir::ElementsAttr>(baseAttr)).add(1.0);
+    EXPECT_FALSE(cache.isCacheable(contentAttr));
+    EXPECT_FALSE(cache.load(contentAttr).has_value());
+    EXPECT_ANY_THROW(cache.getKey(contentAttr));
+}
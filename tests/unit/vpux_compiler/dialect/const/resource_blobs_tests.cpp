@@ -0,0 +1,115 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/compiler/dialect/const/ops.hpp"
+#include "vpux/compiler/dialect/const/passes.hpp"
+#include "vpux/compiler/dialect/const/utils/resource_blobs.hpp"
+#include "vpux/compiler/utils/types.hpp"
+
+#include "common/utils.hpp"
+
+#include <mlir/IR/Builders.h>
+#include <mlir/IR/BuiltinOps.h>
+#include <mlir/IR/MLIRContext.h>
+#include <mlir/Pass/PassManager.h>
+
+#include <gtest/gtest.h>
+
+#include <numeric>
+
+using namespace vpux;
+
+namespace {
+
+mlir::ElementsAttr createContent(mlir::MLIRContext* ctx, int64_t numElements) {
+    const auto type = mlir::RankedTensorType::get({numElements}, getUInt8Type(ctx));
+    return Const::createOwnedContent(type, checked_cast<size_t>(numElements), [](MutableArrayRef<char> buf) {
+        std::iota(buf.begin(), buf.end(), 0);
+    });
+}
+
+}  // namespace
+
+using MLIR_ResourceBlobsTest = MLIR_UnitBase;
+
+TEST_F(MLIR_ResourceBlobsTest, SmallContentIsDense) {
+    mlir::MLIRContext ctx(registry);
+    ctx.loadDialect<Const::ConstDialect>();
+
+    const auto content = createContent(&ctx, Const::OWNED_RESOURCE_MIN_SIZE.count() - 1);
+    ASSERT_TRUE(mlir::isa<mlir::DenseElementsAttr>(content));
+    EXPECT_EQ(mlir::cast<mlir::DenseElementsAttr>(content).getValues<uint8_t>()[10], 10);
+    EXPECT_FALSE(Const::isOwnedContent(content));
+}
+
+TEST_F(MLIR_ResourceBlobsTest, ReleaseUnused) {
+    mlir::MLIRContext ctx(registry);
+    ctx.loadDialect<Const::ConstDialect>();
+
+    const auto numElements = Const::OWNED_RESOURCE_MIN_SIZE.count();
+    const auto usedContent = createContent(&ctx, numElements);
+    const auto unusedContent = createContent(&ctx, numElements);
+    ASSERT_TRUE(mlir::isa<mlir::DenseResourceElementsAttr>(usedContent));
+    ASSERT_TRUE(mlir::isa<mlir::DenseResourceElementsAttr>(unusedContent));
+    // Every owned content gets its own blob, even if the data is the same
+    EXPECT_NE(usedContent, unusedContent);
+
+    auto module = mlir::ModuleOp::create(mlir::UnknownLoc::get(&ctx));
+    auto builder = mlir::OpBuilder::atBlockBegin(module.getBody());
+    auto constOp = builder.create<Const::DeclareOp>(mlir::UnknownLoc::get(&ctx), usedContent.getType(),
+                                                    Const::ContentAttr::get(usedContent));
+
+    EXPECT_EQ(Const::releaseUnusedResources(module).count(), numElements);
+    const auto usedBlob = mlir::cast<mlir::DenseResourceElementsAttr>(usedContent).getRawHandle().getBlob();
+    ASSERT_NE(usedBlob, nullptr);
+    ASSERT_EQ(usedBlob->getData().size(), static_cast<size_t>(numElements));
+    EXPECT_EQ(usedBlob->getData()[10], 10);
+    const auto content = constOp.getContent();
+    EXPECT_EQ(content.getValues<uint8_t>()[10], 10);
+
+    // The blob of the unused content is released only once
+    EXPECT_EQ(Const::releaseUnusedResources(module).count(), 0);
+
+    constOp.erase();
+    EXPECT_EQ(Const::releaseUnusedResources(module).count(), numElements);
+
+    module.erase();
+}
+
+TEST_F(MLIR_ResourceBlobsTest, FoldingKeepsOwnedContent) {
+    mlir::MLIRContext ctx(registry);
+    ctx.loadDialect<Const::ConstDialect>();
+
+    const auto numElements = Const::OWNED_RESOURCE_MIN_SIZE.count();
+    const auto foldedContent = createContent(&ctx, numElements);
+    const auto transformedContent = createContent(&ctx, numElements);
+    EXPECT_TRUE(Const::isOwnedContent(foldedContent));
+    EXPECT_TRUE(Const::isOwnedContent(transformedContent));
+
+    auto module = mlir::ModuleOp::create(mlir::UnknownLoc::get(&ctx));
+    auto builder = mlir::OpBuilder::atBlockBegin(module.getBody());
+    auto foldedOp = builder.create<Const::DeclareOp>(mlir::UnknownLoc::get(&ctx), foldedContent.getType(),
+                                                     Const::ContentAttr::get(foldedContent));
+    const auto transformedAttr = Const::ContentAttr::get(transformedContent).add(1.0);
+    auto transformedOp = builder.create<Const::DeclareOp>(mlir::UnknownLoc::get(&ctx), transformedAttr.getType(),
+                                                          transformedAttr);
+
+    mlir::PassManager pm(module->getName(), mlir::OpPassManager::Nesting::Implicit);
+    pm.addNestedPass<Const::DeclareOp>(Const::createConstantFoldingPass());
+    ASSERT_TRUE(mlir::succeeded(pm.run(module)));
+
+    // Already folded content is not copied again, only the transformed one is replaced by a new blob
+    EXPECT_EQ(foldedOp.getContentAttr().getBaseContent(), foldedContent);
+    EXPECT_TRUE(foldedOp.getContentAttr().getTransformations().empty());
+    EXPECT_NE(transformedOp.getContentAttr().getBaseContent(), transformedContent);
+    EXPECT_TRUE(transformedOp.getContentAttr().getTransformations().empty());
+    EXPECT_EQ(transformedOp.getContent().getValues<uint8_t>()[10], 11);
+
+    EXPECT_EQ(Const::releaseUnusedResources(module).count(), numElements);
+    EXPECT_FALSE(Const::isOwnedContent(transformedContent));
+    EXPECT_TRUE(Const::isOwnedContent(foldedOp.getContentAttr().getBaseContent()));
+
+    module.erase();
+}
@@ -36,3 +36,19 @@ std::vector<SubByteUnpackingParams> getConstBufferParams = {
 // clang-format on
 
 INSTANTIATE_TEST_CASE_P(Unit, SubByteUnpackingTests, testing::ValuesIn(getConstBufferParams));
+
+TEST(SubByteTests, unpackSubByte) {
+    const mlir::SmallVector<char> packedData = {0x10, 0x32, 0x04};
+    mlir::SmallVector<char> actualData(5);
+    vpux::Const::unpackSubByte(packedData, 4, actualData);
+    EXPECT_EQ(actualData, mlir::SmallVector<char>({0x0, 0x1, 0x2, 0x3, 0x4}));
+    EXPECT_EQ(vpux::Const::getPackedSize(4, 5), 3);
+}
+
+TEST(SubByteTests, isSubByteSplat) {
+    EXPECT_TRUE(vpux::Const::isSubByteSplat({0x55, 0x55}, 4, 4));
+    EXPECT_TRUE(vpux::Const::isSubByteSplat({0x55, 0x05}, 4, 3));
+    EXPECT_FALSE(vpux::Const::isSubByteSplat({0x55, 0x15}, 4, 4));
+    EXPECT_FALSE(vpux::Const::isSubByteSplat({0x55, 0x16}, 4, 3));
+    EXPECT_TRUE(vpux::Const::isSubByteSplat({-0x1, 0x3}, 2, 5));
+}
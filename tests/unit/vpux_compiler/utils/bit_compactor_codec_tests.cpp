@@ -0,0 +1,105 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/compiler/bitc/bitc.hpp"
+#include "vpux/compiler/utils/bit_compactor_codec.hpp"
+
+#include <mlir/IR/MLIRContext.h>
+#include <mlir/IR/Threading.h>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+using namespace vpux;
+
+namespace {
+
+// Weight-like data: values clustered around a few levels with runs of zeros. The generator is fixed, so that the
+// data does not depend on the standard library implementation
+std::vector<uint8_t> generateWeights(size_t size, uint32_t seed) {
+    std::vector<uint8_t> data(size);
+    uint32_t state = seed;
+    for (auto& value : data) {
+        state = state * 1664525u + 1013904223u;
+        const auto random = state >> 16;
+        value = (random % 7 == 0) ? 0 : static_cast<uint8_t>(0x70 + (random >> 3) % 32);
+    }
+    return data;
+}
+
+std::vector<uint8_t> encode(bitc::ArchType arch, bool fp16, const bitc::ParallelFor& parallelFor,
+                            const std::vector<uint8_t>& data) {
+    bitc::BitCompactorConfig config;
+    config.arch_type = arch;
+    config.mode_fp16_enable = fp16;
+    config.parallel_for = parallelFor;
+
+    std::vector<uint8_t> out;
+    bitc::Encoder{}.encode(config, data, out);
+    return out;
+}
+
+// Runs the tasks serially in the reverse order, which the output must not depend on
+void reverseFor(size_t numTasks, const std::function<void(size_t)>& task) {
+    for (size_t idx = numTasks; idx-- > 0;) {
+        task(idx);
+    }
+}
+
+bitc::ParallelFor makeContextFor(mlir::MLIRContext& ctx) {
+    return [&ctx](size_t numTasks, const std::function<void(size_t)>& task) {
+        mlir::parallelFor(&ctx, 0, numTasks, task);
+    };
+}
+
+// Large enough for the encoder to split the blocks into several tasks, with an incomplete last block
+constexpr size_t PARALLEL_DATA_SIZE = 4 * 1024 * 64 * 2 + 37;
+
+}  // namespace
+
+TEST(MLIR_BitCompactorEncoder, ParallelOutputIsIdentical) {
+    mlir::MLIRContext ctx;
+    const auto data = generateWeights(PARALLEL_DATA_SIZE, 42);
+
+    for (const auto arch : {bitc::ArchType::NPU27, bitc::ArchType::NPU4}) {
+        for (const auto fp16 : {false, true}) {
+            if (fp16 && arch == bitc::ArchType::NPU27) {
+                continue;
+            }
+
+            const auto serial = encode(arch, fp16, nullptr, data);
+            ASSERT_FALSE(serial.empty());
+            EXPECT_LT(serial.size(), data.size());
+            EXPECT_EQ(encode(arch, fp16, reverseFor, data), serial)
+                    << "arch " << static_cast<uint32_t>(arch) << ", fp16 " << fp16 << ", reverse order";
+            EXPECT_EQ(encode(arch, fp16, makeContextFor(ctx), data), serial)
+                    << "arch " << static_cast<uint32_t>(arch) << ", fp16 " << fp16 << ", context thread pool";
+        }
+    }
+}
+
+TEST(MLIR_BitCompactorCodec, ParallelOutputIsIdentical) {
+    mlir::MLIRContext ctx;
+    for (const auto arch : {VPU::ArchKind::NPU37XX, VPU::ArchKind::NPU40XX}) {
+        const BitCompactorCodec serialCodec(arch);
+        const BitCompactorCodec parallelCodec(arch, makeContextFor(ctx));
+
+        for (const auto mode : {ICodec::CompressionMode::UINT8, ICodec::CompressionMode::FP16}) {
+            if (mode == ICodec::CompressionMode::FP16 && !serialCodec.supportsFP16compression()) {
+                continue;
+            }
+
+            auto data = generateWeights(PARALLEL_DATA_SIZE, 7);
+            const auto serial = serialCodec.compress(data, mode, Logger::global());
+            const auto parallel = parallelCodec.compress(data, mode, Logger::global());
+            ASSERT_TRUE(mlir::succeeded(serial));
+            ASSERT_TRUE(mlir::succeeded(parallel));
+            EXPECT_EQ(parallel.value(), serial.value());
+        }
+    }
+}
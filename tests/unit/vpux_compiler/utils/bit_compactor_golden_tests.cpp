@@ -0,0 +1,201 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/compiler/bitc/bitc.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+using namespace vpux;
+
+namespace {
+
+// Blocks of the patterns the predictors are made for, with an incomplete last block. The generator is fixed, so
+// that the data does not depend on the standard library implementation
+std::vector<uint8_t> generateData(size_t size, uint32_t seed) {
+    constexpr size_t BLOCK_SIZE = 64;
+    constexpr size_t PATTERNS = 7;
+
+    std::vector<uint8_t> data(size);
+    uint32_t state = seed;
+    const auto next = [&] {
+        state = state * 1664525u + 1013904223u;
+        return state >> 16;
+    };
+
+    for (size_t i = 0; i < size; ++i) {
+        const auto offset = i % BLOCK_SIZE;
+        const auto random = next();
+        switch (i / BLOCK_SIZE % PATTERNS) {
+        case 0:  // Uncompressible
+            data[i] = static_cast<uint8_t>(random);
+            break;
+        case 1:  // Constant
+            data[i] = 0x37;
+            break;
+        case 2:  // Ramp
+            data[i] = static_cast<uint8_t>(0x10 + offset * 3);
+            break;
+        case 3:  // Small signed values
+            data[i] = static_cast<uint8_t>(static_cast<int8_t>(random % 9) - 4);
+            break;
+        case 4:  // Previous block with noise
+            data[i] = static_cast<uint8_t>(data[i - BLOCK_SIZE] + random % 3);
+            break;
+        case 5:  // Sparse weights around a zero point
+            data[i] = random % 5 == 0 ? static_cast<uint8_t>(0x70 + (random >> 3) % 32) : 0x80;
+            break;
+        default:  // FP16 values in [-2, 2]
+            data[i] = offset % 2 == 0 ? static_cast<uint8_t>(random)
+                                      : static_cast<uint8_t>((random & 0x80) | 0x38 | (random >> 8) % 8);
+            break;
+        }
+    }
+    return data;
+}
+
+// FNV-1a, the large golden streams are kept as their size and hash
+uint64_t getHash(const std::vector<uint8_t>& data) {
+    uint64_t hash = 14695981039346656037ull;
+    for (const auto value : data) {
+        hash = (hash ^ value) * 1099511628211ull;
+    }
+    return hash;
+}
+
+struct GoldenStream {
+    const char* name;
+    bitc::ArchType arch;
+    bool fp16;
+    const std::vector<uint8_t>* smallStream;
+    size_t largeSize;
+    uint64_t largeHash;
+};
+
+constexpr size_t SMALL_DATA_SIZE = 7 * 64 + 22;
+constexpr size_t LARGE_DATA_SIZE = 64 * 1024 + 22;
+
+// Output of the encoder for generateData(SMALL_DATA_SIZE, 1), NPU37XX u8 weights
+const std::vector<uint8_t> GOLDEN_NPU37XX_U8 = {
+        0x22, 0x22, 0x5a, 0xcc, 0xc1, 0x63, 0x5a, 0x89, 0xe1, 0x94, 0x76, 0x80, 0xdc, 0x04, 0xb5, 0x60,
+        0x8c, 0xb9, 0xfe, 0x36, 0x1c, 0x09, 0x3f, 0x88, 0xee, 0x38, 0xe0, 0x68, 0x40, 0xed, 0x08, 0x85,
+        0x29, 0xd6, 0xea, 0x31, 0x4d, 0x35, 0x0e, 0x78, 0xb4, 0x64, 0xae, 0x36, 0xa1, 0x7a, 0x03, 0x10,
+        0x52, 0xc2, 0x90, 0xa6, 0xe7, 0x61, 0x7c, 0x87, 0x12, 0xdd, 0xd3, 0x49, 0x12, 0xa9, 0xd9, 0xa6,
+        0xbd, 0x74, 0xc4, 0x4d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x40, 0x88, 0x09, 0x8b, 0x0c, 0x8e, 0x0f, 0x91, 0x12, 0x94, 0x15, 0x97,
+        0x18, 0x9a, 0x1b, 0x9d, 0x1e, 0xa0, 0x21, 0xa3, 0x24, 0xa6, 0x27, 0xa9, 0x2a, 0xac, 0x2d, 0xaf,
+        0x30, 0xb2, 0x33, 0xb5, 0x36, 0xb8, 0x39, 0xbb, 0x3c, 0xbe, 0x3f, 0xc1, 0x42, 0xc4, 0x45, 0xc7,
+        0x48, 0xca, 0x4b, 0xcd, 0x4e, 0xd0, 0x51, 0xd3, 0x54, 0xd6, 0x57, 0xd9, 0x5a, 0xdc, 0x5d, 0xdf,
+        0x60, 0xe2, 0x63, 0xe5, 0xe6, 0x43, 0x20, 0xac, 0x10, 0xd1, 0x2c, 0xa2, 0x4c, 0x50, 0xc6, 0xe4,
+        0x2a, 0x00, 0x0d, 0x61, 0x10, 0x8a, 0x70, 0xae, 0x48, 0x62, 0x08, 0x69, 0xa4, 0x68, 0x4e, 0x0e,
+        0x0a, 0x00, 0xa4, 0xaa, 0x62, 0x0a, 0x0e, 0xa1, 0xd0, 0x42, 0x56, 0x35, 0x89, 0x52, 0x43, 0x02,
+        0xa4, 0x2a, 0x21, 0x34, 0x84, 0x50, 0x1a, 0x62, 0x98, 0x30, 0x11, 0x30, 0x24, 0xb0, 0xa1, 0x29,
+        0x2b, 0x19, 0x22, 0x90, 0x99, 0x90, 0x08, 0x58, 0xe9, 0x0f, 0x40, 0x00, 0x00, 0x00, 0x2c, 0x83,
+        0x04, 0x80, 0x08, 0x00, 0x00, 0x00, 0x64, 0x74, 0x20, 0xc0, 0x21, 0x02, 0x4c, 0xd0, 0x00, 0x00,
+        0x08, 0xc0, 0x80, 0xab, 0xb8, 0x57, 0xbf, 0x98, 0xb8, 0x01, 0xbb, 0x4c, 0xbe, 0x04, 0x3d, 0x56,
+        0x3a, 0x9c, 0xba, 0x64, 0x39, 0xf9, 0x38, 0xbb, 0x3d, 0xd0, 0x3f, 0xe8, 0x3c, 0x33, 0xbb, 0xb7,
+        0xbf, 0xa3, 0xba, 0x62, 0x3f, 0x65, 0xbf, 0x0b, 0xb9, 0x12, 0x3c, 0x6c, 0x3a, 0x73, 0x3c, 0xce,
+        0xb8, 0x8d, 0x3a, 0x39, 0xb9, 0xf8, 0xbf, 0xec, 0x3d, 0x76, 0xba, 0x0d, 0xb9, 0xc1, 0xb8, 0xa2,
+        0x3f, 0xa5, 0xbb, 0x59, 0xc0, 0xaa, 0x50, 0x9e, 0x03, 0xe1, 0xe6, 0x31, 0x3f, 0xd5, 0x59, 0x7a,
+        0x76, 0x56, 0x79, 0x81, 0x0b, 0xa2, 0x48, 0x65, 0x36, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+// Output of the encoder for generateData(SMALL_DATA_SIZE, 1), NPU40XX u8 weights
+const std::vector<uint8_t> GOLDEN_NPU40XX_U8 = {
+        0x02, 0x88, 0x88, 0x16, 0x73, 0xf0, 0x98, 0x56, 0x62, 0x38, 0xa5, 0x1d, 0x20, 0x37, 0x41, 0x2d,
+        0x18, 0x63, 0xae, 0xbf, 0x0d, 0x47, 0xc2, 0x0f, 0xa2, 0x3b, 0x0e, 0x38, 0x1a, 0x50, 0x3b, 0x42,
+        0x61, 0x8a, 0xb5, 0x7a, 0x4c, 0x53, 0x8d, 0x03, 0x1e, 0x2d, 0x99, 0xab, 0x4d, 0xa8, 0xde, 0x00,
+        0x84, 0x94, 0x30, 0xa4, 0xe9, 0x79, 0x18, 0xdf, 0xa1, 0x44, 0xf7, 0x74, 0x92, 0x44, 0x6a, 0xb6,
+        0x69, 0x6f, 0x00, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10, 0x13, 0x16,
+        0x19, 0x1c, 0x1f, 0x22, 0x25, 0x28, 0x2b, 0x2e, 0x31, 0x34, 0x37, 0x3a, 0x3d, 0x40, 0x43, 0x46,
+        0x49, 0x4c, 0x4f, 0x52, 0x55, 0x58, 0x5b, 0x5e, 0x61, 0x64, 0x67, 0x6a, 0x6d, 0x70, 0x73, 0x76,
+        0x79, 0x7c, 0x7f, 0x82, 0x85, 0x88, 0x8b, 0x8e, 0x91, 0x94, 0x97, 0x9a, 0x9d, 0xa0, 0xa3, 0xa6,
+        0xa9, 0xac, 0xaf, 0xb2, 0xb5, 0xb8, 0xbb, 0xbe, 0xc1, 0xc4, 0xc7, 0xca, 0xcd, 0x87, 0x00, 0x10,
+        0x56, 0x88, 0x68, 0x16, 0x51, 0x26, 0x28, 0x63, 0x72, 0x15, 0x80, 0x86, 0x30, 0x08, 0x45, 0x38,
+        0x57, 0x24, 0x31, 0x84, 0x34, 0x52, 0x34, 0x27, 0x07, 0x05, 0x00, 0x52, 0x55, 0x31, 0x05, 0x73,
+        0x00, 0x04, 0x01, 0x8a, 0x20, 0x40, 0x42, 0x94, 0x04, 0x12, 0x00, 0x24, 0x0a, 0x24, 0x29, 0x90,
+        0x02, 0x48, 0x01, 0xa2, 0x24, 0x12, 0x90, 0x48, 0x11, 0x4b, 0xd9, 0x02, 0x80, 0x00, 0x00, 0x00,
+        0x58, 0x06, 0x09, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x46, 0x07, 0x04, 0xe0,
+        0x10, 0x01, 0xc0, 0x04, 0x34, 0x00, 0x00, 0x00, 0x20, 0x00, 0x18, 0x00, 0x02, 0xab, 0xb8, 0x57,
+        0xbf, 0x98, 0xb8, 0x01, 0xbb, 0x4c, 0xbe, 0x04, 0x3d, 0x56, 0x3a, 0x9c, 0xba, 0x64, 0x39, 0xf9,
+        0x38, 0xbb, 0x3d, 0xd0, 0x3f, 0xe8, 0x3c, 0x33, 0xbb, 0xb7, 0xbf, 0xa3, 0xba, 0x62, 0x3f, 0x65,
+        0xbf, 0x0b, 0xb9, 0x12, 0x3c, 0x6c, 0x3a, 0x73, 0x3c, 0xce, 0xb8, 0x8d, 0x3a, 0x39, 0xb9, 0xf8,
+        0xbf, 0xec, 0x3d, 0x76, 0xba, 0x0d, 0xb9, 0xc1, 0xb8, 0xa2, 0x3f, 0xa5, 0xbb, 0x59, 0xc0, 0xaa,
+        0x50, 0x9e, 0x03, 0xe1, 0xe6, 0x31, 0x3f, 0xd5, 0x59, 0x7a, 0x76, 0x56, 0x79, 0x81, 0x0b, 0xa2,
+        0x48, 0x65, 0x36, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+// Output of the encoder for generateData(SMALL_DATA_SIZE, 1), NPU40XX fp16 weights
+const std::vector<uint8_t> GOLDEN_NPU40XX_FP16 = {
+        0x4b, 0xd1, 0x04, 0x6e, 0xbf, 0xff, 0xff, 0x7f, 0x00, 0x00, 0x00, 0x00, 0xb9, 0x83, 0xe6, 0x7c,
+        0x06, 0x67, 0x9c, 0xc8, 0x82, 0x08, 0x75, 0x42, 0x10, 0x90, 0xb1, 0xc4, 0xce, 0xcb, 0x3d, 0x97,
+        0xbc, 0xe4, 0x64, 0x2f, 0x26, 0xdd, 0x8b, 0xda, 0xd8, 0xd3, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x53, 0xe9, 0x04, 0xfe, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x2c, 0x82,
+        0xc2, 0x34, 0x31, 0xa0, 0x4c, 0x55, 0x17, 0x57, 0x28, 0xcd, 0xde, 0x4d, 0xf1, 0xb1, 0xde, 0x9a,
+        0xb3, 0x45, 0x29, 0x62, 0x3b, 0xc8, 0xad, 0xf3, 0xdd, 0x2b, 0xdb, 0x61, 0x3a, 0x03, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0x31, 0x06, 0xff, 0xff, 0xf3, 0xff, 0x8c, 0x40, 0x01,
+        0x00, 0x40, 0x58, 0x70, 0x88, 0xa0, 0xb8, 0xd0, 0xe8, 0xff, 0xe7, 0xcf, 0xb7, 0x9f, 0x87, 0x6f,
+        0x57, 0x3f, 0x27, 0xaf, 0x22, 0x3a, 0x52, 0x6a, 0x82, 0x9a, 0xb2, 0xca, 0xe2, 0xfa, 0xed, 0xd5,
+        0xe2, 0x10, 0x10, 0x1e, 0x0c, 0x71, 0x96, 0xc0, 0x02, 0xb1, 0x12, 0x8d, 0x81, 0x6a, 0xfa, 0xbf,
+        0x60, 0x19, 0x0b, 0xb3, 0x00, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x8c,
+        0x31, 0xc6, 0x18, 0x63, 0x8c, 0x31, 0xc6, 0x18, 0x63, 0x25, 0x83, 0x11, 0xcf, 0x59, 0xb6, 0x22,
+        0x48, 0xd2, 0xb3, 0x99, 0x8c, 0x81, 0x62, 0x8c, 0x56, 0x3a, 0x10, 0xc1, 0x70, 0x8b, 0x81, 0x04,
+        0x04, 0x00, 0x04, 0x01, 0x03, 0x00, 0x40, 0x12, 0x40, 0xe2, 0xc8, 0x94, 0x8c, 0x27, 0x13, 0x40,
+        0xc5, 0x0f, 0xd1, 0x34, 0x04, 0x26, 0x13, 0x13, 0x0f, 0xd1, 0xb1, 0x55, 0x55, 0x55, 0x55, 0x55,
+        0x55, 0x75, 0x41, 0x52, 0x29, 0x55, 0x2d, 0x57, 0x55, 0x55, 0xa5, 0xa5, 0x52, 0x47, 0x59, 0x04,
+        0xfe, 0xdf, 0xd4, 0x17, 0x00, 0x20, 0x21, 0x00, 0x2f, 0x60, 0x50, 0x10, 0x24, 0x30, 0x20, 0x40,
+        0x2c, 0x18, 0x40, 0x40, 0x8c, 0xa0, 0x40, 0x04, 0x40, 0x70, 0x70, 0xe0, 0x60, 0xa0, 0xc0, 0x41,
+        0xab, 0xaa, 0xaa, 0x6a, 0x0c, 0x7a, 0xa0, 0x64, 0xa8, 0xaa, 0x2a, 0x02, 0xab, 0xb8, 0x57, 0xbf,
+        0x98, 0xb8, 0x01, 0xbb, 0x4c, 0xbe, 0x04, 0x3d, 0x56, 0x3a, 0x9c, 0xba, 0x64, 0x39, 0xf9, 0x38,
+        0xbb, 0x3d, 0xd0, 0x3f, 0xe8, 0x3c, 0x33, 0xbb, 0xb7, 0xbf, 0xa3, 0xba, 0x62, 0x3f, 0x65, 0xbf,
+        0x0b, 0xb9, 0x12, 0x3c, 0x6c, 0x3a, 0x73, 0x3c, 0xce, 0xb8, 0x8d, 0x3a, 0x39, 0xb9, 0xf8, 0xbf,
+        0xec, 0x3d, 0x76, 0xba, 0x0d, 0xb9, 0xc1, 0xb8, 0xa2, 0x3f, 0xa5, 0xbb, 0x59, 0xc0, 0xaa, 0x50,
+        0x9e, 0x03, 0xe1, 0xe6, 0x31, 0x3f, 0xd5, 0x59, 0x7a, 0x76, 0x56, 0x79, 0x81, 0x0b, 0xa2, 0x48,
+        0x65, 0x36, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+const GoldenStream GOLDEN_STREAMS[] = {
+        {"NPU37XX u8", bitc::ArchType::NPU27, false, &GOLDEN_NPU37XX_U8, 45312, 0xe278bf9d08e413c9ull},
+        {"NPU40XX u8", bitc::ArchType::NPU4, false, &GOLDEN_NPU40XX_U8, 46656, 0x5a17248996ac4094ull},
+        {"NPU40XX fp16", bitc::ArchType::NPU4, true, &GOLDEN_NPU40XX_FP16, 52064, 0x265031a488c47651ull},
+};
+
+std::vector<uint8_t> encode(const GoldenStream& golden, bitc::KernelType kernelType, const std::vector<uint8_t>& data) {
+    bitc::BitCompactorConfig config;
+    config.arch_type = golden.arch;
+    config.mode_fp16_enable = golden.fp16;
+    config.kernel_type = kernelType;
+
+    std::vector<uint8_t> out;
+    bitc::Encoder{}.encode(config, data, out);
+    return out;
+}
+
+}  // namespace
+
+// The golden streams come from the encoder before the block kernels were introduced, the decoders in the DMA engines
+// rely on the exact stream. SIMD runs the scalar kernels too where SSE2 is not available
+TEST(MLIR_BitCompactorEncoder, MatchesGoldenStreams) {
+    const auto smallData = generateData(SMALL_DATA_SIZE, 1);
+    const auto largeData = generateData(LARGE_DATA_SIZE, 2);
+
+    for (const auto& golden : GOLDEN_STREAMS) {
+        for (const auto kernelType : {bitc::KernelType::SIMD, bitc::KernelType::SCALAR}) {
+            SCOPED_TRACE(testing::Message() << golden.name
+                                            << (kernelType == bitc::KernelType::SIMD ? " SIMD" : " SCALAR"));
+
+            EXPECT_EQ(encode(golden, kernelType, smallData), *golden.smallStream);
+
+            const auto largeStream = encode(golden, kernelType, largeData);
+            EXPECT_EQ(largeStream.size(), golden.largeSize);
+            EXPECT_EQ(getHash(largeStream), golden.largeHash);
+        }
+    }
+}
@@ -0,0 +1,49 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/compiler/utils/ELF/blob_sink.hpp"
+
+#include <gtest/gtest.h>
+
+#include <numeric>
+
+using namespace vpux;
+
+namespace {
+
+std::vector<uint8_t> generateBlob(size_t size) {
+    std::vector<uint8_t> blob(size);
+    std::iota(blob.begin(), blob.end(), static_cast<uint8_t>(0));
+    return blob;
+}
+
+}  // namespace
+
+TEST(MLIR_ELFBlobSink, VectorSink) {
+    const auto blob = generateBlob(1000);
+
+    std::vector<uint8_t> storage;
+    ELF::VectorBlobSink sink(storage);
+    ELF::streamToSink(blob, sink);
+
+    EXPECT_EQ(storage, blob);
+}
+
+TEST(MLIR_ELFBlobSink, CallbackSinkChunks) {
+    const auto blob = generateBlob(1000);
+
+    std::vector<size_t> chunkSizes;
+    std::vector<uint8_t> storage;
+    ELF::CallbackBlobSink sink(
+            [&](ArrayRef<uint8_t> chunk) {
+                chunkSizes.push_back(chunk.size());
+                storage.insert(storage.end(), chunk.begin(), chunk.end());
+            },
+            /*chunkSize=*/300);
+    ELF::streamToSink(blob, sink);
+
+    EXPECT_EQ(chunkSizes, std::vector<size_t>({300, 300, 300, 100}));
+    EXPECT_EQ(storage, blob);
+}
@@ -0,0 +1,89 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/compiler/utils/pass_flight_recorder.hpp"
+
+#include "common/utils.hpp"
+
+#include <mlir/Dialect/Func/IR/FuncOps.h>
+#include <mlir/IR/MLIRContext.h>
+#include <mlir/Parser/Parser.h>
+#include <mlir/Pass/PassManager.h>
+#include <mlir/Transforms/Passes.h>
+
+#include <llvm/Support/JSON.h>
+
+#include <gtest/gtest.h>
+
+using namespace vpux;
+
+namespace {
+
+constexpr llvm::StringLiteral inputIR = R"(
+        module @Test {
+            func.func @main(%arg0: tensor<1x48x60x60xf32>) -> tensor<1x48x60x60xf32> {
+                %cst = const.Declare tensor<1x48x1x1xf32> = dense<1.000000e+00> : tensor<1x48x1x1xf32>
+                %0 = IE.SoftMax(%arg0) {axisInd = 3 : i64} : tensor<1x48x60x60xf32> -> tensor<1x48x60x60xf32>
+                return %0 : tensor<1x48x60x60xf32>
+            }
+        }
+    )";
+
+}  // namespace
+
+using MLIR_PassFlightRecorder = MLIR_UnitBase;
+
+TEST_F(MLIR_PassFlightRecorder, RecordPasses) {
+    mlir::MLIRContext ctx(registry);
+    ctx.disableMultithreading();
+
+    auto module = mlir::parseSourceString<mlir::ModuleOp>(inputIR, &ctx);
+    ASSERT_TRUE(module.get() != nullptr);
+
+    PassFlightRecorder recorder;
+
+    mlir::PassManager pm(module.get()->getName(), mlir::OpPassManager::Nesting::Implicit);
+    recorder.attach(pm, "test");
+    pm.addNestedPass<mlir::func::FuncOp>(mlir::createCanonicalizerPass());
+    pm.addPass(mlir::createCSEPass());
+    ASSERT_TRUE(mlir::succeeded(pm.run(module.get())));
+
+    const auto records = recorder.getRecords();
+    const auto canonicalizerRecord = llvm::find_if(records, [](const PassFlightRecorder::Record& record) {
+        return record.passArgument == "canonicalize";
+    });
+    ASSERT_NE(canonicalizerRecord, records.end());
+    EXPECT_EQ(canonicalizerRecord->pipelineName, "test");
+    EXPECT_EQ(canonicalizerRecord->anchorName, "func.func");
+    EXPECT_FALSE(canonicalizerRecord->failed);
+    EXPECT_GT(canonicalizerRecord->numOpsBefore, 0u);
+    EXPECT_GE(canonicalizerRecord->numOpsBefore, canonicalizerRecord->numOpsAfter);
+    EXPECT_GT(canonicalizerRecord->peakRssKB, 0);
+
+    const auto cseRecord = llvm::find_if(records, [](const PassFlightRecorder::Record& record) {
+        return record.passArgument == "cse";
+    });
+    ASSERT_NE(cseRecord, records.end());
+    EXPECT_EQ(cseRecord->anchorName, "builtin.module");
+    EXPECT_GE(cseRecord->startTime, canonicalizerRecord->startTime + canonicalizerRecord->wallTime);
+
+    std::string report;
+    llvm::raw_string_ostream os(report);
+    recorder.printReport(os);
+    os.flush();
+
+    auto json = llvm::json::parse(report);
+    ASSERT_TRUE(static_cast<bool>(json)) << llvm::toString(json.takeError());
+    const auto* root = json->getAsObject();
+    ASSERT_NE(root, nullptr);
+
+    const auto* traceEvents = root->getArray("traceEvents");
+    ASSERT_NE(traceEvents, nullptr);
+    EXPECT_EQ(traceEvents->size(), records.size());
+
+    const auto* passSummary = root->getArray("passSummary");
+    ASSERT_NE(passSummary, nullptr);
+    EXPECT_EQ(passSummary->size(), 2u);
+}
@@ -0,0 +1,57 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+//
+
+#include "vpux/utils/core/flat_map.hpp"
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <random>
+#include <string>
+
+using namespace vpux;
+
+TEST(MLIR_FlatMap, MatchesStdMap) {
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<int> dist(0, 50);
+
+    FlatMap<int, int> map;
+    std::map<int, int> reference;
+    for (int iter = 0; iter < 500; ++iter) {
+        const auto key = dist(gen);
+        if (iter % 4 == 3) {
+            EXPECT_EQ(map.erase(key), reference.erase(key));
+            continue;
+        }
+        map[key] += iter;
+        reference[key] += iter;
+    }
+
+    ASSERT_EQ(map.size(), reference.size());
+    auto refIt = reference.begin();
+    for (const auto& entry : map) {
+        EXPECT_EQ(entry.first, refIt->first);
+        EXPECT_EQ(entry.second, refIt->second);
+        ++refIt;
+    }
+
+    for (int key = 0; key <= 50; ++key) {
+        EXPECT_EQ(map.count(key), reference.count(key));
+        EXPECT_EQ(map.find(key) != map.end(), reference.find(key) != reference.end());
+    }
+}
+
+TEST(MLIR_FlatMap, InitializerList) {
+    const FlatMap<int, std::string> map = {{3, "c"}, {1, "a"}, {2, "b"}, {1, "d"}};
+
+    ASSERT_EQ(map.size(), 3);
+    EXPECT_EQ(map.begin()->first, 1);
+    EXPECT_EQ(map.begin()->second, "a");
+    EXPECT_EQ(map.at(2), "b");
+    EXPECT_EQ(map.find(4), map.end());
+    EXPECT_THROW(map.at(4), std::out_of_range);
+}
@@ -0,0 +1,162 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/utils/profiling/reports/api.hpp"
+#include "vpux/utils/profiling/reports/columnar.hpp"
+#include "vpux/utils/profiling/tasknames.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace vpux::profiling;
+
+namespace {
+
+TaskInfo makeTask(const std::string& name, const std::string& layerType, TaskInfo::ExecType execType, uint64_t start,
+                  uint64_t duration) {
+    TaskInfo task{};
+    const auto nameLen = name.copy(task.name, sizeof(task.name) - 1);
+    task.name[nameLen] = 0;
+    const auto typeLen = layerType.copy(task.layer_type, sizeof(task.layer_type) - 1);
+    task.layer_type[typeLen] = 0;
+    task.exec_type = execType;
+    task.start_time_ns = start;
+    task.duration_ns = duration;
+    return task;
+}
+
+// Tasks ordered by start time, the names cover variants, original names with the separator and long names
+std::vector<TaskInfo> getTasks() {
+    std::vector<TaskInfo> tasks = {
+            makeTask("conv?t_Convolution/cluster_0", "Convolution", TaskInfo::ExecType::DPU, 100, 50),
+            makeTask("conv?t_Convolution/cluster_0/variant_0", "Convolution", TaskInfo::ExecType::DPU, 100, 20),
+            makeTask("conv?t_Convolution/cluster_1", "Convolution", TaskInfo::ExecType::DPU, 110, 60),
+            makeTask("conv?t_Convolution", "Convolution", TaskInfo::ExecType::DMA, 180, 10),
+            makeTask("Sub?1?t_Subtract/cluster_0", "Subtract", TaskInfo::ExecType::SW, 200, 30),
+            makeTask("input", "", TaskInfo::ExecType::DMA, 0, 15),
+            makeTask(std::string(300, 'x') + "?t_Add", "Add", TaskInfo::ExecType::SW, 250, 5),
+    };
+    tasks[0].active_cycles = 1000;
+    tasks[0].stall_cycles = 20;
+    std::sort(tasks.begin(), tasks.end(), profilingTaskStartTimeComparator<TaskInfo>);
+    return tasks;
+}
+
+std::string writeReport(const std::vector<TaskInfo>& tasks, FreqInfo dpuFreq) {
+    std::ostringstream output(std::ios::binary);
+    printProfilingAsColumnar(tasks, getLayerInfo(tasks), dpuFreq, output);
+    return output.str();
+}
+
+ProfInfo readReport(const std::string& report) {
+    return readProfilingFromColumnar(reinterpret_cast<const uint8_t*>(report.data()), report.size());
+}
+
+}  // namespace
+
+TEST(MLIR_ProfilingColumnar, RoundTrip) {
+    const auto tasks = getTasks();
+    const auto layers = getLayerInfo(tasks);
+    const auto profInfo = readReport(writeReport(tasks, FreqInfo{1300, FreqStatus::VALID}));
+
+    EXPECT_EQ(profInfo.dpuFreq.freqMHz, 1300);
+    EXPECT_EQ(profInfo.dpuFreq.freqStatus, FreqStatus::VALID);
+
+    ASSERT_EQ(profInfo.tasks.size(), tasks.size());
+    for (size_t i = 0; i < tasks.size(); ++i) {
+        const auto& expected = tasks[i];
+        const auto& actual = profInfo.tasks[i];
+        EXPECT_STREQ(actual.name, expected.name);
+        EXPECT_STREQ(actual.layer_type, expected.layer_type);
+        EXPECT_EQ(actual.exec_type, expected.exec_type);
+        EXPECT_EQ(actual.start_time_ns, expected.start_time_ns);
+        EXPECT_EQ(actual.duration_ns, expected.duration_ns);
+        EXPECT_EQ(actual.active_cycles, expected.active_cycles);
+        EXPECT_EQ(actual.stall_cycles, expected.stall_cycles);
+    }
+
+    ASSERT_EQ(profInfo.layers.size(), layers.size());
+    for (size_t i = 0; i < layers.size(); ++i) {
+        const auto& expected = layers[i];
+        const auto& actual = profInfo.layers[i];
+        EXPECT_STREQ(actual.name, expected.name);
+        EXPECT_STREQ(actual.layer_type, expected.layer_type);
+        EXPECT_EQ(actual.status, expected.status);
+        EXPECT_EQ(actual.start_time_ns, expected.start_time_ns);
+        EXPECT_EQ(actual.duration_ns, expected.duration_ns);
+        EXPECT_EQ(actual.dpu_ns, expected.dpu_ns);
+        EXPECT_EQ(actual.sw_ns, expected.sw_ns);
+        EXPECT_EQ(actual.dma_ns, expected.dma_ns);
+    }
+}
+
+TEST(MLIR_ProfilingColumnar, TaskColumnsMatchNameParsing) {
+    const auto tasks = getTasks();
+    const auto layers = getLayerInfo(tasks);
+    const auto report = writeReport(tasks, FreqInfo{});
+    const columnar::ReportView view(reinterpret_cast<const uint8_t*>(report.data()), report.size());
+
+    EXPECT_EQ(view.getHeader().numTasks, tasks.size());
+    EXPECT_EQ(view.getHeader().numLayers, layers.size());
+
+    const auto layerNameIds = view.getColumn<uint32_t>(columnar::ColumnId::TASK_LAYER_NAME_ID);
+    const auto clusters = view.getColumn<int32_t>(columnar::ColumnId::TASK_CLUSTER);
+    ASSERT_EQ(layerNameIds.size(), tasks.size());
+    ASSERT_EQ(clusters.size(), tasks.size());
+
+    const auto layerIds = view.getColumn<uint32_t>(columnar::ColumnId::LAYER_NAME_ID);
+    for (size_t i = 0; i < tasks.size(); ++i) {
+        EXPECT_EQ(view.getString(layerNameIds[i]), getLayerName(tasks[i].name));
+
+        const auto cluster = getClusterFromName(tasks[i].name);
+        EXPECT_EQ(clusters[i], cluster.empty() ? columnar::NO_CLUSTER : std::stoi(cluster));
+
+        // Tasks of the layers reported in LayerInfo refer to the same string as the layer
+        if (getVariantFromName(tasks[i].name).empty()) {
+            EXPECT_NE(std::find(layerIds.begin(), layerIds.end(), layerNameIds[i]), layerIds.end()) << tasks[i].name;
+        }
+    }
+}
+
+TEST(MLIR_ProfilingColumnar, ReaderOverloadWritesSameReport) {
+    const auto tasks = getTasks();
+    const FreqInfo dpuFreq{1300, FreqStatus::SIM};
+
+    TaskInfoReader reader({tasks}, dpuFreq);
+    std::ostringstream output(std::ios::binary);
+    printProfilingAsColumnar(reader, output);
+
+    EXPECT_EQ(output.str(), writeReport(tasks, dpuFreq));
+}
+
+TEST(MLIR_ProfilingColumnar, Empty) {
+    const auto profInfo = readReport(writeReport({}, FreqInfo{}));
+    EXPECT_TRUE(profInfo.tasks.empty());
+    EXPECT_TRUE(profInfo.layers.empty());
+    EXPECT_EQ(profInfo.dpuFreq.freqStatus, FreqStatus::UNKNOWN);
+}
+
+TEST(MLIR_ProfilingColumnar, RejectsInvalidData) {
+    const auto report = writeReport(getTasks(), FreqInfo{});
+
+    EXPECT_ANY_THROW(readReport(report.substr(0, sizeof(columnar::FileHeader) - 1)));
+    EXPECT_ANY_THROW(readReport(report.substr(0, sizeof(columnar::FileHeader) + sizeof(columnar::ColumnDesc))));
+    EXPECT_ANY_THROW(readReport(report.substr(0, report.size() - 1)));
+
+    auto badMagic = report;
+    badMagic[0] = 'X';
+    EXPECT_ANY_THROW(readReport(badMagic));
+
+    auto badVersion = report;
+    const uint32_t version = columnar::VERSION + 1;
+    std::memcpy(badVersion.data() + offsetof(columnar::FileHeader, version), &version, sizeof(version));
+    EXPECT_ANY_THROW(readReport(badVersion));
+}
@@ -0,0 +1,210 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/utils/profiling/parser/api.hpp"
+#include "vpux/utils/profiling/tasknames.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace vpux::profiling;
+
+namespace {
+
+TaskInfo makeTask(const std::string& name, TaskInfo::ExecType execType, uint64_t start, uint64_t duration) {
+    TaskInfo task{};
+    const auto nameLen = name.copy(task.name, sizeof(task.name) - 1);
+    task.name[nameLen] = 0;
+    std::strcpy(task.layer_type, "Convolution");
+    task.exec_type = execType;
+    task.start_time_ns = start;
+    task.duration_ns = duration;
+    return task;
+}
+
+bool operator==(const TaskInfo& lhs, const TaskInfo& rhs) {
+    return std::strcmp(lhs.name, rhs.name) == 0 && std::strcmp(lhs.layer_type, rhs.layer_type) == 0 &&
+           lhs.exec_type == rhs.exec_type && lhs.start_time_ns == rhs.start_time_ns &&
+           lhs.duration_ns == rhs.duration_ns && lhs.task_id == rhs.task_id;
+}
+
+bool operator==(const LayerInfo& lhs, const LayerInfo& rhs) {
+    return std::strcmp(lhs.name, rhs.name) == 0 && std::strcmp(lhs.layer_type, rhs.layer_type) == 0 &&
+           lhs.status == rhs.status && lhs.start_time_ns == rhs.start_time_ns && lhs.duration_ns == rhs.duration_ns &&
+           lhs.dpu_ns == rhs.dpu_ns && lhs.sw_ns == rhs.sw_ns && lhs.dma_ns == rhs.dma_ns;
+}
+
+// Per-engine tasks ordered by start time, with overlapping and equal start times across the engines. The task ids tell
+// apart the tasks which are equal for profilingTaskStartTimeComparator
+std::vector<std::vector<TaskInfo>> generateEngineTasks() {
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<uint64_t> startDist(0, 200);
+    std::uniform_int_distribution<uint64_t> durationDist(1, 50);
+    std::uniform_int_distribution<int> layerDist(0, 9);
+    std::uniform_int_distribution<int> clusterDist(0, 1);
+
+    const std::vector<TaskInfo::ExecType> engines = {TaskInfo::ExecType::DPU, TaskInfo::ExecType::DMA,
+                                                     TaskInfo::ExecType::SW, TaskInfo::ExecType::M2I};
+    std::vector<std::vector<TaskInfo>> engineTasks;
+    uint32_t taskId = 0;
+    for (const auto execType : engines) {
+        auto& tasks = engineTasks.emplace_back();
+        for (int i = 0; i < 100; ++i) {
+            auto name = "layer_" + std::to_string(layerDist(gen)) + "?t_Convolution/cluster_" +
+                        std::to_string(clusterDist(gen));
+            if (execType == TaskInfo::ExecType::DPU && i % 3 == 0) {
+                name += "/variant_" + std::to_string(i % 2);
+            }
+            auto& task = tasks.emplace_back(makeTask(name, execType, startDist(gen), durationDist(gen)));
+            task.task_id = taskId++;
+        }
+        std::sort(tasks.begin(), tasks.end(), profilingTaskStartTimeComparator<TaskInfo>);
+    }
+    return engineTasks;
+}
+
+// getTaskInfo used to concatenate the engines and sort the result
+std::vector<TaskInfo> getReferenceTaskInfo(const std::vector<std::vector<TaskInfo>>& engineTasks) {
+    std::vector<TaskInfo> allTasks;
+    for (const auto& tasks : engineTasks) {
+        allTasks.insert(allTasks.end(), tasks.begin(), tasks.end());
+    }
+    std::stable_sort(allTasks.begin(), allTasks.end(), profilingTaskStartTimeComparator<TaskInfo>);
+    return allTasks;
+}
+
+// getLayerInfo used to look the layers up with a linear search
+std::vector<LayerInfo> getReferenceLayerInfo(const std::vector<TaskInfo>& taskInfo) {
+    std::vector<LayerInfo> layerInfo;
+    for (const auto& task : taskInfo) {
+        if (!getVariantFromName(task.name).empty()) {
+            continue;
+        }
+
+        const auto layerName = getLayerName(task.name);
+        auto layer = std::find_if(layerInfo.begin(), layerInfo.end(), [&](const LayerInfo& item) {
+            return layerName == item.name;
+        });
+        if (layer == layerInfo.end()) {
+            layer = layerInfo.insert(layerInfo.end(), LayerInfo{});
+            layer->status = LayerInfo::layer_status_t::EXECUTED;
+            layer->start_time_ns = task.start_time_ns;
+            layer->duration_ns = 0;
+            std::strcpy(layer->name, layerName.c_str());
+            std::strcpy(layer->layer_type, task.layer_type);
+        }
+        if (task.start_time_ns < layer->start_time_ns) {
+            layer->duration_ns += layer->start_time_ns - task.start_time_ns;
+            layer->start_time_ns = task.start_time_ns;
+        }
+        const auto duration = task.start_time_ns + task.duration_ns - layer->start_time_ns;
+        if (duration > layer->duration_ns) {
+            layer->duration_ns = duration;
+        }
+
+        if (task.exec_type == TaskInfo::ExecType::DPU) {
+            layer->dpu_ns += task.duration_ns;
+        } else if (task.exec_type == TaskInfo::ExecType::SW || task.exec_type == TaskInfo::ExecType::UPA) {
+            layer->sw_ns += task.duration_ns;
+        } else if (task.exec_type == TaskInfo::ExecType::DMA) {
+            layer->dma_ns += task.duration_ns;
+        }
+    }
+
+    std::sort(layerInfo.begin(), layerInfo.end(), profilingTaskStartTimeComparator<LayerInfo>);
+    return layerInfo;
+}
+
+std::vector<TaskInfo> readAll(TaskInfoReader& reader) {
+    std::vector<TaskInfo> tasks;
+    while (const auto* task = reader.next()) {
+        tasks.push_back(*task);
+    }
+    return tasks;
+}
+
+}  // namespace
+
+TEST(MLIR_ProfilingTaskInfoReader, MatchesConcatenatedSort) {
+    const auto engineTasks = generateEngineTasks();
+    const auto reference = getReferenceTaskInfo(engineTasks);
+
+    TaskInfoReader reader(engineTasks);
+    EXPECT_EQ(reader.size(), reference.size());
+
+    const auto tasks = readAll(reader);
+    ASSERT_EQ(tasks.size(), reference.size());
+    for (size_t i = 0; i < tasks.size(); ++i) {
+        EXPECT_TRUE(tasks[i] == reference[i]) << "Task #" << i << " differs: " << tasks[i].name << " vs "
+                                              << reference[i].name;
+    }
+    EXPECT_EQ(reader.next(), nullptr);
+    EXPECT_EQ(reader.size(), reference.size());
+}
+
+TEST(MLIR_ProfilingTaskInfoReader, EqualTasksFollowEngineOrder) {
+    const auto dpuTask = makeTask("layer?t_Convolution/cluster_0", TaskInfo::ExecType::DPU, 10, 5);
+    auto dmaTask = dpuTask;
+    dmaTask.exec_type = TaskInfo::ExecType::DMA;
+
+    TaskInfoReader reader({{}, {dmaTask}, {dpuTask}, {}});
+    const auto tasks = readAll(reader);
+    ASSERT_EQ(tasks.size(), 2);
+    EXPECT_EQ(tasks[0].exec_type, TaskInfo::ExecType::DMA);
+    EXPECT_EQ(tasks[1].exec_type, TaskInfo::ExecType::DPU);
+}
+
+TEST(MLIR_ProfilingTaskInfoReader, Empty) {
+    TaskInfoReader reader(std::vector<std::vector<TaskInfo>>{{}, {}}, FreqInfo{1300, FreqStatus::VALID});
+    EXPECT_EQ(reader.size(), 0);
+    EXPECT_EQ(reader.next(), nullptr);
+    EXPECT_EQ(reader.getDpuFreq().freqMHz, 1300);
+    EXPECT_EQ(reader.getDpuFreq().freqStatus, FreqStatus::VALID);
+}
+
+TEST(MLIR_ProfilingLayerInfoBuilder, MatchesLinearSearch) {
+    const auto tasks = getReferenceTaskInfo(generateEngineTasks());
+    const auto reference = getReferenceLayerInfo(tasks);
+
+    LayerInfoBuilder builder;
+    for (const auto& task : tasks) {
+        builder.addTask(task);
+    }
+    const auto layers = builder.getLayerInfo();
+
+    ASSERT_EQ(layers.size(), reference.size());
+    for (size_t i = 0; i < layers.size(); ++i) {
+        EXPECT_TRUE(layers[i] == reference[i]) << "Layer #" << i << " differs: " << layers[i].name;
+    }
+
+    const auto wrapped = getLayerInfo(tasks);
+    ASSERT_EQ(wrapped.size(), reference.size());
+    for (size_t i = 0; i < wrapped.size(); ++i) {
+        EXPECT_TRUE(wrapped[i] == reference[i]) << "Layer #" << i << " differs: " << wrapped[i].name;
+    }
+}
+
+TEST(MLIR_ProfilingLayerInfoBuilder, SkipsVariants) {
+    LayerInfoBuilder builder;
+    builder.addTask(makeTask("conv?t_Convolution/cluster_0/variant_0", TaskInfo::ExecType::DPU, 0, 100));
+    EXPECT_TRUE(builder.getLayerInfo().empty());
+
+    builder.addTask(makeTask("conv?t_Convolution/cluster_0", TaskInfo::ExecType::DPU, 20, 10));
+    builder.addTask(makeTask("conv?t_Convolution/cluster_1", TaskInfo::ExecType::DPU, 10, 5));
+    builder.addTask(makeTask("conv?t_Convolution", TaskInfo::ExecType::DMA, 40, 10));
+
+    const auto layers = builder.getLayerInfo();
+    ASSERT_EQ(layers.size(), 1);
+    EXPECT_STREQ(layers[0].name, "conv");
+    EXPECT_EQ(layers[0].start_time_ns, 10);
+    EXPECT_EQ(layers[0].duration_ns, 40);
+    EXPECT_EQ(layers[0].dpu_ns, 15);
+    EXPECT_EQ(layers[0].dma_ns, 10);
+}
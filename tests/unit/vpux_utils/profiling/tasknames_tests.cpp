@@ -0,0 +1,54 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/utils/profiling/tasknames.hpp"
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <string>
+
+using namespace vpux::profiling;
+
+TEST(MLIR_ProfilingTaskNameTable, DenseIdsInFirstOccurrenceOrder) {
+    TaskNameTable table;
+    EXPECT_EQ(table.size(), 0);
+
+    EXPECT_EQ(table.intern("conv?t_Convolution/cluster_0"), 0);
+    EXPECT_EQ(table.intern("conv"), 1);
+    EXPECT_EQ(table.intern(""), 2);
+    EXPECT_EQ(table.intern("conv?t_Convolution/cluster_0"), 0);
+    EXPECT_EQ(table.intern(std::string("conv")), 1);
+    EXPECT_EQ(table.intern(""), 2);
+    EXPECT_EQ(table.size(), 3);
+
+    EXPECT_EQ(table.getName(0), "conv?t_Convolution/cluster_0");
+    EXPECT_EQ(table.getName(1), "conv");
+    EXPECT_EQ(table.getName(2), "");
+    EXPECT_THROW(table.getName(3), std::out_of_range);
+}
+
+TEST(MLIR_ProfilingTaskNameTable, DoesNotKeepInternedViews) {
+    TaskNameTable table;
+    {
+        std::string name = "layer?t_Add";
+        EXPECT_EQ(table.intern(name), 0);
+        name.assign("other");
+    }
+    EXPECT_EQ(table.getName(0), "layer?t_Add");
+    EXPECT_EQ(table.intern("layer?t_Add"), 0);
+}
+
+TEST(MLIR_ProfilingTaskNameTable, NamesStayValidWhileGrowing) {
+    TaskNameTable table;
+    const auto first = table.getName(table.intern("layer_0?t_Convolution"));
+    for (int i = 1; i < 10000; ++i) {
+        EXPECT_EQ(table.intern("layer_" + std::to_string(i) + "?t_Convolution"), static_cast<uint32_t>(i));
+    }
+    EXPECT_EQ(first, "layer_0?t_Convolution");
+    EXPECT_EQ(first.data(), table.getName(0).data());
+    EXPECT_EQ(table.intern("layer_9999?t_Convolution"), 9999);
+    EXPECT_EQ(table.size(), 10000);
+}
@@ -26,11 +26,11 @@ using namespace vpux::profiling;
 
 namespace {
 
-enum class OutputFormat { TEXT, JSON, DEBUG };
+enum class OutputFormat { TEXT, JSON, DEBUG, COLUMNAR };
 
 DEFINE_string(b, "", "Precompiled blob that was profiled");
 DEFINE_string(p, "", "Profiling result binary");
-DEFINE_string(f, "json", "Format to use (text, json or debug)");
+DEFINE_string(f, "json", "Format to use (text, json, debug or columnar)");
 DEFINE_string(o, "", "Output file, stdout by default");
 DEFINE_bool(g, false, "Profiling data is from FPGA");
 DEFINE_bool(v, false, "Increased verbosity of DPU tasks parsing (include variant level tasks)");
@@ -80,6 +80,8 @@ OutputFormat getOutputFormat() {
         return OutputFormat::JSON;
     } else if (FLAGS_f == "debug") {
         return OutputFormat::DEBUG;
+    } else if (FLAGS_f == "columnar") {
+        return OutputFormat::COLUMNAR;
     }
     VPUX_THROW("Unknown output format: {0}.", FLAGS_f);
 }
@@ -102,7 +104,7 @@ void printCommandLineParameters() {
     std::cout << "Parameters:" << std::endl;
     std::cout << "    Network blob file:         " << FLAGS_b << std::endl;
     std::cout << "    Profiling result file:     " << FLAGS_p << std::endl;
-    std::cout << "    Format (text/json):        " << FLAGS_f << std::endl;
+    std::cout << "    Format:                    " << FLAGS_f << std::endl;
     std::cout << "    Output file:               " << FLAGS_o << std::endl;
     std::cout << "    Verbosity:                 " << verbosityToStr(getVerbosity()) << std::endl;
     std::cout << "    FPGA:                      " << FLAGS_g << std::endl;
@@ -138,12 +140,19 @@ void writeProfilingOutput(const OutputFormat format, const uint8_t* blobData, si
         writeDebugProfilingInfo(output, blobData, blobSize, profData, profSize);
         return;
     }
+    if (format == OutputFormat::TEXT || format == OutputFormat::COLUMNAR) {
+        // Tasks are consumed while they are merged from the engines, without the sorted copy getTaskInfo returns
+        TaskInfoReader reader(blobData, blobSize, profData, profSize, verbosity, fpga, highFreqPerfClk);
+        if (format == OutputFormat::TEXT) {
+            printProfilingAsText(reader, output);
+        } else {
+            printProfilingAsColumnar(reader, output);
+        }
+        return;
+    }
     ProfInfo profInfo = getProfInfo(blobData, blobSize, profData, profSize, verbosity, fpga, highFreqPerfClk);
 
     switch (format) {
-    case OutputFormat::TEXT:
-        printProfilingAsText(profInfo.tasks, profInfo.layers, output);
-        break;
     case OutputFormat::JSON:
         printProfilingAsTraceEvent(profInfo.tasks, profInfo.layers, profInfo.dpuFreq, output);
         break;
@@ -155,7 +164,7 @@ void writeProfilingOutput(const OutputFormat format, const uint8_t* blobData, si
 }  // namespace
 
 int main(int argc, char** argv) {
-    static const char* usage = "Usage: prof_parser -b <blob> -p <profiling.bin> [-f json|text] "
+    static const char* usage = "Usage: prof_parser -b <blob> -p <profiling.bin> [-f json|text|columnar] "
                                "[-o <output_file>] [-v|vv] [-g] [-m] [-fast_clk]";
     try {
         parseCommandLine(argc, argv, usage);
@@ -166,8 +175,14 @@ int main(int argc, char** argv) {
         std::ofstream outfile;
         const auto filename = FLAGS_o;
         if (!filename.empty()) {
-            outfile.open(filename, std::ios::out | std::ios::trunc);
+            auto mode = std::ios::out | std::ios::trunc;
+            if (FLAGS_f == "columnar") {
+                mode |= std::ios::binary;
+            }
+            outfile.open(filename, mode);
             VPUX_THROW_WHEN(!outfile, "Cannot write to '{0}'", filename);
+        } else {
+            VPUX_THROW_WHEN(FLAGS_f == "columnar", "Columnar output is binary and requires an output file (-o)");
         }
 
         std::ostream& output = outfile.is_open() ? outfile : std::cout;
@@ -3,14 +3,19 @@
 // SPDX-License-Identifier: Apache 2.0
 //
 
+#include <algorithm>
+#include <functional>
 #include <future>
 #include <iostream>
+#include <optional>
 #include <regex>
+#include <sstream>
 
 #include <gflags/gflags.h>
 
 #include "parser/parser.hpp"
 #include "scenario/scenario_graph.hpp"
+#include "simulation/load_sweep.hpp"
 #include "simulation/performance_mode.hpp"
 #include "simulation/reference_mode.hpp"
 #include "simulation/validation_mode.hpp"
@@ -22,7 +27,8 @@ static constexpr char help_message[] = "Optional. Print the usage message.";
 static constexpr char cfg_message[] = "Path to the configuration file.";
 static constexpr char pipeline_message[] = "Optional. Enable pipelined execution.";
 static constexpr char drop_message[] = "Optional. Drop frames if they come earlier than pipeline is completed.";
-static constexpr char mode_message[] = "Optional. Simulation mode: performance (default), reference, validation.";
+static constexpr char mode_message[] =
+        "Optional. Simulation mode: performance (default), reference, validation, sweep.";
 static constexpr char niter_message[] = "Optional. Number of iterations. If specified overwrites termination criterion"
                                         " for all scenarios in configuration file.";
 static constexpr char exec_time_message[] = "Optional. Time in seconds. If specified overwrites termination criterion"
@@ -32,6 +38,31 @@ static constexpr char inference_only_message[] =
         " Applicable only for \"performance\" mode. (default: true).";
 
 static constexpr char exec_filter_msg[] = "Optional. Run the scenarios that match provided string pattern.";
+static constexpr char percentiles_message[] =
+        "Optional. Comma-separated latency percentiles to report. Applicable only for \"performance\" mode."
+        " (default: 50,90,99,99.9).";
+static constexpr char latency_series_message[] =
+        "Optional. Path to the file to dump the latency time series to: .json or .csv (default) format."
+        " Applicable only for \"performance\" mode.";
+static constexpr char latency_series_interval_message[] =
+        "Optional. Time series window in milliseconds (default: 1000).";
+static constexpr char sweep_nireq_message[] =
+        "Optional. Comma-separated numbers of infer requests per model to sweep. Applicable only for \"sweep\" mode."
+        " (default: 1,2,4).";
+static constexpr char sweep_load_message[] =
+        "Optional. Comma-separated target frames rates to sweep as a fraction of the closed-loop throughput."
+        " Applicable only for \"sweep\" mode. (default: 0.5,0.75,0.9,1.0,1.1).";
+static constexpr char sweep_refine_message[] =
+        "Optional. Number of bisection steps to find the saturation point between the sweep loads."
+        " Applicable only for \"sweep\" mode. (default: 2).";
+static constexpr char sweep_percentile_message[] =
+        "Optional. Latency percentile used to detect saturation. Applicable only for \"sweep\" mode. (default: 99).";
+static constexpr char sweep_slo_message[] =
+        "Optional. Latency SLO in milliseconds, the load is considered saturated if the latency percentile exceeds it."
+        " Applicable only for \"sweep\" mode. (default: 0 - no SLO).";
+static constexpr char sweep_time_message[] =
+        "Optional. Time in seconds to run every sweep point unless -niter or -t is specified."
+        " Applicable only for \"sweep\" mode. (default: 5).";
 
 DEFINE_bool(h, false, help_message);
 DEFINE_string(cfg, "", cfg_message);
@@ -42,6 +73,18 @@ DEFINE_uint64(niter, 0, niter_message);
 DEFINE_uint64(t, 0, exec_time_message);
 DEFINE_bool(inference_only, true, inference_only_message);
 DEFINE_string(exec_filter, ".*", exec_filter_msg);
+DEFINE_string(percentiles, "50,90,99,99.9", percentiles_message);
+DEFINE_string(latency_series, "", latency_series_message);
+DEFINE_uint64(latency_series_interval, 1000, latency_series_interval_message);
+DEFINE_string(sweep_nireq, "1,2,4", sweep_nireq_message);
+DEFINE_string(sweep_load, "0.5,0.75,0.9,1.0,1.1", sweep_load_message);
+DEFINE_uint32(sweep_refine, 2, sweep_refine_message);
+DEFINE_double(sweep_percentile, 99.0, sweep_percentile_message);
+DEFINE_double(sweep_slo, 0.0, sweep_slo_message);
+DEFINE_uint64(sweep_time, 5, sweep_time_message);
+
+// NB: Relative gap between the target and the achieved frames rate that is still considered sustainable.
+static constexpr double kSweepRateTolerance = 0.05;
 
 static void showUsage() {
     std::cout << "protopipe [OPTIONS]" << std::endl;
@@ -56,6 +99,15 @@ static void showUsage() {
     std::cout << "    -t <value>              " << exec_time_message << std::endl;
     std::cout << "    -inference_only         " << inference_only_message << std::endl;
     std::cout << "    -exec_filter            " << exec_filter_msg << std::endl;
+    std::cout << "    -percentiles <value>    " << percentiles_message << std::endl;
+    std::cout << "    -latency_series <value> " << latency_series_message << std::endl;
+    std::cout << "    -latency_series_interval <value> " << latency_series_interval_message << std::endl;
+    std::cout << "    -sweep_nireq <value>    " << sweep_nireq_message << std::endl;
+    std::cout << "    -sweep_load <value>     " << sweep_load_message << std::endl;
+    std::cout << "    -sweep_refine <value>   " << sweep_refine_message << std::endl;
+    std::cout << "    -sweep_percentile <value> " << sweep_percentile_message << std::endl;
+    std::cout << "    -sweep_slo <value>      " << sweep_slo_message << std::endl;
+    std::cout << "    -sweep_time <value>     " << sweep_time_message << std::endl;
     std::cout << std::endl;
 }
 
@@ -76,9 +128,75 @@ bool parseCommandLine(int* argc, char*** argv) {
     std::cout << "    Pipelining is enabled:   " << std::boolalpha << FLAGS_pipeline << std::endl;
     std::cout << "    Simulation mode:         " << FLAGS_mode << std::endl;
     std::cout << "    Inference only:          " << std::boolalpha << FLAGS_inference_only << std::endl;
+    std::cout << "    Latency percentiles:     " << FLAGS_percentiles << std::endl;
+    if (!FLAGS_latency_series.empty()) {
+        std::cout << "    Latency time series:     " << FLAGS_latency_series << " (every "
+                  << FLAGS_latency_series_interval << " ms)" << std::endl;
+    }
+    if (FLAGS_mode == "sweep") {
+        std::cout << "    Sweep infer requests:    " << FLAGS_sweep_nireq << std::endl;
+        std::cout << "    Sweep loads:             " << FLAGS_sweep_load << std::endl;
+    }
     return true;
 }
 
+static std::vector<double> parseNumbers(const std::string& str, const std::string& what) {
+    std::vector<double> numbers;
+    std::stringstream ss(str);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        if (item.empty()) {
+            continue;
+        }
+        try {
+            size_t pos = 0;
+            numbers.push_back(std::stod(item, &pos));
+            if (pos != item.size()) {
+                throw std::invalid_argument(item);
+            }
+        } catch (const std::exception&) {
+            THROW_ERROR("Failed to parse " << what << ": \"" << item << "\"");
+        }
+    }
+    return numbers;
+}
+
+static std::vector<double> parsePercentiles(const std::string& str) {
+    auto percentiles = parseNumbers(str, "latency percentile");
+    for (const auto percent : percentiles) {
+        if (percent < 0.0 || percent > 100.0) {
+            THROW_ERROR("Latency percentile must be in range [0, 100], got: " << percent);
+        }
+    }
+    return percentiles;
+}
+
+static SweepOptions parseSweepOptions() {
+    SweepOptions opts;
+    for (const auto nireq : parseNumbers(FLAGS_sweep_nireq, "number of infer requests")) {
+        if (nireq < 1.0 || nireq != static_cast<double>(static_cast<size_t>(nireq))) {
+            THROW_ERROR("Number of infer requests must be a positive integer, got: " << nireq);
+        }
+        opts.nireqs.push_back(static_cast<size_t>(nireq));
+    }
+    opts.loads = parseNumbers(FLAGS_sweep_load, "sweep load");
+    for (const auto load : opts.loads) {
+        if (load <= 0.0) {
+            THROW_ERROR("Sweep load must be positive, got: " << load);
+        }
+    }
+    opts.refine_steps = FLAGS_sweep_refine;
+    opts.percentile = FLAGS_sweep_percentile;
+    if (opts.percentile < 0.0 || opts.percentile > 100.0) {
+        THROW_ERROR("Sweep percentile must be in range [0, 100], got: " << opts.percentile);
+    }
+    if (FLAGS_sweep_slo > 0.0) {
+        opts.latency_slo_ms = FLAGS_sweep_slo;
+    }
+    opts.rate_tolerance = kSweepRateTolerance;
+    return opts;
+}
+
 static ICompiled::Ptr compileSimulation(Simulation::Ptr simulation, const bool pipelined, const bool drop_frames) {
     LOG_INFO() << "Compile simulation" << std::endl;
     if (pipelined) {
@@ -147,7 +265,7 @@ const std::string& Task::name() const {
 }
 
 static Simulation::Ptr createSimulation(const std::string& mode, StreamDesc&& stream, const bool inference_only,
-                                        const Config& config) {
+                                        const Config& config, const LatencyReportOptions& latency_report) {
     Simulation::Ptr simulation;
     // NB: Common parameters for all simulations
     Simulation::Config cfg{stream.name, stream.frames_interval_in_us, config.disable_high_resolution_timer,
@@ -155,7 +273,7 @@ static Simulation::Ptr createSimulation(const std::string& mode, StreamDesc&& st
     if (mode == "performance") {
         PerformanceSimulation::Options opts{config.initializer, std::move(stream.initializers_map),
                                             std::move(stream.input_data_map), inference_only,
-                                            std::move(stream.target_latency)};
+                                            std::move(stream.target_latency), latency_report};
         simulation = std::make_shared<PerformanceSimulation>(std::move(cfg), std::move(opts));
     } else if (mode == "reference") {
         CalcRefSimulation::Options opts{config.initializer, std::move(stream.initializers_map),
@@ -172,6 +290,102 @@ static Simulation::Ptr createSimulation(const std::string& mode, StreamDesc&& st
     return simulation;
 }
 
+static void setNumRequests(InferenceParamsMap& infer_params_map, const size_t nireq) {
+    for (auto& [tag, params] : infer_params_map) {
+        // NB: Number of infer requests is configurable only for OpenVINO models.
+        if (std::holds_alternative<OpenVINOParams>(params)) {
+            std::get<OpenVINOParams>(params).nireq = nireq;
+        }
+    }
+}
+
+// NB: Stream with the single model to measure it in isolation from the rest of the scenario.
+static StreamDesc makeModelStream(const StreamDesc& stream, const std::string& tag) {
+    StreamDesc model_stream;
+    model_stream.name = stream.name + "/" + tag;
+    auto src = model_stream.graph.makeSource();
+    model_stream.graph.link(src, model_stream.graph.makeInfer(tag));
+    model_stream.infer_params_map.emplace(tag, stream.infer_params_map.at(tag));
+    model_stream.initializers_map = stream.initializers_map;
+    model_stream.input_data_map = stream.input_data_map;
+    return model_stream;
+}
+
+static std::vector<StreamStats> runStreams(std::vector<StreamDesc>&& streams, const std::vector<double>& fps,
+                                           const size_t nireq, const Config& config,
+                                           const ITermCriterion::Ptr& criterion,
+                                           const std::vector<double>& percentiles) {
+    ASSERT(streams.size() == fps.size());
+    LatencyReportOptions latency_report{percentiles, {}, nullptr, std::make_shared<ScenarioStats>()};
+    ThreadRunner runner;
+    std::vector<Task> tasks;
+    tasks.reserve(streams.size());
+    for (size_t i = 0; i < streams.size(); ++i) {
+        auto& stream = streams[i];
+        // NB: 0 means no limit for the frames rate, so the stream runs in closed-loop.
+        stream.frames_interval_in_us =
+                fps[i] == 0.0 ? 0u : std::max(static_cast<uint64_t>(1'000'000 / fps[i]), uint64_t{1});
+        setNumRequests(stream.infer_params_map, nireq);
+        auto stream_name = stream.name;
+        auto simulation = createSimulation("performance", std::move(stream), FLAGS_inference_only, config,
+                                           latency_report);
+        auto compiled = compileSimulation(simulation, FLAGS_pipeline, FLAGS_drop_frames);
+        tasks.emplace_back(std::move(compiled), std::move(stream_name), criterion->clone());
+        runner.add(std::ref(tasks.back()));
+    }
+    runner.run();
+
+    const auto stats = latency_report.scenario_stats->streams();
+    std::vector<StreamStats> ordered;
+    ordered.reserve(tasks.size());
+    for (const auto& task : tasks) {
+        if (!task.result()) {
+            THROW_ERROR("Stream " << task.name() << " failed: " << task.result().str());
+        }
+        // NB: Streams add their statistics as they finish, so restore the original order.
+        auto it = std::find_if(stats.begin(), stats.end(), [&](const StreamStats& s) {
+            return s.stream == task.name();
+        });
+        ASSERT(it != stats.end());
+        ordered.push_back(*it);
+    }
+    return ordered;
+}
+
+static void runSweep(IScenarioParser& parser, const Config& config, const size_t scenario_idx,
+                     const ITermCriterion::Ptr& criterion, const SweepOptions& sweep_opts,
+                     const std::vector<double>& percentiles) {
+    // NB: Scenario graph is consumed by the compilation, so the scenario is parsed again for every run.
+    auto parse_streams = [&parser, scenario_idx]() {
+        return std::move(parser.parseScenarios().scenarios.at(scenario_idx).streams);
+    };
+    auto run_sweep = [&](std::function<std::vector<StreamDesc>()> make_streams, const size_t num_streams) {
+        LoadSweep::Runner runner = [&](const std::vector<double>& fps, const size_t nireq) {
+            return runStreams(make_streams(), fps, nireq, config, criterion, percentiles);
+        };
+        LoadSweep sweep{std::move(runner), num_streams, sweep_opts};
+        printSweep(std::cout, sweep.run(), sweep_opts);
+    };
+
+    const auto& scenario = config.scenarios.at(scenario_idx);
+    std::cout << "all streams:" << std::endl;
+    run_sweep(parse_streams, scenario.streams.size());
+
+    for (size_t stream_idx = 0; stream_idx < scenario.streams.size(); ++stream_idx) {
+        const auto& stream = scenario.streams[stream_idx];
+        // NB: Models of the compound operations are measured only as part of the whole scenario.
+        for (const auto& [tag, params] : stream.infer_params_map) {
+            std::cout << "model " << tag << " (stream " << stream.name << "):" << std::endl;
+            run_sweep(
+                    [&, stream_idx, tag = tag]() {
+                        auto streams = parse_streams();
+                        return std::vector<StreamDesc>{makeModelStream(streams.at(stream_idx), tag)};
+                    },
+                    1u);
+        }
+    }
+}
+
 int main(int argc, char* argv[]) {
     // NB: Intentionally wrapped into try-catch to display exceptions occur on windows.
     try {
@@ -203,9 +417,28 @@ int main(int argc, char* argv[]) {
             global_criterion = std::make_shared<TimeOut>(FLAGS_t * 1'000'000);
         }
 
+        const auto percentiles = parsePercentiles(FLAGS_percentiles);
+        // NB: All scenarios and streams share the same time series file.
+        LatencyTimeSeries::Ptr time_series;
+        if (!FLAGS_latency_series.empty()) {
+            time_series =
+                    std::make_shared<LatencyTimeSeries>(FLAGS_latency_series, percentiles, FLAGS_latency_series_interval);
+        }
+
+        std::optional<SweepOptions> sweep_opts;
+        if (FLAGS_mode == "sweep") {
+            sweep_opts = parseSweepOptions();
+            if (!FLAGS_pipeline && sweep_opts->nireqs != std::vector<size_t>{1u}) {
+                LOG_INFO() << "Number of infer requests doesn't affect the synchronous execution,"
+                              " consider to use -pipeline option"
+                           << std::endl;
+            }
+        }
+
         std::regex filter_regex{FLAGS_exec_filter};
         bool any_scenario_failed = false;
-        for (auto&& scenario : config.scenarios) {
+        for (size_t scenario_idx = 0; scenario_idx < config.scenarios.size(); ++scenario_idx) {
+            auto& scenario = config.scenarios[scenario_idx];
             // NB: Skip the scenarios that don't match provided filter pattern
             if (!std::regex_match(scenario.name, filter_regex)) {
                 LOG_INFO() << "Skip the scenario " << scenario.name << " as it doesn't match the -exec_filter=\""
@@ -214,6 +447,20 @@ int main(int argc, char* argv[]) {
             }
             LOG_INFO() << "Start processing " << scenario.name << std::endl;
 
+            if (sweep_opts.has_value()) {
+                // NB: Sweep ignores termination criteria from the config, every point runs the same time.
+                ITermCriterion::Ptr criterion = global_criterion;
+                if (!criterion) {
+                    criterion = std::make_shared<TimeOut>(FLAGS_sweep_time * 1'000'000);
+                }
+                std::cout << "scenario " << scenario.name << " sweep:" << std::endl;
+                runSweep(*parser, config, scenario_idx, criterion, sweep_opts.value(), percentiles);
+                std::cout << "\n";
+                continue;
+            }
+
+            LatencyReportOptions latency_report{percentiles, scenario.name, time_series,
+                                                std::make_shared<ScenarioStats>()};
             ThreadRunner runner;
             std::vector<Task> tasks;
             tasks.reserve(scenario.streams.size());
@@ -227,7 +474,8 @@ int main(int argc, char* argv[]) {
                     }
                     criterion = global_criterion->clone();
                 }
-                auto simulation = createSimulation(FLAGS_mode, std::move(stream), FLAGS_inference_only, config);
+                auto simulation = createSimulation(FLAGS_mode, std::move(stream), FLAGS_inference_only, config,
+                                                   latency_report);
                 auto compiled = compileSimulation(simulation, FLAGS_pipeline, FLAGS_drop_frames);
                 tasks.emplace_back(std::move(compiled), std::move(stream_name), std::move(criterion));
                 runner.add(std::ref(tasks.back()));
@@ -244,6 +492,13 @@ int main(int argc, char* argv[]) {
                 }
                 std::cout << "stream " << task.name() << ": " << task.result().str() << std::endl;
             }
+            const auto scenario_latency = latency_report.scenario_stats->latency();
+            if (tasks.size() > 1u && scenario_latency.count() != 0u) {
+                // NB: Histograms are merged, so percentiles are computed over all frames of all streams.
+                std::cout << "all streams: latency: ";
+                printLatency(std::cout, scenario_latency, percentiles);
+                std::cout << std::endl;
+            }
             std::cout << "\n";
         }
         if (any_scenario_failed) {
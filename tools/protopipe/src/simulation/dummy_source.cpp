@@ -29,6 +29,8 @@ bool DummySource::pull(cv::gapi::wip::Data& data) {
         m_next_tick_ts = utils::timestamp<ts_t>() + m_latency_in_us;
     }
 
+    // NB: The tick the produced frame belongs to, used to measure the queueing delay.
+    int64_t tick_ts = m_next_tick_ts;
     int64_t curr_ts = utils::timestamp<ts_t>();
     if (curr_ts < m_next_tick_ts) {
         /*
@@ -61,6 +63,7 @@ bool DummySource::pull(cv::gapi::wip::Data& data) {
         if (m_drop_frames) {
             // NB: Shift tick to the next frame.
             m_next_tick_ts += m_latency_in_us;
+            tick_ts = m_next_tick_ts;
             // NB: Wait for the next frame.
             m_timer->wait(ts_t{m_next_tick_ts - curr_ts});
             // NB: Drop already produced frames + update seq_id for the current.
@@ -71,7 +74,11 @@ bool DummySource::pull(cv::gapi::wip::Data& data) {
     // after assigning it to the data.
     cv::Mat mat = m_mat;
 
-    data.meta[meta_tag::timestamp] = utils::timestamp<ts_t>();
+    const auto produced_ts = utils::timestamp<ts_t>();
+    if (m_latency_in_us != 0) {
+        m_queue_delay.record(produced_ts - tick_ts);
+    }
+    data.meta[meta_tag::timestamp] = produced_ts;
     data.meta[meta_tag::seq_id] = m_curr_seq_id++;
     data = mat;
     m_next_tick_ts += m_latency_in_us;
@@ -86,4 +93,9 @@ cv::GMetaArg DummySource::descr_of() const {
 void DummySource::reset() {
     m_next_tick_ts = -1;
     m_curr_seq_id = 0;
+    m_queue_delay.reset();
 };
+
+const LatencyHistogram& DummySource::queueDelay() const {
+    return m_queue_delay;
+}
@@ -12,6 +12,7 @@
 #include <opencv2/gapi.hpp>
 #include <opencv2/gapi/streaming/source.hpp>  // cv::gapi::wip::IStreamSource
 
+#include "utils/histogram.hpp"
 #include "utils/timer.hpp"
 #include "utils/utils.hpp"
 
@@ -26,6 +27,10 @@ public:
     cv::GMetaArg descr_of() const override;
     void reset();
 
+    // NB: Time in microseconds between the frame tick and the moment the frame is actually produced.
+    // It grows once the stream can't keep up with the frames rate.
+    const LatencyHistogram& queueDelay() const;
+
 private:
     uint64_t m_latency_in_us;
     bool m_drop_frames;
@@ -34,4 +39,5 @@ private:
     cv::Mat m_mat;
     int64_t m_next_tick_ts = -1;
     int64_t m_curr_seq_id = 0;
+    LatencyHistogram m_queue_delay;
 };
@@ -0,0 +1,115 @@
+//
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "latency_report.hpp"
+
+#include <filesystem>
+
+#include "utils/error.hpp"
+
+void printLatency(std::ostream& os, const LatencyHistogram& histogram, const std::vector<double>& percentiles) {
+    os << "min: " << histogram.min() / 1000.0 << " ms, avg: " << histogram.mean() / 1000.0
+       << " ms, max: " << histogram.max() / 1000.0 << " ms";
+    for (const auto percent : percentiles) {
+        os << ", p" << percent << ": " << histogram.percentile(percent) / 1000.0 << " ms";
+    }
+}
+
+LatencyTimeSeries::LatencyTimeSeries(const std::string& path, std::vector<double> percentiles,
+                                     uint64_t interval_in_ms)
+        : m_file(path),
+          m_json(std::filesystem::path{path}.extension() == ".json"),
+          m_percentiles(std::move(percentiles)),
+          m_interval_in_us(interval_in_ms * 1000u) {
+    if (!m_file.is_open()) {
+        THROW_ERROR("Failed to open latency time series file: " << path);
+    }
+    if (m_interval_in_us == 0u) {
+        THROW_ERROR("Latency time series interval must be positive!");
+    }
+    if (m_json) {
+        m_file << "[";
+        return;
+    }
+    m_file << "scenario,stream,window_start_ms,window_end_ms,frames,fps,min_ms,avg_ms,max_ms";
+    for (const auto percent : m_percentiles) {
+        m_file << ",p" << percent << "_ms";
+    }
+    m_file << std::endl;
+}
+
+LatencyTimeSeries::~LatencyTimeSeries() {
+    if (m_json) {
+        m_file << (m_empty ? "]" : "\n]") << std::endl;
+    }
+}
+
+uint64_t LatencyTimeSeries::intervalInUs() const {
+    return m_interval_in_us;
+}
+
+void LatencyTimeSeries::write(const Snapshot& snapshot) {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    if (m_json) {
+        writeJSON(snapshot);
+    } else {
+        writeCSV(snapshot);
+    }
+    // NB: Flush every snapshot to keep the file useful if the run is interrupted.
+    m_file.flush();
+    m_empty = false;
+}
+
+static double fps(const LatencyTimeSeries::Snapshot& snapshot) {
+    const auto window_us = snapshot.window_end_us - snapshot.window_start_us;
+    return window_us == 0u ? 0.0 : snapshot.latency.count() * 1'000'000.0 / window_us;
+}
+
+void LatencyTimeSeries::writeCSV(const Snapshot& snapshot) {
+    const auto& latency = snapshot.latency;
+    m_file << snapshot.scenario << "," << snapshot.stream << "," << snapshot.window_start_us / 1000.0 << ","
+           << snapshot.window_end_us / 1000.0 << "," << latency.count() << "," << fps(snapshot) << ","
+           << latency.min() / 1000.0 << "," << latency.mean() / 1000.0 << "," << latency.max() / 1000.0;
+    for (const auto percent : m_percentiles) {
+        m_file << "," << latency.percentile(percent) / 1000.0;
+    }
+    m_file << "\n";
+}
+
+void LatencyTimeSeries::writeJSON(const Snapshot& snapshot) {
+    const auto& latency = snapshot.latency;
+    m_file << (m_empty ? "\n" : ",\n") << "{\"scenario\": \"" << snapshot.scenario << "\", \"stream\": \""
+           << snapshot.stream << "\", \"window_start_ms\": " << snapshot.window_start_us / 1000.0
+           << ", \"window_end_ms\": " << snapshot.window_end_us / 1000.0 << ", \"frames\": " << latency.count()
+           << ", \"fps\": " << fps(snapshot) << ", \"min_ms\": " << latency.min() / 1000.0
+           << ", \"avg_ms\": " << latency.mean() / 1000.0 << ", \"max_ms\": " << latency.max() / 1000.0;
+    for (const auto percent : m_percentiles) {
+        m_file << ", \"p" << percent << "_ms\": " << latency.percentile(percent) / 1000.0;
+    }
+    m_file << "}";
+}
+
+double StreamStats::fps() const {
+    return elapsed_us == 0u ? 0.0 : latency.count() * 1'000'000.0 / elapsed_us;
+}
+
+void ScenarioStats::add(const StreamStats& stats) {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    m_streams.push_back(stats);
+}
+
+LatencyHistogram ScenarioStats::latency() const {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    LatencyHistogram latency;
+    for (const auto& stats : m_streams) {
+        latency.merge(stats.latency);
+    }
+    return latency;
+}
+
+std::vector<StreamStats> ScenarioStats::streams() const {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    return m_streams;
+}
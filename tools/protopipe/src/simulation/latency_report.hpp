@@ -0,0 +1,84 @@
+//
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "utils/histogram.hpp"
+
+// NB: Prints "min: <> ms, avg: <> ms, max: <> ms, p<N>: <> ms, ..." for the latencies recorded in microseconds.
+void printLatency(std::ostream& os, const LatencyHistogram& histogram, const std::vector<double>& percentiles);
+
+// NB: Thread-safe sink for the periodic latency snapshots of the streams.
+// The format is chosen by the file extension: ".json" produces the array of objects, otherwise CSV is written.
+class LatencyTimeSeries {
+public:
+    using Ptr = std::shared_ptr<LatencyTimeSeries>;
+
+    struct Snapshot {
+        std::string scenario;
+        std::string stream;
+        // NB: Window bounds relative to the start of the stream execution.
+        uint64_t window_start_us;
+        uint64_t window_end_us;
+        const LatencyHistogram& latency;
+    };
+
+    LatencyTimeSeries(const std::string& path, std::vector<double> percentiles, uint64_t interval_in_ms);
+    ~LatencyTimeSeries();
+
+    uint64_t intervalInUs() const;
+    void write(const Snapshot& snapshot);
+
+private:
+    void writeCSV(const Snapshot& snapshot);
+    void writeJSON(const Snapshot& snapshot);
+
+    std::mutex m_mutex;
+    std::ofstream m_file;
+    bool m_json;
+    bool m_empty = true;
+    std::vector<double> m_percentiles;
+    uint64_t m_interval_in_us;
+};
+
+struct StreamStats {
+    std::string stream;
+    uint64_t elapsed_us;
+    LatencyHistogram latency;
+    LatencyHistogram queue_delay;
+    int64_t dropped;
+    int64_t total_frames;
+
+    double fps() const;
+};
+
+// NB: Statistics of all streams of the scenario, every stream adds its own once it finishes.
+class ScenarioStats {
+public:
+    using Ptr = std::shared_ptr<ScenarioStats>;
+
+    void add(const StreamStats& stats);
+    // NB: Histograms are merged, so percentiles are computed over all frames of all streams.
+    LatencyHistogram latency() const;
+    std::vector<StreamStats> streams() const;
+
+private:
+    mutable std::mutex m_mutex;
+    std::vector<StreamStats> m_streams;
+};
+
+struct LatencyReportOptions {
+    std::vector<double> percentiles;
+    std::string scenario_name;
+    LatencyTimeSeries::Ptr time_series;
+    ScenarioStats::Ptr scenario_stats;
+};
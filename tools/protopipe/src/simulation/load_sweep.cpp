@@ -0,0 +1,184 @@
+//
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "load_sweep.hpp"
+
+#include <algorithm>
+#include <sstream>
+#include <tuple>
+
+#include "utils/error.hpp"
+#include "utils/logger.hpp"
+
+static std::string checkStreams(const std::vector<StreamStats>& stats, const std::vector<double>& fps,
+                                const SweepOptions& opts) {
+    std::stringstream ss;
+    for (size_t i = 0; i < stats.size(); ++i) {
+        const auto achieved_fps = stats[i].fps();
+        if (achieved_fps < fps[i] * (1.0 - opts.rate_tolerance)) {
+            ss << "stream " << stats[i].stream << " achieved " << achieved_fps << " of " << fps[i] << " FPS";
+            return ss.str();
+        }
+        const double interval_in_ms = 1000.0 / fps[i];
+        const double queue_delay_ms = stats[i].queue_delay.percentile(opts.percentile) / 1000.0;
+        if (queue_delay_ms > interval_in_ms) {
+            ss << "stream " << stats[i].stream << " queueing delay p" << opts.percentile << ": " << queue_delay_ms
+               << " ms exceeds " << interval_in_ms << " ms frames interval";
+            return ss.str();
+        }
+    }
+    return {};
+}
+
+static void printPoint(std::ostream& os, const LoadPoint& point, const double percentile) {
+    os << "nireq: " << point.nireq << ", ";
+    if (point.load.has_value()) {
+        os << "load: " << point.load.value() * 100 << "%, target: " << point.offered_fps << " FPS, ";
+    } else {
+        os << "closed-loop, ";
+    }
+    os << "throughput: " << point.achieved_fps << " FPS, latency p" << percentile << ": "
+       << point.latency.percentile(percentile) / 1000.0 << " ms";
+    if (point.load.has_value()) {
+        os << ", queueing delay p" << percentile << ": " << point.queue_delay.percentile(percentile) / 1000.0 << " ms";
+    }
+    if (!point.saturation.empty()) {
+        os << ", saturated: " << point.saturation;
+    }
+}
+
+LoadSweep::LoadSweep(LoadSweep::Runner runner, const size_t num_streams, SweepOptions opts)
+        : m_runner(std::move(runner)), m_num_streams(num_streams), m_opts(std::move(opts)) {
+    if (m_opts.nireqs.empty() || m_opts.loads.empty()) {
+        THROW_ERROR("Sweep requires at least one number of infer requests and one load value!");
+    }
+    if (!std::is_sorted(m_opts.loads.begin(), m_opts.loads.end())) {
+        THROW_ERROR("Sweep load values must be sorted in ascending order!");
+    }
+}
+
+LoadPoint LoadSweep::measure(const size_t nireq, const std::optional<double> load, const std::vector<double>& fps) {
+    const auto stats = m_runner(fps, nireq);
+    ASSERT(stats.size() == fps.size());
+
+    LoadPoint point{nireq, load, 0.0, 0.0, {}, {}, {}};
+    for (size_t i = 0; i < stats.size(); ++i) {
+        point.offered_fps += fps[i];
+        point.achieved_fps += stats[i].fps();
+        point.latency.merge(stats[i].latency);
+        point.queue_delay.merge(stats[i].queue_delay);
+    }
+
+    if (load.has_value()) {
+        point.saturation = checkStreams(stats, fps, m_opts);
+    }
+    const double latency_ms = point.latency.percentile(m_opts.percentile) / 1000.0;
+    if (point.saturation.empty() && m_opts.latency_slo_ms.has_value() && latency_ms > m_opts.latency_slo_ms.value()) {
+        std::stringstream ss;
+        ss << "latency p" << m_opts.percentile << ": " << latency_ms << " ms exceeds " << m_opts.latency_slo_ms.value()
+           << " ms SLO";
+        point.saturation = ss.str();
+    }
+
+    std::stringstream ss;
+    printPoint(ss, point, m_opts.percentile);
+    LOG_INFO() << ss.str() << std::endl;
+    return point;
+}
+
+LoadPoint LoadSweep::measureLoad(const size_t nireq, const double load, const std::vector<double>& capacity) {
+    std::vector<double> fps(capacity.size());
+    std::transform(capacity.begin(), capacity.end(), fps.begin(), [&](double c) {
+        return c * load;
+    });
+    return measure(nireq, std::make_optional(load), fps);
+}
+
+std::vector<LoadPoint> LoadSweep::run() {
+    std::vector<LoadPoint> points;
+    for (const auto nireq : m_opts.nireqs) {
+        LOG_INFO() << "Sweep load with " << nireq << " infer request(s)" << std::endl;
+        // NB: Closed-loop: every stream pulls the next frame as soon as the previous one is completed.
+        // Since all streams run concurrently, the throughput of every stream is its share of the capacity
+        // and is used as the reference to ramp the target frames rate.
+        const auto stats = m_runner(std::vector<double>(m_num_streams, 0.0), nireq);
+        ASSERT(stats.size() == m_num_streams);
+        std::vector<double> capacity;
+        capacity.reserve(m_num_streams);
+        LoadPoint closed_loop{nireq, std::nullopt, 0.0, 0.0, {}, {}, {}};
+        for (const auto& stream_stats : stats) {
+            if (stream_stats.latency.count() == 0u) {
+                THROW_ERROR("Stream " << stream_stats.stream << " hasn't produced any frame in closed-loop run!");
+            }
+            capacity.push_back(stream_stats.fps());
+            closed_loop.achieved_fps += stream_stats.fps();
+            closed_loop.latency.merge(stream_stats.latency);
+        }
+        std::stringstream ss;
+        printPoint(ss, closed_loop, m_opts.percentile);
+        LOG_INFO() << ss.str() << std::endl;
+        points.push_back(std::move(closed_loop));
+
+        std::optional<double> sustained, saturated;
+        for (const auto load : m_opts.loads) {
+            points.push_back(measureLoad(nireq, load, capacity));
+            if (!points.back().saturation.empty()) {
+                saturated = load;
+                break;
+            }
+            sustained = load;
+        }
+        if (!saturated.has_value()) {
+            continue;
+        }
+        // NB: Narrow down the knee between the last sustainable and the first saturated load.
+        double lo = sustained.value_or(0.0);
+        double hi = saturated.value();
+        for (uint32_t i = 0; i < m_opts.refine_steps; ++i) {
+            const double mid = (lo + hi) / 2;
+            points.push_back(measureLoad(nireq, mid, capacity));
+            if (points.back().saturation.empty()) {
+                lo = mid;
+            } else {
+                hi = mid;
+            }
+        }
+    }
+
+    std::stable_sort(points.begin(), points.end(), [](const LoadPoint& lhs, const LoadPoint& rhs) {
+        // NB: std::nullopt (closed-loop) goes first.
+        return std::tie(lhs.nireq, lhs.load) < std::tie(rhs.nireq, rhs.load);
+    });
+    return points;
+}
+
+std::optional<LoadPoint> LoadSweep::findKnee(const std::vector<LoadPoint>& points) {
+    std::optional<LoadPoint> knee;
+    for (const auto& point : points) {
+        if (!point.load.has_value() || !point.saturation.empty()) {
+            continue;
+        }
+        if (!knee.has_value() || point.achieved_fps > knee->achieved_fps) {
+            knee = point;
+        }
+    }
+    return knee;
+}
+
+void printSweep(std::ostream& os, const std::vector<LoadPoint>& points, const SweepOptions& opts) {
+    for (const auto& point : points) {
+        os << "    ";
+        printPoint(os, point, opts.percentile);
+        os << std::endl;
+    }
+    const auto knee = LoadSweep::findKnee(points);
+    os << "    knee: ";
+    if (knee.has_value()) {
+        printPoint(os, knee.value(), opts.percentile);
+    } else {
+        os << "not found, all loads are saturated";
+    }
+    os << std::endl;
+}
@@ -0,0 +1,68 @@
+//
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <functional>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "simulation/latency_report.hpp"
+#include "utils/histogram.hpp"
+
+struct SweepOptions {
+    // NB: Number of infer requests to configure for every model.
+    std::vector<size_t> nireqs;
+    // NB: Target frames rate as a fraction of the closed-loop throughput, must be sorted.
+    std::vector<double> loads;
+    // NB: Number of bisection steps between the last sustainable and the first saturated load.
+    uint32_t refine_steps;
+    double percentile;
+    std::optional<double> latency_slo_ms;
+    // NB: Allowed relative gap between the target and the achieved frames rate.
+    double rate_tolerance;
+};
+
+struct LoadPoint {
+    size_t nireq;
+    // NB: Fraction of the closed-loop throughput, std::nullopt for the closed-loop run itself.
+    std::optional<double> load;
+    double offered_fps;
+    double achieved_fps;
+    LatencyHistogram latency;
+    LatencyHistogram queue_delay;
+    // NB: Empty if the point is sustainable.
+    std::string saturation;
+};
+
+// NB: Finds the throughput-latency knee: for every number of infer requests the closed-loop throughput is
+// measured first, then the target frames rate is ramped up until the stream(s) saturate.
+// Saturation is detected once either the achieved frames rate falls behind the target one (frames are dropped),
+// the frames are queued for longer than the frames interval or the latency exceeds the SLO.
+class LoadSweep {
+public:
+    // NB: Runs all streams concurrently with the given frames rate per stream (0 - no limit)
+    // and the number of infer requests per model, returns the statistics of every stream in the same order.
+    using Runner = std::function<std::vector<StreamStats>(const std::vector<double>& fps, const size_t nireq)>;
+
+    LoadSweep(Runner runner, const size_t num_streams, SweepOptions opts);
+
+    std::vector<LoadPoint> run();
+
+    // NB: The sustainable point with the highest throughput.
+    static std::optional<LoadPoint> findKnee(const std::vector<LoadPoint>& points);
+
+private:
+    LoadPoint measure(const size_t nireq, const std::optional<double> load, const std::vector<double>& fps);
+    LoadPoint measureLoad(const size_t nireq, const double load, const std::vector<double>& capacity);
+
+    Runner m_runner;
+    size_t m_num_streams;
+    SweepOptions m_opts;
+};
+
+void printSweep(std::ostream& os, const std::vector<LoadPoint>& points, const SweepOptions& opts);
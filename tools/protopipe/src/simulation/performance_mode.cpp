@@ -14,47 +14,125 @@
 #include <opencv2/gapi/gproto.hpp>    // cv::GCompileArgs
 #include <opencv2/gapi/infer/ov.hpp>  // ov::benchmark_mode{}
 
+#include <algorithm>
 #include <chrono>
+#include <optional>
 
 class PerformanceMetrics {
 public:
-    PerformanceMetrics(const uint64_t elapsed, const std::vector<int64_t> latency, const std::vector<int64_t> seq_ids);
+    PerformanceMetrics(const uint64_t elapsed, const LatencyHistogram& latency, const int64_t dropped,
+                       const int64_t total_frames, const std::vector<double>& percentiles);
     friend std::ostream& operator<<(std::ostream& os, const PerformanceMetrics& metrics);
 
 private:
-    // TODO: avg, min, max statistics can be encapsulated.
-    double avg_latency_ms;
-    double min_latency_ms;
-    double max_latency_ms;
+    const LatencyHistogram& latency;
+    const std::vector<double>& percentiles;
     int64_t total_frames;
     double fps;
     int64_t dropped;
 };
 
-PerformanceMetrics::PerformanceMetrics(const uint64_t elapsed_us, const std::vector<int64_t> latency_us,
-                                       const std::vector<int64_t> seq_ids) {
-    avg_latency_ms = utils::avg(latency_us) / 1000.0;
-    min_latency_ms = utils::min(latency_us) / 1000.0;
-    max_latency_ms = utils::max(latency_us) / 1000.0;
+PerformanceMetrics::PerformanceMetrics(const uint64_t elapsed_us, const LatencyHistogram& latency_us,
+                                       const int64_t _dropped, const int64_t _total_frames,
+                                       const std::vector<double>& _percentiles)
+        : latency(latency_us), percentiles(_percentiles), total_frames(_total_frames), dropped(_dropped) {
     double elapsed_ms = static_cast<double>(elapsed_us / 1000.0);
-    fps = latency_us.size() / elapsed_ms * 1000;
-
-    dropped = 0;
-    int64_t prev_seq_id = seq_ids[0];
-    for (size_t i = 1; i < seq_ids.size(); ++i) {
-        dropped += seq_ids[i] - prev_seq_id - 1;
-        prev_seq_id = seq_ids[i];
-    }
-    total_frames = seq_ids.back() + 1;
+    fps = latency.count() / elapsed_ms * 1000;
 }
 
 std::ostream& operator<<(std::ostream& os, const PerformanceMetrics& metrics) {
-    os << "throughput: " << metrics.fps << " FPS, latency: min: " << metrics.min_latency_ms
-       << " ms, avg: " << metrics.avg_latency_ms << " ms, max: " << metrics.max_latency_ms
-       << " ms, frames dropped: " << metrics.dropped << "/" << metrics.total_frames;
+    os << "throughput: " << metrics.fps << " FPS, latency: ";
+    printLatency(os, metrics.latency, metrics.percentiles);
+    os << ", frames dropped: " << metrics.dropped << "/" << metrics.total_frames;
     return os;
 }
 
+// NB: Accumulates the per-iteration statistics in fixed memory regardless of the run duration.
+class PerformanceCollector {
+public:
+    PerformanceCollector(const std::string& stream_name, const LatencyReportOptions& opts);
+
+    void start();
+    void record(const int64_t ts_us, const int64_t latency_us, const int64_t seq_id);
+    PerformanceMetrics finish(const uint64_t elapsed_us, const DummySources& sources);
+
+    // NB: Warm-up iterations shouldn't be published to the time series and scenario statistics.
+    void enableReporting();
+
+private:
+    void flushWindow(const int64_t ts_us);
+
+    std::string m_stream_name;
+    LatencyReportOptions m_opts;
+    bool m_reporting = false;
+
+    LatencyHistogram m_latency;
+    LatencyHistogram m_window_latency;
+    int64_t m_start_ts = 0;
+    int64_t m_window_start_ts = 0;
+
+    std::optional<int64_t> m_prev_seq_id;
+    int64_t m_dropped = 0;
+};
+
+PerformanceCollector::PerformanceCollector(const std::string& stream_name, const LatencyReportOptions& opts)
+        : m_stream_name(stream_name), m_opts(opts) {
+}
+
+void PerformanceCollector::enableReporting() {
+    m_reporting = true;
+}
+
+void PerformanceCollector::start() {
+    m_latency.reset();
+    m_window_latency.reset();
+    m_start_ts = utils::timestamp<std::chrono::microseconds>();
+    m_window_start_ts = m_start_ts;
+    m_prev_seq_id.reset();
+    m_dropped = 0;
+}
+
+void PerformanceCollector::record(const int64_t ts_us, const int64_t latency_us, const int64_t seq_id) {
+    m_latency.record(latency_us);
+    if (m_prev_seq_id.has_value()) {
+        m_dropped += seq_id - m_prev_seq_id.value() - 1;
+    }
+    m_prev_seq_id = seq_id;
+
+    if (m_reporting && m_opts.time_series) {
+        m_window_latency.record(latency_us);
+        if (static_cast<uint64_t>(ts_us - m_window_start_ts) >= m_opts.time_series->intervalInUs()) {
+            flushWindow(ts_us);
+        }
+    }
+}
+
+void PerformanceCollector::flushWindow(const int64_t ts_us) {
+    const auto window_start_us = static_cast<uint64_t>(m_window_start_ts - m_start_ts);
+    const auto window_end_us = static_cast<uint64_t>(ts_us - m_start_ts);
+    m_opts.time_series->write({m_opts.scenario_name, m_stream_name, window_start_us, window_end_us, m_window_latency});
+    m_window_latency.reset();
+    m_window_start_ts = ts_us;
+}
+
+PerformanceMetrics PerformanceCollector::finish(const uint64_t elapsed_us, const DummySources& sources) {
+    const int64_t total_frames = m_prev_seq_id.value_or(-1) + 1;
+    if (m_reporting) {
+        if (m_opts.time_series && m_window_latency.count() != 0u) {
+            const int64_t curr_ts = utils::timestamp<std::chrono::microseconds>();
+            flushWindow(std::max(curr_ts, m_window_start_ts));
+        }
+        if (m_opts.scenario_stats) {
+            LatencyHistogram queue_delay;
+            for (const auto& src : sources) {
+                queue_delay.merge(src->queueDelay());
+            }
+            m_opts.scenario_stats->add({m_stream_name, elapsed_us, m_latency, queue_delay, m_dropped, total_frames});
+        }
+    }
+    return PerformanceMetrics{elapsed_us, m_latency, m_dropped, total_frames, m_opts.percentiles};
+}
+
 namespace {
 
 struct InputDataVisitor {
@@ -128,7 +206,7 @@ public:
     };
 
     SyncSimulation(cv::GCompiled&& compiled, std::vector<DummySource::Ptr>&& sources, const size_t num_outputs,
-                   const Options& options);
+                   const Options& options, PerformanceCollector&& collector);
 
     Result run(ITermCriterion::Ptr criterion) override;
 
@@ -141,8 +219,7 @@ private:
     std::vector<cv::Mat> m_out_mats;
     int64_t m_ts, m_seq_id;
 
-    std::vector<int64_t> m_per_iter_latency;
-    std::vector<int64_t> m_per_iter_seq_ids;
+    PerformanceCollector m_collector;
 
     Options m_opts;
 };
@@ -150,7 +227,7 @@ private:
 class PipelinedSimulation : public PipelinedCompiled {
 public:
     PipelinedSimulation(cv::GStreamingCompiled&& compiled, std::vector<DummySource::Ptr>&& sources,
-                        const size_t num_outputs);
+                        const size_t num_outputs, PerformanceCollector&& collector);
 
     Result run(ITermCriterion::Ptr criterion) override;
 
@@ -162,22 +239,24 @@ private:
     cv::optional<int64_t> m_ts, m_seq_id;
     std::vector<cv::optional<cv::Mat>> m_opt_mats;
 
-    std::vector<int64_t> m_per_iter_latency;
-    std::vector<int64_t> m_per_iter_seq_ids;
+    PerformanceCollector m_collector;
 };
 
 //////////////////////////////// SyncSimulation ///////////////////////////////
 SyncSimulation::SyncSimulation(cv::GCompiled&& compiled, std::vector<DummySource::Ptr>&& sources,
-                               const size_t num_outputs, const SyncSimulation::Options& options)
+                               const size_t num_outputs, const SyncSimulation::Options& options,
+                               PerformanceCollector&& collector)
         : m_exec(std::move(compiled)),
           m_sources(std::move(sources)),
           m_out_mats(num_outputs),
           m_ts(-1),
           m_seq_id(-1),
+          m_collector(std::move(collector)),
           m_opts(options) {
     LOG_DEBUG() << "Run warm-up iteration" << std::endl;
     this->run(std::make_shared<Iterations>(1u));
     LOG_DEBUG() << "Warm-up has finished successfully." << std::endl;
+    m_collector.enableReporting();
 }
 
 void SyncSimulation::reset() {
@@ -190,12 +269,10 @@ void SyncSimulation::reset() {
 Result SyncSimulation::run(ITermCriterion::Ptr criterion) {
     using namespace std::placeholders;
     auto cb = std::bind(&SyncSimulation::process, this, _1);
+    m_collector.start();
     auto out = m_exec.runLoop(cb, criterion);
-    PerformanceMetrics metrics(out.elapsed_us, m_per_iter_latency, m_per_iter_seq_ids);
-    m_per_iter_latency.clear();
-    m_per_iter_seq_ids.clear();
     std::stringstream ss;
-    ss << metrics;
+    ss << m_collector.finish(out.elapsed_us, m_sources);
     this->reset();
     return Success{ss.str()};
 };
@@ -220,8 +297,7 @@ bool SyncSimulation::process(cv::GCompiled& pipeline) {
     }
     pipeline(std::move(pipeline_inputs), std::move(pipeline_outputs));
     const auto curr_ts = utils::timestamp<ts_t>();
-    m_per_iter_latency.push_back(curr_ts - m_ts);
-    m_per_iter_seq_ids.push_back(m_seq_id);
+    m_collector.record(curr_ts, curr_ts - m_ts, m_seq_id);
 
     // NB: Do extra busy wait to simulate the user's post processing after stream.
     if (m_opts.after_iter_delay_in_us != 0) {
@@ -232,11 +308,15 @@ bool SyncSimulation::process(cv::GCompiled& pipeline) {
 
 //////////////////////////////// PipelinedSimulation ///////////////////////////////
 PipelinedSimulation::PipelinedSimulation(cv::GStreamingCompiled&& compiled, std::vector<DummySource::Ptr>&& sources,
-                                         const size_t num_outputs)
-        : m_exec(std::move(compiled)), m_sources(std::move(sources)), m_opt_mats(num_outputs) {
+                                         const size_t num_outputs, PerformanceCollector&& collector)
+        : m_exec(std::move(compiled)),
+          m_sources(std::move(sources)),
+          m_opt_mats(num_outputs),
+          m_collector(std::move(collector)) {
     LOG_DEBUG() << "Run warm-up iteration" << std::endl;
     this->run(std::make_shared<Iterations>(1u));
     LOG_DEBUG() << "Warm-up has finished successfully." << std::endl;
+    m_collector.enableReporting();
 }
 
 Result PipelinedSimulation::run(ITermCriterion::Ptr criterion) {
@@ -247,13 +327,11 @@ Result PipelinedSimulation::run(ITermCriterion::Ptr criterion) {
 
     using namespace std::placeholders;
     auto cb = std::bind(&PipelinedSimulation::process, this, _1);
+    m_collector.start();
     auto out = m_exec.runLoop(std::move(pipeline_inputs), cb, criterion);
-    PerformanceMetrics metrics(out.elapsed_us, m_per_iter_latency, m_per_iter_seq_ids);
-    m_per_iter_latency.clear();
-    m_per_iter_seq_ids.clear();
 
     std::stringstream ss;
-    ss << metrics;
+    ss << m_collector.finish(out.elapsed_us, m_sources);
 
     // NB: Reset sources since they may have their state changed.
     for (auto src : m_sources) {
@@ -274,8 +352,7 @@ bool PipelinedSimulation::process(cv::GStreamingCompiled& pipeline) {
     const auto curr_ts = utils::timestamp<ts_t>();
     ASSERT(m_ts.has_value());
     ASSERT(m_seq_id.has_value());
-    m_per_iter_latency.push_back(curr_ts - *m_ts);
-    m_per_iter_seq_ids.push_back(*m_seq_id);
+    m_collector.record(curr_ts, curr_ts - *m_ts, *m_seq_id);
     return has_data;
 }
 
@@ -295,7 +372,8 @@ std::shared_ptr<PipelinedCompiled> PerformanceSimulation::compilePipelined(Dummy
         compile_args += cv::compile_args(cv::gapi::wip::ov::benchmark_mode{});
     }
     auto compiled = m_comp.compileStreaming(descr_of(sources), std::move(compile_args));
-    return std::make_shared<PipelinedSimulation>(std::move(compiled), std::move(sources), m_comp.getOutMeta().size());
+    return std::make_shared<PipelinedSimulation>(std::move(compiled), std::move(sources), m_comp.getOutMeta().size(),
+                                                 PerformanceCollector{m_cfg.stream_name, m_opts.latency_report});
 }
 
 std::shared_ptr<SyncCompiled> PerformanceSimulation::compileSync(const bool drop_frames) {
@@ -333,5 +411,5 @@ std::shared_ptr<SyncCompiled> PerformanceSimulation::compileSync(const bool drop
 
     auto compiled = m_comp.compile(descr_of(sources), std::move(compile_args));
     return std::make_shared<SyncSimulation>(std::move(compiled), std::move(sources), m_comp.getOutMeta().size(),
-                                            options);
+                                            options, PerformanceCollector{m_cfg.stream_name, m_opts.latency_report});
 }
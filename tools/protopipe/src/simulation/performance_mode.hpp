@@ -9,6 +9,7 @@
 
 #include "simulation/computation.hpp"
 #include "simulation/computation_builder.hpp"
+#include "simulation/latency_report.hpp"
 #include "simulation/simulation.hpp"
 
 class PerformanceStrategy;
@@ -20,6 +21,7 @@ public:
         ModelsAttrMap<std::string> input_data_map;
         const bool inference_only;
         std::optional<double> target_latency;
+        LatencyReportOptions latency_report;
     };
     explicit PerformanceSimulation(Simulation::Config&& cfg, Options&& opts);
 
@@ -0,0 +1,96 @@
+//
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "histogram.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "utils/error.hpp"
+
+static int highestBit(uint64_t value) {
+    int bit = -1;
+    while (value != 0u) {
+        value >>= 1;
+        ++bit;
+    }
+    return bit;
+}
+
+size_t LatencyHistogram::bucketIndex(int64_t value) {
+    if (value < kSubBuckets) {
+        return static_cast<size_t>(value);
+    }
+    // NB: [2^msb, 2^(msb + 1)) range is split into kHalfSubBuckets buckets of 2^shift width.
+    const int shift = highestBit(static_cast<uint64_t>(value)) - kSubBucketBits + 1;
+    const int64_t sub_bucket = value >> shift;
+    return static_cast<size_t>(kSubBuckets + (shift - 1) * kHalfSubBuckets + (sub_bucket - kHalfSubBuckets));
+}
+
+int64_t LatencyHistogram::bucketHighestValue(size_t index) {
+    const auto idx = static_cast<int64_t>(index);
+    if (idx < kSubBuckets) {
+        return idx;
+    }
+    const int64_t shift = (idx - kSubBuckets) / kHalfSubBuckets + 1;
+    const int64_t sub_bucket = (idx - kSubBuckets) % kHalfSubBuckets + kHalfSubBuckets;
+    return ((sub_bucket + 1) << shift) - 1;
+}
+
+void LatencyHistogram::record(int64_t value) {
+    value = std::clamp(value, int64_t{0}, kMaxValue);
+    ++m_buckets[bucketIndex(value)];
+    ++m_count;
+    m_sum += static_cast<double>(value);
+    m_min = std::min(m_min, value);
+    m_max = std::max(m_max, value);
+}
+
+void LatencyHistogram::merge(const LatencyHistogram& other) {
+    for (size_t i = 0; i < kNumBuckets; ++i) {
+        m_buckets[i] += other.m_buckets[i];
+    }
+    m_count += other.m_count;
+    m_sum += other.m_sum;
+    m_min = std::min(m_min, other.m_min);
+    m_max = std::max(m_max, other.m_max);
+}
+
+void LatencyHistogram::reset() {
+    *this = LatencyHistogram{};
+}
+
+uint64_t LatencyHistogram::count() const {
+    return m_count;
+}
+
+int64_t LatencyHistogram::min() const {
+    return m_count == 0u ? 0 : m_min;
+}
+
+int64_t LatencyHistogram::max() const {
+    return m_count == 0u ? 0 : m_max;
+}
+
+double LatencyHistogram::mean() const {
+    return m_count == 0u ? 0.0 : m_sum / m_count;
+}
+
+int64_t LatencyHistogram::percentile(double percent) const {
+    ASSERT(percent >= 0.0 && percent <= 100.0);
+    if (m_count == 0u) {
+        return 0;
+    }
+    const auto rank = std::max(static_cast<uint64_t>(std::ceil(percent / 100.0 * m_count)), uint64_t{1});
+    uint64_t seen = 0u;
+    for (size_t i = 0; i < kNumBuckets; ++i) {
+        seen += m_buckets[i];
+        if (seen >= rank) {
+            // NB: Bucket bounds are wider than the observed values at the edges.
+            return std::clamp(bucketHighestValue(i), m_min, m_max);
+        }
+    }
+    return m_max;
+}
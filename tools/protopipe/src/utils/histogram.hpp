@@ -0,0 +1,47 @@
+//
+// Copyright (C) 2024 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+// NB: HDR-style histogram with fixed memory footprint: values below kSubBuckets are counted exactly,
+// every following power of two range is split into kSubBuckets / 2 linear buckets,
+// so the relative error of the reported values doesn't exceed 1 / kHalfSubBuckets.
+class LatencyHistogram {
+public:
+    static constexpr int kSubBucketBits = 8;
+    static constexpr int kMaxValueBits = 40;
+    static constexpr int64_t kSubBuckets = int64_t{1} << kSubBucketBits;
+    static constexpr int64_t kHalfSubBuckets = kSubBuckets / 2;
+    static constexpr int64_t kMaxValue = (int64_t{1} << kMaxValueBits) - 1;
+    static constexpr size_t kNumBuckets = kSubBuckets + (kMaxValueBits - kSubBucketBits) * kHalfSubBuckets;
+
+    // NB: Negative values are counted as 0, values above kMaxValue as kMaxValue.
+    void record(int64_t value);
+    void merge(const LatencyHistogram& other);
+    void reset();
+
+    uint64_t count() const;
+    int64_t min() const;
+    int64_t max() const;
+    double mean() const;
+
+    // NB: Returns the highest value equivalent to the requested percentile in range [0, 100].
+    int64_t percentile(double percent) const;
+
+private:
+    static size_t bucketIndex(int64_t value);
+    static int64_t bucketHighestValue(size_t index);
+
+    std::array<uint64_t, kNumBuckets> m_buckets{};
+    uint64_t m_count = 0u;
+    double m_sum = 0.0;
+    int64_t m_min = std::numeric_limits<int64_t>::max();
+    int64_t m_max = std::numeric_limits<int64_t>::min();
+};
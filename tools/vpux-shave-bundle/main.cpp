@@ -0,0 +1,156 @@
+//
+// Copyright (C) 2024 Intel Corporation.
+// SPDX-License-Identifier: Apache 2.0
+//
+
+#include "vpux/compiler/act_kernels/shave_binary_bundle_format.h"
+
+#include <llvm/Support/CommandLine.h>
+#include <llvm/Support/Error.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/Format.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/Path.h>
+#include <llvm/Support/Regex.h>
+#include <llvm/Support/raw_ostream.h>
+
+#include <optional>
+#include <string>
+#include <vector>
+
+using namespace vpux;
+
+namespace {
+
+enum class OutputFormat { Bundle, Cpp };
+enum class Compression { Auto, Zstd, Zlib, None };
+
+llvm::cl::list<std::string> inputPaths(llvm::cl::Positional, llvm::cl::OneOrMore, llvm::cl::value_desc("path"),
+                                       llvm::cl::desc("<SHAVE binary files or directories containing them>"));
+
+llvm::cl::opt<std::string> outputPath("o", llvm::cl::Required, llvm::cl::value_desc("filename"),
+                                      llvm::cl::desc("Output file name"));
+
+llvm::cl::opt<OutputFormat> outputFormat(
+        "format",
+        llvm::cl::values(clEnumValN(OutputFormat::Bundle, "bundle", "Bundle file to be loaded at runtime"),
+                         clEnumValN(OutputFormat::Cpp, "cpp", "C++ source embedding the bundle into the compiler")),
+        llvm::cl::init(OutputFormat::Bundle), llvm::cl::desc("Output format"));
+
+llvm::cl::opt<Compression> compression(
+        "compression",
+        llvm::cl::values(clEnumValN(Compression::Auto, "auto", "zstd if available, zlib otherwise"),
+                         clEnumValN(Compression::Zstd, "zstd", "zstd"), clEnumValN(Compression::Zlib, "zlib", "zlib"),
+                         clEnumValN(Compression::None, "none", "Store the binaries as is")),
+        llvm::cl::init(Compression::Auto), llvm::cl::desc("Compression of the bundle entries"));
+
+llvm::cl::opt<std::string> filter("filter", llvm::cl::value_desc("regex"),
+                                  llvm::cl::desc("Pack only the binaries whose file name matches the regex, e.g. "
+                                                 "'3720xx' to get the subset of one arch"));
+
+llvm::cl::opt<std::string> symbolName("symbol", llvm::cl::init("embeddedShaveBinaryBundle"),
+                                      llvm::cl::desc("Name of the bundle array in the C++ output"));
+
+llvm::ExitOnError exitOnErr;
+
+std::optional<llvm::compression::Format> getFormat() {
+    switch (compression) {
+    case Compression::Zstd:
+        return llvm::compression::Format::Zstd;
+    case Compression::Zlib:
+        return llvm::compression::Format::Zlib;
+    case Compression::None:
+        return std::nullopt;
+    default:
+        break;
+    }
+
+    for (const auto format : {llvm::compression::Format::Zstd, llvm::compression::Format::Zlib}) {
+        if (llvm::compression::getReasonIfUnsupported(format) == nullptr) {
+            return format;
+        }
+    }
+    return std::nullopt;
+}
+
+void addBinary(llvm::StringRef path, const std::optional<llvm::Regex>& nameFilter, std::vector<ShaveBinary>& binaries) {
+    const auto fileName = llvm::sys::path::filename(path);
+    if (nameFilter.has_value() && !nameFilter->match(fileName)) {
+        return;
+    }
+
+    auto buffer = exitOnErr(llvm::errorOrToExpected(
+            llvm::MemoryBuffer::getFile(path, /*IsText=*/false, /*RequiresNullTerminator=*/false)));
+    // Kernels without a data section produce empty files, the compiler handles missing and empty data the same way
+    if (buffer->getBufferSize() == 0) {
+        return;
+    }
+
+    const auto start = reinterpret_cast<const uint8_t*>(buffer->getBufferStart());
+    binaries.push_back({getShaveBinaryName(fileName), std::vector<uint8_t>(start, start + buffer->getBufferSize())});
+}
+
+std::vector<ShaveBinary> collectBinaries() {
+    std::optional<llvm::Regex> nameFilter;
+    if (!filter.empty()) {
+        nameFilter.emplace(filter);
+        std::string error;
+        if (!nameFilter->isValid(error)) {
+            exitOnErr(llvm::createStringError(llvm::inconvertibleErrorCode(), "Invalid filter '%s': %s",
+                                              filter.c_str(), error.c_str()));
+        }
+    }
+
+    std::vector<ShaveBinary> binaries;
+    for (const auto& path : inputPaths) {
+        if (!llvm::sys::fs::is_directory(path)) {
+            addBinary(path, nameFilter, binaries);
+            continue;
+        }
+
+        std::error_code ec;
+        for (llvm::sys::fs::directory_iterator it(path, ec), end; it != end && !ec; it.increment(ec)) {
+            if (llvm::sys::fs::is_regular_file(it->path())) {
+                addBinary(it->path(), nameFilter, binaries);
+            }
+        }
+        exitOnErr(llvm::errorCodeToError(ec));
+    }
+    return binaries;
+}
+
+void writeCpp(llvm::raw_ostream& os, llvm::ArrayRef<uint8_t> bundle) {
+    os << "// Generated by vpux-shave-bundle, do not edit\n\n";
+    os << "#include <cstddef>\n#include <cstdint>\n\n";
+    os << "namespace vpux {\n\n";
+    os << "extern const uint8_t " << symbolName << "[];\n";
+    os << "extern const size_t " << symbolName << "Size;\n\n";
+    os << "alignas(" << SHAVE_BINARY_BUNDLE_ALIGNMENT << ") const uint8_t " << symbolName << "[] = {";
+    for (size_t i = 0; i < bundle.size(); ++i) {
+        os << (i % 16 == 0 ? "\n    " : " ") << llvm::format_hex(bundle[i], 4) << ",";
+    }
+    os << "\n};\n";
+    os << "const size_t " << symbolName << "Size = sizeof(" << symbolName << ");\n\n";
+    os << "}  // namespace vpux\n";
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    exitOnErr.setBanner(std::string(argv[0]) + ": ");
+    llvm::cl::ParseCommandLineOptions(argc, argv, "SHAVE binary bundle packer\n");
+
+    const auto bundle = exitOnErr(packShaveBinaryBundle(collectBinaries(), getFormat()));
+
+    std::error_code ec;
+    llvm::raw_fd_ostream os(outputPath, ec,
+                            outputFormat == OutputFormat::Cpp ? llvm::sys::fs::OF_Text : llvm::sys::fs::OF_None);
+    exitOnErr(llvm::errorCodeToError(ec));
+
+    if (outputFormat == OutputFormat::Cpp) {
+        writeCpp(os, bundle);
+    } else {
+        os.write(reinterpret_cast<const char*>(bundle.data()), bundle.size());
+    }
+    return 0;
+}
@@ -238,8 +238,8 @@ mlir::LogicalResult exportELF(mlir::ModuleOp module, llvm::raw_ostream& output)
         const auto buf = ELFNPU37XX::exportToELF(module);
         output.write(reinterpret_cast<const char*>(buf.data()), buf.size());
     } else if (arch == VPU::ArchKind::NPU40XX) {
-        const auto buf = ELF::exportToELF(module);
-        output.write(reinterpret_cast<const char*>(buf.data()), buf.size());
+        ELF::RawOstreamBlobSink sink(output);
+        ELF::exportToELF(module, sink);
     } else {
         VPUX_THROW("ELF Flow not supported for ARCH {0}", VPU::stringifyArchKind(arch));
     }